@@ -0,0 +1,99 @@
+# ----------------------------------------------------------------------------
+# 빌드 시점 쉐이더 검증 및 가공 스크립트 (cmake -P 로 쉐이더마다 실행됨)
+#
+# MINIFY      : shader_minify 실행 파일
+# GLSLANG     : glslangValidator 실행 파일
+# SPIRV_CROSS : spirv-cross 실행 파일 (비어 있으면 SPIR-V 최적화 생략)
+# INPUT       : 원본 쉐이더 파일
+# OUTPUT      : 가공된 쉐이더를 출력할 파일
+# STAGE       : glslangValidator 의 쉐이더 스테이지 (vert, frag)
+# SEARCH_DIR  : #include 검색 경로
+# DEFINES     : 런타임에 쉐이더 변형용으로 삽입되는 define 이름들 (쉼표로 구분)
+# ----------------------------------------------------------------------------
+
+get_filename_component(OUTPUT_DIR ${OUTPUT} DIRECTORY)
+file(MAKE_DIRECTORY ${OUTPUT_DIR})
+
+set(EXPANDED ${OUTPUT}.expanded)
+string(REPLACE "," ";" DEFINE_LIST "${DEFINES}")
+
+# 1. 런타임과 같은 전처리기로 #include 를 펼침 (#line 지시문이 남아있으므로 에러 위치를 원래 파일로 되돌릴 수 있음)
+execute_process(
+  COMMAND ${MINIFY} -I ${SEARCH_DIR} --expand ${INPUT} ${EXPANDED}
+  RESULT_VARIABLE result)
+if(NOT result EQUAL 0)
+  message(FATAL_ERROR "ERROR::SHADER_BUILD::EXPAND_FAILED: ${INPUT}")
+endif()
+
+# 2. 변형용 define 을 모두 끈 경우와 모두 켠 경우로 검증 (#ifdef 의 양쪽 분기를 모두 검사하기 위함)
+set(ALL_DEFINES)
+foreach(define ${DEFINE_LIST})
+  list(APPEND ALL_DEFINES -D${define})
+endforeach()
+
+foreach(variant NONE ALL)
+  set(variant_defines)
+  if(variant STREQUAL "ALL")
+    if(NOT ALL_DEFINES)
+      break()
+    endif()
+    set(variant_defines ${ALL_DEFINES})
+  endif()
+
+  execute_process(
+    COMMAND ${GLSLANG} -S ${STAGE} ${variant_defines} ${EXPANDED}
+    RESULT_VARIABLE result
+    OUTPUT_VARIABLE log
+    ERROR_VARIABLE log)
+  if(NOT result EQUAL 0)
+    # glslangValidator 로그의 '파일번호:라인' 을 원래 파일 경로로 변환해서 출력
+    file(WRITE ${OUTPUT}.log "${log}")
+    execute_process(
+      COMMAND ${MINIFY} -I ${SEARCH_DIR} --annotate ${INPUT} ${OUTPUT}.log
+      OUTPUT_VARIABLE annotated)
+    message(FATAL_ERROR "ERROR::SHADER_BUILD::VALIDATION_FAILED: ${INPUT} (${variant} defines)\n${annotated}")
+  endif()
+endforeach()
+
+# 3. 변형용 define 을 사용하지 않는 쉐이더는 SPIR-V 로 컴파일했다가 다시 GLSL 로 되돌려서 정리된 코드를 얻음
+#    (SPIR-V 로 컴파일하면 #ifdef 가 그 자리에서 결정되어 버리므로, 변형을 사용하는 쉐이더는 원본을 그대로 minify 함)
+set(SOURCE ${INPUT})
+if(SPIRV_CROSS)
+  file(READ ${EXPANDED} expanded_code)
+  set(uses_variants FALSE)
+  foreach(define ${DEFINE_LIST})
+    string(FIND "${expanded_code}" "${define}" found)
+    if(NOT found EQUAL -1)
+      set(uses_variants TRUE)
+    endif()
+  endforeach()
+
+  if(NOT uses_variants)
+    execute_process(
+      COMMAND ${GLSLANG} -G -S ${STAGE} --auto-map-locations --auto-map-bindings -o ${OUTPUT}.spv ${EXPANDED}
+      RESULT_VARIABLE result
+      OUTPUT_VARIABLE log
+      ERROR_VARIABLE log)
+    if(result EQUAL 0)
+      execute_process(
+        COMMAND ${SPIRV_CROSS} ${OUTPUT}.spv --version 330 --no-es --no-420pack-extension --output ${OUTPUT}.cross
+        RESULT_VARIABLE result
+        OUTPUT_VARIABLE log
+        ERROR_VARIABLE log)
+    endif()
+
+    if(result EQUAL 0)
+      set(SOURCE ${OUTPUT}.cross)
+    else()
+      message(WARNING "SHADER_BUILD::SPIRV_ROUND_TRIP_SKIPPED: ${INPUT}\n${log}")
+    endif()
+  endif()
+endif()
+
+# 4. 주석과 공백을 제거해서 런타임이 읽어들일 최종 쉐이더 출력
+execute_process(
+  COMMAND ${MINIFY} -I ${SEARCH_DIR} ${SOURCE} ${OUTPUT}
+  RESULT_VARIABLE result)
+if(NOT result EQUAL 0)
+  message(FATAL_ERROR "ERROR::SHADER_BUILD::MINIFY_FAILED: ${INPUT}")
+endif()
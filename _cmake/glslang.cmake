@@ -0,0 +1,28 @@
+cmake_minimum_required(VERSION 3.18)
+
+include(FetchContent)
+Set(FETCHCONTENT_QUIET FALSE)
+
+FetchContent_Declare(glslang
+  GIT_REPOSITORY https://github.com/KhronosGroup/glslang.git
+  GIT_PROGRESS TRUE
+  GIT_TAG 14.3.0)
+
+FetchContent_GetProperties(glslang)
+
+if(NOT glslang_POPULATED)
+  # glslangValidator 실행 파일만 필요하므로, SPIRV-Tools 의존성(ENABLE_OPT)과 테스트 등은 끔
+  set(ENABLE_GLSLANG_BINARIES ON CACHE BOOL "" FORCE)
+  set(ENABLE_OPT OFF CACHE BOOL "" FORCE)
+  set(ENABLE_HLSL OFF CACHE BOOL "" FORCE)
+  set(ENABLE_SPVREMAPPER OFF CACHE BOOL "" FORCE)
+  set(ENABLE_CTEST OFF CACHE BOOL "" FORCE)
+  set(GLSLANG_TESTS OFF CACHE BOOL "" FORCE)
+  set(GLSLANG_ENABLE_INSTALL OFF CACHE BOOL "" FORCE)
+  FetchContent_MakeAvailable(glslang)
+endif()
+
+# glslangValidator 실행 파일 타겟
+set(glslang_VALIDATOR glslang-standalone)
+
+message(STATUS "glslang Should Be Downloaded")
@@ -0,0 +1,24 @@
+cmake_minimum_required(VERSION 3.18)
+
+include(FetchContent)
+Set(FETCHCONTENT_QUIET FALSE)
+
+FetchContent_Declare(libdeflate
+  GIT_REPOSITORY https://github.com/ebiggers/libdeflate.git
+  GIT_PROGRESS TRUE
+  GIT_TAG v1.22)
+
+FetchContent_GetProperties(libdeflate)
+
+if(NOT libdeflate_POPULATED)
+  # 정적 라이브러리만 빌드 (gzip 프로그램, 테스트 제외)
+  set(LIBDEFLATE_BUILD_STATIC_LIB ON CACHE BOOL "" FORCE)
+  set(LIBDEFLATE_BUILD_SHARED_LIB OFF CACHE BOOL "" FORCE)
+  set(LIBDEFLATE_BUILD_GZIP OFF CACHE BOOL "" FORCE)
+  set(LIBDEFLATE_BUILD_TESTS OFF CACHE BOOL "" FORCE)
+  FetchContent_MakeAvailable(libdeflate)
+endif()
+
+set(libdeflate_INCLUDE ${libdeflate_SOURCE_DIR})
+
+message(STATUS "libdeflate Should Be Downloaded")
@@ -0,0 +1,26 @@
+cmake_minimum_required(VERSION 3.18)
+
+include(FetchContent)
+Set(FETCHCONTENT_QUIET FALSE)
+
+FetchContent_Declare(spirv_cross
+  GIT_REPOSITORY https://github.com/KhronosGroup/SPIRV-Cross.git
+  GIT_PROGRESS TRUE
+  GIT_TAG vulkan-sdk-1.3.290.0)
+
+FetchContent_GetProperties(spirv_cross)
+
+if(NOT spirv_cross_POPULATED)
+  # SPIR-V -> GLSL 변환용 spirv-cross 실행 파일만 필요함
+  set(SPIRV_CROSS_CLI ON CACHE BOOL "" FORCE)
+  set(SPIRV_CROSS_STATIC ON CACHE BOOL "" FORCE)
+  set(SPIRV_CROSS_SHARED OFF CACHE BOOL "" FORCE)
+  set(SPIRV_CROSS_ENABLE_TESTS OFF CACHE BOOL "" FORCE)
+  set(SPIRV_CROSS_SKIP_INSTALL ON CACHE BOOL "" FORCE)
+  FetchContent_MakeAvailable(spirv_cross)
+endif()
+
+# spirv-cross 실행 파일 타겟
+set(spirv_cross_CLI spirv-cross)
+
+message(STATUS "SPIRV-Cross Should Be Downloaded")
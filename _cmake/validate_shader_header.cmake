@@ -0,0 +1,73 @@
+# ----------------------------------------------------------------------------
+# 빌드 시점 쉐이더 헤더(.glsl) 단독 검증 스크립트 (cmake -P 로 헤더마다 실행됨)
+#
+# .vs / .fs 가 포함하지 않는 헤더는 compile_shader.cmake 로는 한 번도 컴파일되지 않으므로,
+# 헤더 하나만 포함하는 빈 스테이지를 만들어서 검증함. (포함하는 쉐이더가 없더라도 깨진 헤더는 빌드를 실패시킴)
+#
+# MINIFY      : shader_minify 실행 파일
+# GLSLANG     : glslangValidator 실행 파일
+# INPUT       : 검증할 헤더 파일
+# OUTPUT      : 검증에 성공하면 생성할 스탬프 파일
+# SEARCH_DIR  : #include 검색 경로
+# DEFINES     : 런타임에 쉐이더 변형용으로 삽입되는 define 이름들 (쉼표로 구분)
+# ----------------------------------------------------------------------------
+
+get_filename_component(OUTPUT_DIR ${OUTPUT} DIRECTORY)
+get_filename_component(HEADER_NAME ${INPUT} NAME)
+file(MAKE_DIRECTORY ${OUTPUT_DIR})
+
+# 1. 헤더만 포함하는 빈 스테이지 생성 후, 런타임과 같은 전처리기로 #include 를 펼침
+set(STUB ${OUTPUT}.stub.glsl)
+set(EXPANDED ${OUTPUT}.expanded)
+file(WRITE ${STUB} "#version 330 core\n#include \"${HEADER_NAME}\"\nvoid main() {}\n")
+execute_process(
+  COMMAND ${MINIFY} -I ${SEARCH_DIR} --expand ${STUB} ${EXPANDED}
+  RESULT_VARIABLE result)
+if(NOT result EQUAL 0)
+  message(FATAL_ERROR "ERROR::SHADER_BUILD::EXPAND_FAILED: ${INPUT}")
+endif()
+
+string(REPLACE "," ";" DEFINE_LIST "${DEFINES}")
+set(ALL_DEFINES)
+foreach(define ${DEFINE_LIST})
+  list(APPEND ALL_DEFINES -D${define})
+endforeach()
+
+# 2. 헤더는 어느 스테이지용인지 알 수 없으므로, 프래그먼트 또는 버텍스 스테이지 중 하나로 컴파일되면 통과
+#    (dFdx() 같은 프래그먼트 전용 함수나 gl_VertexID 같은 버텍스 전용 변수를 사용하는 헤더도 있으므로)
+#    변형용 define 을 모두 끈 경우와 모두 켠 경우를 각각 검증함
+foreach(variant NONE ALL)
+  set(variant_defines)
+  if(variant STREQUAL "ALL")
+    if(NOT ALL_DEFINES)
+      break()
+    endif()
+    set(variant_defines ${ALL_DEFINES})
+  endif()
+
+  set(passed FALSE)
+  set(logs "")
+  foreach(stage frag vert)
+    execute_process(
+      COMMAND ${GLSLANG} -S ${stage} ${variant_defines} ${EXPANDED}
+      RESULT_VARIABLE result
+      OUTPUT_VARIABLE log
+      ERROR_VARIABLE log)
+    if(result EQUAL 0)
+      set(passed TRUE)
+      break()
+    endif()
+    string(APPEND logs "[${stage}]\n${log}")
+  endforeach()
+
+  if(NOT passed)
+    # glslangValidator 로그의 '파일번호:라인' 을 원래 파일 경로로 변환해서 출력
+    file(WRITE ${OUTPUT}.log "${logs}")
+    execute_process(
+      COMMAND ${MINIFY} -I ${SEARCH_DIR} --annotate ${STUB} ${OUTPUT}.log
+      OUTPUT_VARIABLE annotated)
+    message(FATAL_ERROR "ERROR::SHADER_BUILD::HEADER_VALIDATION_FAILED: ${INPUT} (${variant} defines)\n${annotated}")
+  endif()
+endforeach()
+
+file(WRITE ${OUTPUT} "")
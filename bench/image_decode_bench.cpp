@@ -0,0 +1,245 @@
+/*
+  이미지 디코딩 벤치마크
+
+  이미지 파일들을 메모리에 읽어둔 뒤, 파일 시그니처에 맞는 디코더 백엔드와 stb_image 로 각각 디코딩하여
+  백엔드별 처리량(디코딩된 픽셀 데이터 기준 MB/s)을 비교함. (OpenGL 컨텍스트 불필요)
+
+  실행 방법 : image_decode_bench [이미지 파일 ...]
+  - 파일을 지정하지 않으면 resources/textures/wood.png 와, 메모리에서 생성한 큰 이미지들(4096 x 4096 PNG, JPEG)을 사용함
+  - 파일 I/O 는 측정에서 제외하며, 이미지마다 ITERATIONS 번 디코딩하여 가장 빠른 시간을 사용함
+  - 8 비트 PNG 는 백엔드의 결과가 stb_image 와 픽셀 단위로 같은지도 확인함 (JPEG 는 IDCT 구현에 따라 값이 조금씩 다르므로 최대 오차만 출력)
+*/
+
+#define STB_IMAGE_IMPLEMENTATION
+#include <stb_image.h>
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#include <stb_image_write.h>
+
+#include "texture/image_decoder.hpp"
+#include "util/file_io.hpp"
+
+#include <chrono>   // 시간 측정
+#include <cstdlib>  // std::abs
+#include <cstring>  // std::memcmp
+#include <iomanip>  // std::setw
+#include <iostream> // 콘솔 입출력을 위한 헤더
+#include <string>   // std::string
+#include <vector>   // std::vector
+
+// 이미지마다 디코딩을 반복할 횟수
+static const int ITERATIONS = 5;
+
+// 메모리에서 생성하는 이미지의 크기
+static const int SYNTHETIC_SIZE = 4096;
+
+// 측정할 이미지 하나
+struct BenchImage
+{
+  std::string name;
+  std::string bytes; // 파일 내용
+};
+
+static double elapsedMs(std::chrono::steady_clock::time_point start)
+{
+  return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// stbi_write_*_to_func() 의 출력을 문자열에 이어붙임
+static void appendToString(void *context, void *data, int size)
+{
+  static_cast<std::string *>(context)->append(static_cast<const char *>(data), size);
+}
+
+/**
+ * 실제 텍스쳐와 비슷하게 압축되는 이미지 생성
+ *
+ * 부드러운 그라디언트에 약간의 노이즈를 섞어서, 완전히 평탄한 이미지(압축률이 비현실적으로 높음)나
+ * 순수한 노이즈(압축이 거의 안 됨)가 되지 않도록 함.
+ */
+static std::vector<uint8_t> makeSyntheticPixels(int size, int channels)
+{
+  std::vector<uint8_t> pixels((size_t)size * size * channels);
+  uint32_t seed = 12345;
+  for (int y = 0; y < size; y++)
+  {
+    for (int x = 0; x < size; x++)
+    {
+      seed = seed * 1664525u + 1013904223u;
+      int noise = (int)(seed >> 28) - 8;
+      uint8_t *pixel = &pixels[((size_t)y * size + x) * channels];
+      for (int c = 0; c < channels; c++)
+      {
+        int value = ((x * (c + 1) + y * (3 - c % 3)) >> 4) + noise;
+        pixel[c] = (uint8_t)(value < 0 ? 0 : (value > 255 ? 255 : value));
+      }
+      if (channels == 4)
+        pixel[3] = (uint8_t)(255 - ((x ^ y) & 63));
+    }
+  }
+  return pixels;
+}
+
+// 기본 측정 대상 (wood.png + 메모리에서 생성한 큰 PNG, JPEG)
+static std::vector<BenchImage> makeDefaultCorpus()
+{
+  std::vector<BenchImage> images;
+
+  BenchImage wood;
+  wood.name = "resources/textures/wood.png";
+  if (readWholeFile(wood.name, wood.bytes))
+    images.push_back(wood);
+  else
+    std::cout << "(resources/textures/wood.png not found, run from the repository root to include it)" << std::endl;
+
+  std::cout << "generating " << SYNTHETIC_SIZE << "x" << SYNTHETIC_SIZE << " synthetic images..." << std::endl;
+  const int channelCounts[2] = {3, 4};
+  for (int i = 0; i < 2; i++)
+  {
+    int channels = channelCounts[i];
+    std::vector<uint8_t> pixels = makeSyntheticPixels(SYNTHETIC_SIZE, channels);
+
+    BenchImage png;
+    png.name = std::string("synthetic ") + (channels == 4 ? "RGBA" : "RGB") + " PNG";
+    stbi_write_png_to_func(appendToString, &png.bytes, SYNTHETIC_SIZE, SYNTHETIC_SIZE, channels, pixels.data(),
+                           SYNTHETIC_SIZE * channels);
+    images.push_back(png);
+
+    if (channels == 3)
+    {
+      BenchImage jpeg;
+      jpeg.name = "synthetic RGB JPEG (q90)";
+      stbi_write_jpg_to_func(appendToString, &jpeg.bytes, SYNTHETIC_SIZE, SYNTHETIC_SIZE, channels, pixels.data(), 90);
+      images.push_back(jpeg);
+    }
+  }
+  return images;
+}
+
+// ITERATIONS 번 디코딩하여 가장 빠른 시간(ms) 반환. 마지막 디코딩 결과는 out 에 남겨둠 (실패 시 음수 반환)
+static double measure(const ImageDecoder &decoder, const BenchImage &image, DecodedImage &out)
+{
+  const uint8_t *data = reinterpret_cast<const uint8_t *>(image.bytes.data());
+  double bestMs = -1.0;
+  for (int i = 0; i < ITERATIONS; i++)
+  {
+    freeImagePixels(out.pixels);
+    out = DecodedImage();
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    bool decoded = decoder.decode(data, image.bytes.size(), 0, out);
+    double ms = elapsedMs(start);
+    if (!decoded)
+      return -1.0;
+    if (bestMs < 0.0 || ms < bestMs)
+      bestMs = ms;
+  }
+  return bestMs;
+}
+
+// 두 디코딩 결과의 채널 값 최대 오차 (크기나 포맷이 다르면 -1)
+static int maxDifference(const DecodedImage &a, const DecodedImage &b)
+{
+  if (a.width != b.width || a.height != b.height || a.channels != b.channels || a.bitsPerChannel != 8 || b.bitsPerChannel != 8)
+    return -1;
+
+  size_t count = (size_t)a.width * a.height * a.channels;
+  const uint8_t *p = static_cast<const uint8_t *>(a.pixels);
+  const uint8_t *q = static_cast<const uint8_t *>(b.pixels);
+  if (std::memcmp(p, q, count) == 0)
+    return 0;
+
+  int difference = 0;
+  for (size_t i = 0; i < count; i++)
+  {
+    int d = std::abs((int)p[i] - (int)q[i]);
+    if (d > difference)
+      difference = d;
+  }
+  return difference;
+}
+
+static void printResult(const char *backend, double ms, const DecodedImage &image)
+{
+  double megabytes = (double)image.width * image.height * image.channels * (image.bitsPerChannel / 8) / (1024.0 * 1024.0);
+  std::cout << "  " << std::left << std::setw(28) << backend << std::right << std::setw(10) << ms << " ms"
+            << std::setw(10) << megabytes / (ms / 1000.0) << " MB/s";
+}
+
+int main(int argc, char **argv)
+{
+  std::vector<BenchImage> images;
+  for (int i = 1; i < argc; i++)
+  {
+    BenchImage image;
+    image.name = argv[i];
+    if (!readWholeFile(image.name, image.bytes))
+    {
+      std::cout << "ERROR::IMAGE_DECODE_BENCH::FILE_NOT_READ: " << image.name << std::endl;
+      continue;
+    }
+    images.push_back(image);
+  }
+  if (argc <= 1)
+    images = makeDefaultCorpus();
+
+  std::cout << std::fixed << std::setprecision(1);
+  const ImageDecoders &decoders = ImageDecoders::shared();
+  for (size_t i = 0; i < images.size(); i++)
+  {
+    const BenchImage &image = images[i];
+    const uint8_t *data = reinterpret_cast<const uint8_t *>(image.bytes.data());
+
+    int width, height, channels, bitsPerChannel;
+    if (!decoders.info(data, image.bytes.size(), width, height, channels, bitsPerChannel))
+    {
+      std::cout << image.name << ": not an image" << std::endl;
+      continue;
+    }
+    std::cout << image.name << ": " << width << "x" << height << ", " << channels << " channels, " << bitsPerChannel << " bit, "
+              << image.bytes.size() / 1024 << " KB" << std::endl;
+
+    // 대체 백엔드 (stb_image)
+    DecodedImage reference;
+    double referenceMs = measure(decoders.fallback(), image, reference);
+    if (referenceMs < 0.0)
+      std::cout << "  " << decoders.fallback().name() << ": failed" << std::endl;
+    else
+    {
+      printResult(decoders.fallback().name(), referenceMs, reference);
+      std::cout << std::endl;
+    }
+
+    // 시그니처가 맞는 백엔드들
+    for (size_t d = 0; d < decoders.count(); d++)
+    {
+      const ImageDecoder &decoder = decoders.get(d);
+      if (!decoder.accepts(data, image.bytes.size()))
+        continue;
+
+      DecodedImage decoded;
+      double ms = measure(decoder, image, decoded);
+      if (ms < 0.0)
+      {
+        std::cout << "  " << decoder.name() << ": unsupported variant (falls back to stb_image)" << std::endl;
+        continue;
+      }
+
+      printResult(decoder.name(), ms, decoded);
+      if (referenceMs > 0.0)
+      {
+        int difference = maxDifference(decoded, reference);
+        std::cout << std::setw(8) << referenceMs / ms << "x";
+        if (difference == 0)
+          std::cout << ", identical to stb_image";
+        else if (difference > 0)
+          std::cout << ", max difference " << difference;
+        else
+          std::cout << ", format differs from stb_image";
+      }
+      std::cout << std::endl;
+      freeImagePixels(decoded.pixels);
+    }
+    freeImagePixels(reference.pixels);
+  }
+  return 0;
+}
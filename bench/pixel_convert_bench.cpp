@@ -0,0 +1,166 @@
+/*
+  픽셀 포맷 변환 벤치마크
+
+  pixel_convert.hpp 의 변환 커널들을 실행 중인 CPU 가 지원하는 명령어 집합마다 실행하여
+  스칼라 루프 대비 처리량(원본 픽셀 데이터 기준 MB/s)을 비교함. (OpenGL 컨텍스트 불필요)
+
+  실행 방법 : pixel_convert_bench [이미지 한 변의 픽셀 수(기본 4096)]
+  - 커널마다 ITERATIONS 번 실행하여 가장 빠른 시간을 사용함
+  - 모든 SIMD 커널의 결과가 스칼라 커널과 바이트 단위로 같은지도 확인함
+*/
+
+#include "texture/pixel_convert.hpp"
+
+#include <chrono>   // 시간 측정
+#include <cstdlib>  // std::atoi
+#include <iomanip>  // std::setw
+#include <iostream> // 콘솔 입출력을 위한 헤더
+#include <vector>   // std::vector
+
+// 커널마다 반복할 횟수
+static const int ITERATIONS = 10;
+
+// 측정할 커널 종류
+enum Kernel
+{
+  KERNEL_EXPAND_RGB_TO_RGBA,
+  KERNEL_SWIZZLE_RGBA_BGRA,
+  KERNEL_PREMULTIPLY_ALPHA,
+  KERNEL_CONVERT_16_TO_8,
+  KERNEL_SRGB_TO_LINEAR,
+  KERNEL_COUNT
+};
+
+static const char *KERNEL_NAMES[KERNEL_COUNT] = {"RGB -> RGBA", "RGBA <-> BGRA", "premultiply alpha", "16 bit -> 8 bit",
+                                                 "sRGB -> linear (LUT)"};
+
+// 벤치마크용 입력 데이터 (모든 커널이 같은 픽셀 수를 처리함)
+struct Inputs
+{
+  size_t pixelCount;
+  std::vector<uint8_t> rgb;
+  std::vector<uint8_t> rgba;
+  std::vector<uint16_t> rgba16;
+};
+
+static double elapsedMs(std::chrono::steady_clock::time_point start)
+{
+  return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// 커널 하나를 한 번 실행 (출력은 out 에 저장)
+static void runKernel(Kernel kernel, const Inputs &inputs, std::vector<uint8_t> &out)
+{
+  switch (kernel)
+  {
+  case KERNEL_EXPAND_RGB_TO_RGBA:
+    expandRgbToRgba(&inputs.rgb[0], &out[0], inputs.pixelCount);
+    break;
+  case KERNEL_SWIZZLE_RGBA_BGRA:
+    swizzleRgbaBgra(&inputs.rgba[0], &out[0], inputs.pixelCount);
+    break;
+  case KERNEL_PREMULTIPLY_ALPHA:
+    // 제자리 변환이므로 원본을 먼저 복사 (복사 시간도 포함되지만 모든 명령어 집합에서 같음)
+    out.assign(inputs.rgba.begin(), inputs.rgba.end());
+    premultiplyAlpha(&out[0], inputs.pixelCount);
+    break;
+  case KERNEL_CONVERT_16_TO_8:
+    convert16To8(&inputs.rgba16[0], &out[0], inputs.pixelCount * 4);
+    break;
+  case KERNEL_SRGB_TO_LINEAR:
+    convertSrgbToLinear(&inputs.rgba[0], &out[0], inputs.pixelCount, 4);
+    break;
+  default:
+    break;
+  }
+}
+
+// 커널이 읽어들이는 원본 데이터의 바이트 수
+static size_t inputBytes(Kernel kernel, const Inputs &inputs)
+{
+  switch (kernel)
+  {
+  case KERNEL_EXPAND_RGB_TO_RGBA:
+    return inputs.pixelCount * 3;
+  case KERNEL_CONVERT_16_TO_8:
+    return inputs.pixelCount * 8;
+  default:
+    return inputs.pixelCount * 4;
+  }
+}
+
+// ITERATIONS 번 실행하여 가장 빠른 시간(ms) 반환
+static double measure(Kernel kernel, const Inputs &inputs, std::vector<uint8_t> &out)
+{
+  double bestMs = -1.0;
+  for (int i = 0; i < ITERATIONS; i++)
+  {
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    runKernel(kernel, inputs, out);
+    double ms = elapsedMs(start);
+    if (bestMs < 0.0 || ms < bestMs)
+      bestMs = ms;
+  }
+  return bestMs;
+}
+
+int main(int argc, char **argv)
+{
+  int size = argc > 1 ? std::atoi(argv[1]) : 4096;
+  if (size <= 0)
+    size = 4096;
+
+  // 실제 이미지처럼 채널마다 값이 고르게 퍼지도록 간단한 난수로 채움
+  Inputs inputs;
+  inputs.pixelCount = (size_t)size * size;
+  inputs.rgb.resize(inputs.pixelCount * 3);
+  inputs.rgba.resize(inputs.pixelCount * 4);
+  inputs.rgba16.resize(inputs.pixelCount * 4);
+  uint32_t seed = 12345;
+  for (size_t i = 0; i < inputs.rgba.size(); i++)
+  {
+    seed = seed * 1664525u + 1013904223u;
+    inputs.rgba[i] = (uint8_t)(seed >> 24);
+    inputs.rgba16[i] = (uint16_t)(seed >> 8);
+    if (i < inputs.rgb.size())
+      inputs.rgb[i] = (uint8_t)(seed >> 16);
+  }
+
+  const PixelConvertLevel levels[] = {PIXEL_CONVERT_SCALAR, PIXEL_CONVERT_SSE2, PIXEL_CONVERT_SSSE3, PIXEL_CONVERT_AVX2,
+                                      PIXEL_CONVERT_NEON};
+  const PixelConvertLevel defaultLevel = pixelConvertLevel();
+
+  std::cout << "pixels: " << size << "x" << size << ", runtime dispatch selects " << pixelConvertLevelName(defaultLevel) << std::endl;
+  std::cout << std::fixed << std::setprecision(1);
+
+  bool allMatch = true;
+  for (int k = 0; k < KERNEL_COUNT; k++)
+  {
+    Kernel kernel = (Kernel)k;
+    std::cout << KERNEL_NAMES[k] << std::endl;
+
+    // 스칼라 결과를 기준으로 비교
+    std::vector<uint8_t> reference(inputs.pixelCount * 4);
+    setPixelConvertLevel(PIXEL_CONVERT_SCALAR);
+    double scalarMs = measure(kernel, inputs, reference);
+
+    for (size_t l = 0; l < sizeof(levels) / sizeof(levels[0]); l++)
+    {
+      if (!setPixelConvertLevel(levels[l]))
+        continue;
+
+      std::vector<uint8_t> out(inputs.pixelCount * 4);
+      double ms = levels[l] == PIXEL_CONVERT_SCALAR ? scalarMs : measure(kernel, inputs, out);
+      bool matches = levels[l] == PIXEL_CONVERT_SCALAR || out == reference;
+      allMatch = allMatch && matches;
+
+      double megabytes = inputBytes(kernel, inputs) / (1024.0 * 1024.0);
+      std::cout << "  " << std::left << std::setw(8) << pixelConvertLevelName(levels[l]) << std::right << std::setw(9) << ms << " ms"
+                << std::setw(10) << megabytes / (ms / 1000.0) << " MB/s" << std::setw(7) << scalarMs / ms << "x"
+                << (matches ? "" : "  MISMATCH") << std::endl;
+    }
+  }
+
+  setPixelConvertLevel(defaultLevel);
+  return allMatch ? 0 : 1;
+}
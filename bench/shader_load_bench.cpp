@@ -0,0 +1,195 @@
+/*
+  쉐이더 소스 로딩 벤치마크
+
+  수백 개의 쉐이더 파일(+ 공통 헤더)을 임시 디렉토리에 생성한 뒤,
+  아래 방식들로 모두 읽어들이는 데 걸리는 시간을 비교함. (OpenGL 컨텍스트 불필요)
+
+  1. ifstream -> stringstream -> string  : 기존 Shader 생성자의 방식 (파일당 버퍼 복사 3번)
+  2. readWholeFile()                      : 파일 크기만큼 미리 할당한 버퍼에 read() 한 번
+  3. ShaderPreprocessor::process()        : GL 스레드에서 직접 읽고 #include 펼치기
+  4. prefetch() 후 process()              : I/O 스레드에서 미리 읽어둔 뒤 #include 펼치기만 함
+                                            (prefetch 가 진행되는 동안 GL 스레드는 다른 초기화를 할 수 있으므로,
+                                             GL 스레드가 실제로 기다린 시간만 따로 측정)
+
+  실행 방법 : shader_load_bench [쉐이더 개수(기본 300)]
+
+  참고로, 방금 생성한 파일들은 운영체제의 페이지 캐시에 그대로 남아있으므로, 그냥 읽으면 모든 방식이 디스크가 아니라 메모리에서 읽게 됨.
+  각 방식은 서로 다른 파일 세트를 읽고, Linux 에서는 측정 전에 파일마다 디스크에 기록(fdatasync)한 뒤
+  posix_fadvise(POSIX_FADV_DONTNEED) 로 페이지 캐시에서 내보내서 디스크에서 읽는 시간까지 측정함.
+  그 외의 운영체제에서는 페이지 캐시를 비울 수 없으므로, 결과는 캐시가 따뜻한(warm) 상태의 시간임. (실행 결과에 함께 출력됨)
+*/
+
+#include "shader/shader_preprocessor.hpp"
+#include "util/file_io.hpp"
+
+#include <chrono>   // 시간 측정
+#include <cstdlib>  // std::atoi
+#include <cstdio>   // std::remove
+#include <fstream>  // 파일 입출력을 위한 헤더
+#include <iostream> // 콘솔 입출력을 위한 헤더
+#include <sstream>  // 문자열 스트림
+#include <string>   // std::string
+#include <vector>   // std::vector
+
+#ifdef __linux__
+#include <fcntl.h>  // open, posix_fadvise
+#include <unistd.h> // fdatasync, close
+#endif
+
+// 벤치마크용 파일을 생성할 디렉토리
+static const char *BENCH_DIR = "shader_load_bench_data";
+
+// 측정 방식 개수 (방식마다 서로 다른 파일 세트를 사용)
+static const int METHOD_COUNT = 4;
+
+static double elapsedMs(std::chrono::steady_clock::time_point start)
+{
+  return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// 기존 Shader 생성자의 파일 읽기 방식
+static std::string readWithStringStream(const std::string &path)
+{
+  std::ifstream file(path.c_str());
+  std::stringstream stream;
+  stream << file.rdbuf();
+  file.close();
+  return stream.str();
+}
+
+// 공통 헤더와 count 개의 쉐이더 파일 생성 (파일 경로 목록 반환)
+static std::vector<std::string> generateShaders(int set, int count)
+{
+  std::ostringstream directory;
+  directory << BENCH_DIR << "/set" << set;
+  makeDirectory(directory.str());
+
+  // 모든 쉐이더가 포함하는 공통 헤더
+  std::string header = directory.str() + "/common.glsl";
+  {
+    std::ofstream file(header.c_str());
+    file << "#ifndef COMMON_GLSL\n#define COMMON_GLSL\n";
+    for (int i = 0; i < 64; i++)
+      file << "float helper" << i << "(float x) { return x * " << i << ".0 + 0.5; }\n";
+    file << "#endif\n";
+  }
+
+  std::vector<std::string> paths;
+  for (int i = 0; i < count; i++)
+  {
+    std::ostringstream path;
+    path << directory.str() << "/shader" << i << ".fs";
+    std::ofstream file(path.str().c_str());
+    file << "#version 330 core\n#include \"common.glsl\"\nout vec4 FragColor;\nin vec2 TexCoords;\n";
+    for (int line = 0; line < 200; line++)
+      file << "// padding line " << line << " to make the file a realistic size for shader " << i << "\n";
+    file << "void main() { FragColor = vec4(helper" << (i % 64) << "(TexCoords.x), TexCoords, 1.0); }\n";
+    paths.push_back(path.str());
+  }
+  paths.push_back(header);
+  return paths;
+}
+
+// 파일들을 페이지 캐시에서 내보냄 (지원하지 않는 운영체제라면 false 반환)
+static bool evictPageCache(const std::vector<std::string> &paths)
+{
+#ifdef __linux__
+  bool evicted = true;
+  for (size_t i = 0; i < paths.size(); i++)
+  {
+    int fd = ::open(paths[i].c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+      evicted = false;
+      continue;
+    }
+    // 방금 쓴 페이지는 디스크에 기록되기 전까지(dirty) 내보낼 수 없으므로 먼저 기록함
+    ::fdatasync(fd);
+    evicted = ::posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED) == 0 && evicted;
+    ::close(fd);
+  }
+  return evicted;
+#else
+  (void)paths;
+  return false;
+#endif
+}
+
+// 생성한 파일 및 디렉토리 삭제
+static void removeShaders(int set, const std::vector<std::string> &paths)
+{
+  for (size_t i = 0; i < paths.size(); i++)
+    std::remove(paths[i].c_str());
+
+  std::ostringstream directory;
+  directory << BENCH_DIR << "/set" << set;
+  removeDirectory(directory.str());
+}
+
+int main(int argc, char **argv)
+{
+  int count = argc > 1 ? std::atoi(argv[1]) : 300;
+  if (count <= 0)
+    count = 300;
+
+  makeDirectory(BENCH_DIR);
+  std::vector<std::vector<std::string>> sets;
+  for (int set = 0; set < METHOD_COUNT; set++)
+    sets.push_back(generateShaders(set, count));
+
+  bool cold = true;
+  for (size_t set = 0; set < sets.size(); set++)
+    cold = evictPageCache(sets[set]) && cold;
+
+  size_t totalBytes = 0; // 최적화로 읽기 결과가 버려지지 않도록 누적
+
+  // 1. ifstream -> stringstream -> string
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  for (int i = 0; i < count; i++)
+    totalBytes += readWithStringStream(sets[0][i]).size();
+  double streamMs = elapsedMs(start);
+
+  // 2. readWholeFile()
+  start = std::chrono::steady_clock::now();
+  for (int i = 0; i < count; i++)
+  {
+    std::string code;
+    readWholeFile(sets[1][i], code);
+    totalBytes += code.size();
+  }
+  double readMs = elapsedMs(start);
+
+  // 3. GL 스레드에서 직접 읽고 #include 펼치기
+  ShaderPreprocessor direct;
+  start = std::chrono::steady_clock::now();
+  for (int i = 0; i < count; i++)
+    totalBytes += direct.process(sets[2][i]).size();
+  double processMs = elapsedMs(start);
+
+  // 4. I/O 스레드에서 미리 읽어둔 뒤 #include 펼치기
+  ShaderPreprocessor prefetched;
+  std::vector<std::string> roots(sets[3].begin(), sets[3].begin() + count);
+  start = std::chrono::steady_clock::now();
+  prefetched.prefetch(roots);
+  double prefetchStartMs = elapsedMs(start);
+  prefetched.waitPrefetch();
+  double prefetchTotalMs = elapsedMs(start);
+  start = std::chrono::steady_clock::now();
+  for (int i = 0; i < count; i++)
+    totalBytes += prefetched.process(sets[3][i]).size();
+  double prefetchedProcessMs = elapsedMs(start);
+
+  std::cout << "shaders: " << count << " (+1 shared header), bytes read: " << totalBytes << ", "
+            << (cold ? "cold page cache (evicted before reading)" : "warm page cache (could not evict, reads come from memory)") << "\n"
+            << "  ifstream + stringstream       : " << streamMs << " ms\n"
+            << "  readWholeFile                 : " << readMs << " ms\n"
+            << "  process (read on GL thread)   : " << processMs << " ms\n"
+            << "  prefetch (I/O thread, total)  : " << prefetchTotalMs << " ms\n"
+            << "  process after prefetch        : " << prefetchedProcessMs << " ms"
+            << " (GL thread blocked " << prefetchStartMs + prefetchedProcessMs << " ms)" << std::endl;
+
+  for (size_t set = 0; set < sets.size(); set++)
+    removeShaders((int)set, sets[set]);
+  removeDirectory(BENCH_DIR);
+  return 0;
+}
@@ -0,0 +1,90 @@
+#ifndef ASSET_PACK_HPP
+#define ASSET_PACK_HPP
+
+#include <cstddef> // size_t
+#include <cstdint> // uint64_t
+#include <string>  // std::string
+#include <utility> // std::pair
+#include <vector>  // std::vector
+
+#include "util/file_io.hpp" // MappedFile
+
+/*
+  AssetPack 클래스
+
+  쉐이더, 텍스쳐 등의 에셋 파일들을 하나로 묶은 팩 파일을 메모리에 매핑해두고,
+  에셋 경로로 팩 안의 데이터를 복사 없이 곧바로 찾아주는 클래스!
+
+  에셋마다 상대 경로로 파일을 열면 파일 개수만큼 open() 이 일어나고, 실행 위치(CWD)에 따라 파일을 찾지 못하기도 함.
+  팩 파일 하나만 시작할 때 매핑해두면, 이후의 에셋 조회는 메모리에서 이진 탐색 한 번으로 끝남.
+
+  파일 구조 (모든 정수는 리틀 엔디안) :
+    [헤더 32 바이트] 매직 넘버 "GLPK", 버전, 항목 개수, 예약, 인덱스 위치(u64), 경로 문자열 위치(u64)
+    [인덱스]         항목마다 32 바이트 (경로 해시(u64), 데이터 위치(u64), 데이터 크기(u64), 경로 위치(u32), 경로 길이(u32))
+                     경로 해시의 오름차순으로 정렬되어 있으므로 이진 탐색으로 찾음
+    [경로 문자열]    해시 충돌 시 실제 경로를 비교하기 위한 문자열들
+    [데이터]         에셋마다 64 바이트 경계에 정렬되어 있으므로, 매핑된 주소를 그대로 업로드 등에 넘길 수 있음
+
+  빌드 시점에 tools/asset_pack.cpp 로 만들어지며 (CMake 의 ASSET_PACK 옵션),
+  EMBED_RESOURCES 옵션을 켜면 팩 전체가 실행 파일 안에 상수 배열로 포함되어 파일 시스템 접근 없이 mountMemory() 로 사용됨.
+  팩이 마운트되지 않았거나 팩에 없는 경로는 readAsset() / assetExists() 가 디스크의 파일로 대신 처리함. (개발 중에는 팩 없이 사용)
+*/
+class AssetPack
+{
+public:
+  // 앱 전체에서 공유하는 AssetPack 객체
+  static AssetPack &shared();
+
+  AssetPack();
+
+  AssetPack(const AssetPack &) = delete;
+  AssetPack &operator=(const AssetPack &) = delete;
+
+  // 팩 파일을 매핑하고 헤더와 인덱스를 검증 (실패 시 false 반환. 다른 스레드에서 조회하기 전에 호출해야 함)
+  bool mount(const std::string &path);
+
+  // 메모리에 있는 팩(실행 파일에 포함된 배열 등)을 복사 없이 그대로 사용 (data 는 64 바이트 경계에 정렬되어 있어야 함)
+  bool mountMemory(const char *data, size_t size, const std::string &name);
+
+  // 팩 파일이 마운트되었는지 여부
+  bool isMounted() const;
+
+  // 팩 안에 path 에 해당하는 에셋이 있다면 매핑된 메모리의 주소와 크기를 반환 (복사 없음)
+  bool find(const std::string &path, const char *&data, size_t &size) const;
+
+  // 에셋 개수
+  size_t count() const;
+
+  // 팩 파일 작성 (files 는 (팩 안의 경로, 디스크의 파일 경로) 목록)
+  static bool write(const std::string &packPath, const std::vector<std::pair<std::string, std::string> > &files);
+
+  // 팩 안의 경로 정규화 ('\' -> '/', 앞쪽의 "./" 제거)
+  static std::string normalize(const std::string &path);
+
+  // 경로 해시 (FNV-1a 64 비트)
+  static uint64_t hashPath(const std::string &path);
+
+private:
+  MappedFile file;     // mount() 로 매핑한 팩 파일 (mountMemory() 라면 사용하지 않음)
+  const char *base;    // 팩의 시작 주소
+  const char *index;   // 인덱스 시작 주소
+  const char *strings; // 경로 문자열 시작 주소
+  size_t entryCount;
+
+  // data 에 있는 팩의 헤더와 인덱스를 검증하고 조회에 사용할 주소들을 기록
+  bool attach(const char *data, size_t size, const std::string &name);
+};
+
+// 에셋 파일 내용 전체를 out 에 읽기 (팩에 있다면 팩에서 복사하고, 없다면 디스크에서 읽음)
+bool readAsset(const std::string &path, std::string &out);
+
+// 에셋 내용을 가능하면 복사 없이 조회 (팩에 있다면 data 가 팩 안을 가리키고 storage 는 비어있음. 없다면 storage 로 읽어서 가리킴)
+bool readAssetView(const std::string &path, std::string &storage, const char *&data, size_t &size);
+
+// 에셋이 존재하는지 여부 (팩에 있거나 디스크에 파일이 있는 경우)
+bool assetExists(const std::string &path);
+
+// 지금까지 팩과 디스크에서 읽은 에셋 개수 및 크기 출력 (시작 시 I/O 비교용)
+void reportAssetIo();
+
+#endif // ASSET_PACK_HPP
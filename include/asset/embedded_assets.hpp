@@ -0,0 +1,22 @@
+#ifndef EMBEDDED_ASSETS_HPP
+#define EMBEDDED_ASSETS_HPP
+
+#include <cstddef> // size_t
+
+/*
+  실행 파일에 포함된 에셋 팩
+
+  CMake 의 EMBED_RESOURCES 옵션을 켜면 빌드 시점에 만든 에셋 팩(asset/asset_pack.hpp)을
+  tools/embed_file.cpp 가 상수 배열로 변환하여 실행 파일에 함께 링크함. (옵션을 켠 빌드에서만 정의되며, 그때 EMBEDDED_RESOURCES 가 정의됨)
+
+  배열은 읽기 전용 데이터 영역에 들어가므로, 실행 파일이 로드될 때 함께 매핑되어 별도의 파일 열기나 읽기가 전혀 없음.
+  실행 위치(CWD)나 resources/ 디렉토리의 존재 여부와 상관없이 AssetPack::mountMemory() 로 곧바로 사용할 수 있음.
+*/
+
+// 팩 전체 바이트 (64 바이트 경계에 정렬되어 있으므로, 팩 안의 에셋들도 정렬이 유지됨)
+extern const unsigned char EMBEDDED_ASSET_PACK[];
+
+// 팩 전체 바이트 수
+extern const size_t EMBEDDED_ASSET_PACK_SIZE;
+
+#endif // EMBEDDED_ASSETS_HPP
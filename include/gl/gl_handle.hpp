@@ -0,0 +1,149 @@
+#ifndef GL_HANDLE_HPP
+#define GL_HANDLE_HPP
+
+#include <glad/glad.h> // OpenGL 함수를 초기화하기 위한 헤더
+#include <vector>      // std::vector
+#include <mutex>       // std::mutex
+
+/*
+  OpenGL 오브젝트 종류
+
+  GLHandle 템플릿의 인자로 사용되어, 핸들이 어떤 종류의 오브젝트를 가리키는지
+  (= 어떤 glGen* / glDelete* 함수를 사용해야 하는지) 컴파일 타임에 결정해 줌.
+*/
+enum GLResourceType
+{
+  GL_RESOURCE_PROGRAM,
+  GL_RESOURCE_SHADER,
+  GL_RESOURCE_BUFFER,
+  GL_RESOURCE_VERTEX_ARRAY,
+  GL_RESOURCE_TEXTURE,
+  GL_RESOURCE_SAMPLER,
+  GL_RESOURCE_QUERY,
+  GL_RESOURCE_FRAMEBUFFER,
+  GL_RESOURCE_PROGRAM_PIPELINE,
+  GL_RESOURCE_TYPE_COUNT
+};
+
+/*
+  GLDeletionQueue 클래스
+
+  GLHandle 이 소멸될 때 곧바로 glDelete* 를 호출하는 대신, 오브젝트 이름(name)을
+  종류별 삭제 목록에 모아두었다가 프레임마다 한 번씩 flush() 에서 일괄 삭제하는 클래스!
+
+  glDeleteBuffers(n, ...), glDeleteTextures(n, ...) 처럼 여러 개의 오브젝트를
+  한 번의 드라이버 호출로 삭제할 수 있으므로, 리소스 생성/삭제가 잦더라도
+  오브젝트 하나당 드라이버 호출 하나씩의 비용이 들지 않음.
+
+  또한, 소멸자에서 GL 함수를 호출하지 않기 때문에, OpenGL 컨텍스트가 이미 해제된 이후
+  (ex> main() 의 지역 변수들이 glfwTerminate() 이후에 소멸되는 경우) 에도 안전함.
+
+  참고로, 쉐이더 오브젝트와 쉐이더 프로그램 오브젝트는 OpenGL 에
+  여러 개를 한꺼번에 삭제하는 API 가 없으므로 flush() 에서 하나씩 삭제함.
+  (GLuint 이름이 아닌 GLsync 포인터로 다루는 펜스 객체도 별도의 목록에 모아두었다가 하나씩 삭제함)
+*/
+class GLDeletionQueue
+{
+public:
+  // 프로세스 전역에서 공유하는 삭제 큐
+  static GLDeletionQueue &shared();
+
+  // 삭제할 오브젝트 이름 추가 (어느 스레드에서 호출해도 안전함)
+  void enqueue(GLResourceType type, GLuint name);
+
+  // 삭제할 펜스 객체 추가 (어느 스레드에서 호출해도 안전함)
+  void enqueueSync(GLsync sync);
+
+  // 모아둔 오브젝트들을 종류별로 일괄 삭제 (OpenGL 컨텍스트가 활성화된 스레드에서 프레임마다 한 번 호출)
+  void flush();
+
+  // 아직 삭제되지 않은 오브젝트 개수
+  size_t pendingCount();
+
+private:
+  std::mutex mutex;
+  std::vector<GLuint> pending[GL_RESOURCE_TYPE_COUNT]; // 종류별 삭제 목록
+  std::vector<GLuint> flushing;                        // flush() 에서 삭제 목록을 옮겨담을 재사용 버퍼
+  std::vector<GLsync> pendingSyncs;                    // 펜스 객체 삭제 목록
+};
+
+// 종류에 맞는 glGen* / glCreate* 함수로 새로운 오브젝트 생성 (쉐이더 오브젝트는 stage 를 알아야 하므로 0 반환)
+GLuint generateGLResource(GLResourceType type);
+
+/*
+  GLHandle 클래스 템플릿
+
+  OpenGL 오브젝트 이름 하나를 소유하는 move-only RAII 핸들.
+
+  복사가 불가능하므로 같은 오브젝트를 두 번 삭제하는 문제가 생기지 않고,
+  소멸되거나 다른 오브젝트로 교체될 때 기존 오브젝트를 GLDeletionQueue 에 넘겨줌.
+*/
+template <GLResourceType Type>
+class GLHandle
+{
+public:
+  GLHandle() : name(0) {}
+
+  // 이미 생성된 오브젝트 이름의 소유권을 넘겨받음
+  explicit GLHandle(GLuint name) : name(name) {}
+
+  ~GLHandle() { reset(); }
+
+  // 이동 생성 및 이동 대입 (소유권 이전)
+  GLHandle(GLHandle &&other) : name(other.release()) {}
+  GLHandle &operator=(GLHandle &&other)
+  {
+    if (this != &other)
+    {
+      reset(other.release());
+    }
+    return *this;
+  }
+
+  // 복사 금지
+  GLHandle(const GLHandle &) = delete;
+  GLHandle &operator=(const GLHandle &) = delete;
+
+  // 새로운 오브젝트를 생성하여 핸들로 반환
+  static GLHandle generate() { return GLHandle(generateGLResource(Type)); }
+
+  // 소유 중인 오브젝트 이름
+  GLuint get() const { return name; }
+
+  // 오브젝트를 소유하고 있는지 여부
+  explicit operator bool() const { return name != 0; }
+
+  // 소유권을 포기하고 오브젝트 이름 반환 (삭제 책임은 호출한 쪽으로 넘어감)
+  GLuint release()
+  {
+    GLuint released = name;
+    name = 0;
+    return released;
+  }
+
+  // 기존 오브젝트를 삭제 큐에 넘기고 새로운 오브젝트 이름의 소유권을 넘겨받음
+  void reset(GLuint newName = 0)
+  {
+    if (name != 0 && name != newName)
+    {
+      GLDeletionQueue::shared().enqueue(Type, name);
+    }
+    name = newName;
+  }
+
+private:
+  GLuint name; // OpenGL 오브젝트 이름
+};
+
+/** 오브젝트 종류별 핸들 타입 */
+typedef GLHandle<GL_RESOURCE_PROGRAM> ProgramHandle;
+typedef GLHandle<GL_RESOURCE_SHADER> ShaderHandle;
+typedef GLHandle<GL_RESOURCE_BUFFER> BufferHandle;
+typedef GLHandle<GL_RESOURCE_VERTEX_ARRAY> VertexArrayHandle;
+typedef GLHandle<GL_RESOURCE_TEXTURE> TextureHandle;
+typedef GLHandle<GL_RESOURCE_SAMPLER> SamplerHandle;
+typedef GLHandle<GL_RESOURCE_QUERY> QueryHandle;
+typedef GLHandle<GL_RESOURCE_FRAMEBUFFER> FramebufferHandle;
+typedef GLHandle<GL_RESOURCE_PROGRAM_PIPELINE> ProgramPipelineHandle;
+
+#endif // GL_HANDLE_HPP
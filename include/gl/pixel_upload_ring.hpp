@@ -0,0 +1,83 @@
+#ifndef PIXEL_UPLOAD_RING_HPP
+#define PIXEL_UPLOAD_RING_HPP
+
+#include <glad/glad.h> // OpenGL 함수를 초기화하기 위한 헤더
+#include <vector>      // std::vector
+
+#include "gl/gl_handle.hpp" // BufferHandle
+
+/*
+  PixelUploadRing 클래스
+
+  glTexSubImage2D() 에 클라이언트 메모리의 포인터를 넘기면, 드라이버는 함수가 반환되기 전에
+  픽셀 데이터를 모두 복사해야 하므로 큰 텍스쳐나 매 프레임 바뀌는 텍스쳐(동영상 등)를 올릴 때 GL 스레드가 멈춤.
+
+  이 클래스는 픽셀 데이터를 픽셀 언팩 버퍼(GL_PIXEL_UNPACK_BUFFER, PBO) 링에 써넣고,
+  glTexSubImage2D() 에는 버퍼 안의 오프셋을 넘겨서 실제 전송은 GPU 가 비동기로 처리하게 해주는 링 버퍼 클래스!
+
+  UniformRing 과 같은 구조로, 버퍼는 frameCount 개의 프레임 구간으로 나뉘며
+  각 구간을 다 쓴 뒤에는 펜스를 걸어두고, 같은 구간을 다시 사용하기 전에 그 펜스가 완료될 때까지 기다림.
+
+  - OpenGL 4.4 이상 : glBufferStorage() + GL_MAP_PERSISTENT_BIT 로 버퍼를 한 번만 매핑해두고 memcpy 만 함
+  - 그 미만        : glBufferSubData() 로 버퍼에 써넣은 뒤 같은 오프셋에서 업로드함 (동기화는 드라이버가 처리)
+  - 이번 프레임 구간에 남은 공간보다 큰 데이터는 기존처럼 클라이언트 메모리에서 곧바로 업로드하고 따로 집계함
+
+  펜스가 아직 완료되지 않아 beginFrame() 에서 기다린 횟수(stall)와 시간, 프레임당 업로드 바이트 수는 report() 로 출력함.
+*/
+class PixelUploadRing
+{
+public:
+  // PixelUploadRing 클래스 생성자 (frameSize : 한 프레임 동안 링을 통해 업로드할 수 있는 최대 바이트 수)
+  PixelUploadRing(size_t frameSize, unsigned int frameCount = 3);
+
+  // PixelUploadRing 클래스 소멸자
+  ~PixelUploadRing();
+
+  PixelUploadRing(const PixelUploadRing &) = delete;
+  PixelUploadRing &operator=(const PixelUploadRing &) = delete;
+
+  // 영구 매핑(persistent mapping) 을 사용하는지 여부
+  bool isPersistent() const;
+
+  // 새로운 프레임 시작 (이번 프레임에 사용할 구간을 GPU 가 다 읽을 때까지 기다림)
+  void beginFrame();
+
+  // 이번 프레임 구간에 남은 바이트 수
+  size_t remaining() const;
+
+  /**
+   * 바인딩된 텍스쳐에 glTexSubImage2D() 와 같은 업로드 (pixels 의 size 바이트를 링에 복사한 뒤 오프셋으로 업로드)
+   *
+   * GL_UNPACK_ALIGNMENT 등 픽셀 저장 모드는 호출하는 쪽에서 설정함.
+   * 남은 공간이 부족하면 클라이언트 메모리에서 곧바로 업로드하고 false 반환.
+   */
+  bool texSubImage2D(GLenum target, GLint level, GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type,
+                     const void *pixels, size_t size);
+
+  // 프레임 종료 (이번 프레임 구간을 사용했다면 펜스를 걸어둠)
+  void endFrame();
+
+  // 프레임당 업로드 바이트 수, 링을 거치지 못한 업로드 수, 펜스 대기 횟수 출력
+  void report() const;
+
+private:
+  BufferHandle buffer;        // 픽셀 언팩 버퍼 객체
+  size_t frameSize;           // 프레임 구간 하나의 크기 (OFFSET_ALIGNMENT 의 배수)
+  unsigned int frameCount;    // 프레임 구간 개수
+  unsigned int frameIndex;    // 이번 프레임에 사용하는 구간 번호
+  size_t offset;              // 이번 프레임 구간에서 다음으로 써넣을 위치
+  unsigned char *mapped;      // 영구 매핑된 버퍼 메모리 (영구 매핑을 사용하지 않으면 nullptr)
+  std::vector<GLsync> fences; // 프레임 구간별 펜스
+
+  // 통계
+  size_t frames;        // endFrame() 이 호출된 횟수
+  size_t ringBytes;     // 링을 통해 업로드한 바이트 수의 합
+  size_t peakBytes;     // 한 프레임 동안 링을 통해 업로드한 최대 바이트 수
+  size_t ringUploads;   // 링을 통해 업로드한 횟수
+  size_t directUploads; // 남은 공간이 부족해서 클라이언트 메모리에서 곧바로 업로드한 횟수
+  size_t directBytes;   // 그 바이트 수의 합
+  size_t stalls;        // beginFrame() 에서 펜스를 기다려야 했던 횟수
+  double stallMs;       // 그 시간의 합
+};
+
+#endif // PIXEL_UPLOAD_RING_HPP
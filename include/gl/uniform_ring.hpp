@@ -0,0 +1,67 @@
+#ifndef UNIFORM_RING_HPP
+#define UNIFORM_RING_HPP
+
+#include <glad/glad.h> // OpenGL 함수를 초기화하기 위한 헤더
+#include <vector>      // std::vector
+
+#include "gl/gl_handle.hpp" // BufferHandle
+
+/*
+  UniformRing 클래스
+
+  프레임마다 바뀌는 유니폼 블록 데이터(카메라 행렬, 오브젝트별 model 행렬 등)를
+  하나의 커다란 유니폼 버퍼에 순서대로 써넣고, glBindBufferRange() 로 필요한 구간만
+  유니폼 블록 바인딩 포인트에 연결해주는 링 버퍼 클래스!
+
+  버퍼는 frameCount 개의 프레임 구간으로 나뉘며, 매 프레임마다 다음 구간을 사용함.
+  GPU 가 아직 이전 프레임의 구간을 읽고 있을 수 있으므로, 각 구간을 다 쓴 뒤에는 펜스를 걸어두고
+  같은 구간을 다시 사용하기 전에 그 펜스가 완료될 때까지 기다림.
+
+  - OpenGL 4.4 이상 : glBufferStorage() + GL_MAP_PERSISTENT_BIT 로 버퍼를 한 번만 매핑해두고
+                      push() 에서는 매핑된 메모리에 memcpy 만 함 (드라이버 호출 없음)
+  - 그 미만        : glBufferSubData() 로 같은 위치에 데이터를 써넣음 (동기화는 드라이버가 처리)
+
+  오브젝트 하나를 그릴 때 드는 비용은 push() 의 memcpy 와 glBindBufferRange() 호출 하나뿐이며,
+  여러 쉐이더 프로그램이 같은 바인딩 포인트를 공유하므로 프로그램마다 유니폼을 다시 전송할 필요가 없음.
+
+  push() 에 넘겨주는 데이터는 쉐이더의 std140 레이아웃과 같은 메모리 배치를 가져야 함. (uniform_blocks.hpp 참고)
+*/
+class UniformRing
+{
+public:
+  // UniformRing 클래스 생성자 (frameSize : 한 프레임 동안 써넣을 수 있는 최대 바이트 수)
+  UniformRing(size_t frameSize, unsigned int frameCount = 3);
+
+  // UniformRing 클래스 소멸자
+  ~UniformRing();
+
+  UniformRing(const UniformRing &) = delete;
+  UniformRing &operator=(const UniformRing &) = delete;
+
+  // 영구 매핑(persistent mapping) 을 사용하는지 여부
+  bool isPersistent() const;
+
+  // 새로운 프레임 시작 (이번 프레임에 사용할 구간을 GPU 가 다 읽을 때까지 기다림)
+  void beginFrame();
+
+  // 데이터를 이번 프레임 구간에 써넣고 버퍼 내 오프셋 반환 (구간이 가득 찼다면 -1 반환)
+  GLintptr push(const void *data, size_t size);
+
+  // push() 로 써넣은 구간을 유니폼 블록 바인딩 포인트에 연결
+  void bindRange(GLuint binding, GLintptr offset, size_t size) const;
+
+  // 프레임 종료 (이번 프레임 구간에 펜스를 걸어둠)
+  void endFrame();
+
+private:
+  BufferHandle buffer;        // 유니폼 버퍼 객체
+  size_t frameSize;           // 프레임 구간 하나의 크기 (alignment 의 배수)
+  unsigned int frameCount;    // 프레임 구간 개수
+  unsigned int frameIndex;    // 이번 프레임에 사용하는 구간 번호
+  size_t alignment;           // GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT
+  size_t offset;              // 이번 프레임 구간에서 다음으로 써넣을 위치
+  unsigned char *mapped;      // 영구 매핑된 버퍼 메모리 (영구 매핑을 사용하지 않으면 nullptr)
+  std::vector<GLsync> fences; // 프레임 구간별 펜스
+};
+
+#endif // UNIFORM_RING_HPP
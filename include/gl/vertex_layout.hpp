@@ -0,0 +1,50 @@
+#ifndef VERTEX_LAYOUT_HPP
+#define VERTEX_LAYOUT_HPP
+
+#include <glad/glad.h> // OpenGL 함수를 초기화하기 위한 헤더
+#include <vector>      // std::vector
+
+// 버텍스 속성 하나의 데이터 해석 방식 (glVertexAttribPointer() 의 인자들)
+struct VertexAttribute
+{
+  GLuint location;      // layout(location = ?) 에 대응하는 속성 번호
+  GLint components;     // 성분 개수 (1 ~ 4)
+  GLenum type;          // 성분 타입 (GL_FLOAT, GL_INT 등)
+  GLboolean normalized; // 정수 타입을 [0, 1] 또는 [-1, 1] 로 정규화할지 여부
+  GLsizei stride;       // 정점 하나의 크기 (바이트)
+  size_t offset;        // 정점 시작 위치로부터 이 속성까지의 오프셋 (바이트)
+
+  // 정수 그대로 쉐이더에 전달되는지 여부 (정규화하지 않는 정수 타입은 glVertexAttribIPointer 로 설정됨)
+  bool isInteger() const;
+};
+
+/*
+  VertexLayout 클래스
+
+  VAO 에 설정할 버텍스 속성들의 목록을 한 곳에 모아서 기술하는 클래스!
+
+  glVertexAttribPointer() 를 직접 나열하는 대신 VertexLayout 으로 기술해두면,
+  apply() 로 VAO 를 설정할 때와 ShaderReflection::validate() 로 쉐이더의 입력 변수와 비교할 때
+  같은 정보를 재사용할 수 있음.
+*/
+class VertexLayout
+{
+public:
+  // 버텍스 속성 추가 (메서드 체이닝이 가능하도록 자기 자신을 반환)
+  VertexLayout &add(GLuint location, GLint components, GLenum type, GLsizei stride, size_t offset,
+                    GLboolean normalized = GL_FALSE);
+
+  // 현재 바인딩된 VAO 와 GL_ARRAY_BUFFER 에 버텍스 속성들을 설정
+  void apply() const;
+
+  // location 에 해당하는 버텍스 속성 (없으면 nullptr)
+  const VertexAttribute *find(GLuint location) const;
+
+  // 등록된 버텍스 속성 목록
+  const std::vector<VertexAttribute> &getAttributes() const;
+
+private:
+  std::vector<VertexAttribute> attributes;
+};
+
+#endif // VERTEX_LAYOUT_HPP
@@ -0,0 +1,81 @@
+#ifndef PROGRAM_CACHE_HPP
+#define PROGRAM_CACHE_HPP
+
+#include <glad/glad.h> // OpenGL 함수를 초기화하기 위한 헤더
+#include <string>      // std::string
+#include <map>         // std::map
+
+/*
+  ProgramCache 클래스
+
+  glGetProgramBinary() 로 얻은 링킹 완료된 쉐이더 프로그램 바이너리를
+  디스크에 저장해두었다가, 다음 실행 시 glProgramBinary() 로 다시 로드하여
+  쉐이더 컴파일 및 링킹 과정을 건너뛸 수 있도록 관리하는 클래스!
+
+  캐시 키는 버텍스 / 프래그먼트 쉐이더 소스코드와
+  GL_VENDOR, GL_RENDERER, GL_VERSION 문자열을 함께 해싱하여 만들기 때문에,
+  쉐이더 코드가 바뀌거나 그래픽 드라이버가 업데이트되면 자연스럽게 새로운 키가 생성됨.
+
+  또한, 캐시 디렉토리의 전체 크기가 maxBytes 를 넘어서면
+  가장 오랫동안 사용되지 않은 바이너리부터 삭제함.
+
+  각 바이너리 파일에는 쉐이더 리플렉션 메타데이터(ShaderReflection::serialize()) 도
+  함께 저장할 수 있어서, 캐시 적중 시 glGetActive* 조회까지 건너뛸 수 있음.
+
+  참고로, 생성자 내부에서 GL 함수를 호출하므로,
+  반드시 OpenGL 컨텍스트 생성 및 GLAD 초기화 이후에 생성해야 함!
+*/
+class ProgramCache
+{
+public:
+  // ProgramCache 클래스 생성자
+  ProgramCache(const std::string &directory, unsigned long long maxBytes = 64ull * 1024ull * 1024ull);
+
+  // ProgramCache 클래스 소멸자
+  ~ProgramCache();
+
+  // 현재 드라이버가 프로그램 바이너리 저장 및 로드를 지원하는지 여부
+  bool isSupported() const;
+
+  // 쉐이더 소스코드와 드라이버 정보를 해싱하여 캐시 키 생성
+  std::string makeKey(const std::string &vertexCode, const std::string &fragmentCode) const;
+
+  // 캐시된 바이너리를 program 에 로드 (드라이버가 바이너리를 거부하면 false 반환)
+  // (metadata 가 주어지면 함께 저장된 메타데이터를 넘겨받으며, 저장된 메타데이터가 없으면 빈 문자열이 됨)
+  bool load(const std::string &key, unsigned int program, std::string *metadata = nullptr);
+
+  // 링킹이 완료된 program 의 바이너리를 메타데이터와 함께 캐시에 저장
+  void store(const std::string &key, unsigned int program, const std::string &metadata = "");
+
+private:
+  // 캐시 인덱스 파일에 기록되는 캐시 항목 정보
+  struct Entry
+  {
+    unsigned long long size;    // 바이너리 파일 크기
+    unsigned long long lastUse; // 마지막으로 사용된 시점 (LRU 정렬용 카운터)
+  };
+
+  std::string directory;                // 캐시 디렉토리 경로
+  unsigned long long maxBytes;          // 캐시 디렉토리 최대 크기
+  unsigned long long totalBytes;        // 현재 캐시된 바이너리들의 전체 크기
+  unsigned long long useCounter;        // LRU 정렬에 사용할 단조증가 카운터
+  std::map<std::string, Entry> entries; // 캐시 키 -> 캐시 항목
+  std::string driverInfo;               // GL_VENDOR + GL_RENDERER + GL_VERSION
+  bool supported;                       // 프로그램 바이너리 지원 여부
+  bool indexDirty;                      // 인덱스 파일을 다시 저장해야 하는지 여부
+
+  // 캐시 키에 해당하는 바이너리 파일 경로
+  std::string entryPath(const std::string &key) const;
+
+  // 캐시 인덱스 파일 읽기 및 쓰기
+  void loadIndex();
+  void saveIndex();
+
+  // 캐시 항목 삭제
+  void remove(const std::string &key);
+
+  // 캐시 크기가 maxBytes 이하가 될 때까지 오래된 항목부터 삭제
+  void evict();
+};
+
+#endif // PROGRAM_CACHE_HPP
@@ -12,6 +12,13 @@
 #include <sstream>     // 문자열 스트림
 #include <iostream>    // 콘솔 입출력을 위한 헤더
 #include <glm/glm.hpp> // glm 라이브러리
+#include <map>         // std::map
+
+#include "gl/gl_handle.hpp"               // move-only OpenGL 오브젝트 핸들
+#include "shader/program_cache.hpp"       // 프로그램 바이너리 캐시
+#include "shader/shader_watcher.hpp"      // 쉐이더 핫 리로드
+#include "shader/shader_preprocessor.hpp" // #include 전처리기
+#include "shader/shader_reflection.hpp"   // 쉐이더 리플렉션 메타데이터
 
 /*
   Shader 클래스
@@ -23,21 +30,52 @@
 
   즉, 기존 쉐이더 관련 코드들을 별도의 클래스로 추출하는
   리팩토링을 했다고 보면 됨!
+
+  참고로, 쉐이더 프로그램 객체는 move-only 핸들(ProgramHandle)로 소유하기 때문에
+  Shader 객체도 복사는 불가능하고 이동만 가능함. (복사 후 두 객체가 같은 프로그램을 두 번 삭제하는 문제 방지)
 */
 class Shader
 {
 public:
-  unsigned int ID; // 생성된 ShaderProgram의 참조 ID
+  ProgramHandle ID; // 생성된 ShaderProgram의 핸들 (ID.get() 으로 참조 ID 를 얻음)
+
+  // Shader 클래스 생성자 (cache 가 주어지면 프로그램 바이너리 캐시를 먼저 조회함)
+  Shader(const GLchar *vertexPath, const GLchar *fragmentPath, ProgramCache *cache = nullptr);
 
-  // Shader 클래스 생성자
-  Shader(const GLchar *vertexPath, const GLchar *fragmentPath);
+  // 이미 링킹이 완료된 쉐이더 프로그램 객체의 소유권을 넘겨받는 생성자 (ShaderLibrary 등에서 사용)
+  // (핫 리로드를 사용하려면 소스 파일 경로도 함께 넘겨줘야 하고,
+  //  핫 리로드 시 같은 #define 블록을 다시 삽입할 수 있도록 defines 도 함께 넘겨줘야 함.
+  //  프로그램 바이너리 캐시에서 리플렉션 메타데이터를 함께 읽어왔다면 reflectionData 로 넘겨서 재조회를 건너뜀)
+  explicit Shader(unsigned int program, const std::string &vertexPath = "", const std::string &fragmentPath = "",
+                  const std::string &defines = "", const std::string &reflectionData = "");
 
   // Shader 클래스 소멸자
   ~Shader();
 
+  // 이동 생성 및 이동 대입 (복사는 금지)
+  Shader(Shader &&other);
+  Shader &operator=(Shader &&other);
+  Shader(const Shader &) = delete;
+  Shader &operator=(const Shader &) = delete;
+
   // ShaderProgram 객체 활성화
   void use();
 
+  // 쉐이더 소스 파일이 수정되면 자동으로 재컴파일하도록 ShaderWatcher 에 등록
+  void enableHotReload(ShaderWatcher &watcher);
+
+  // 유니폼 블록 이름에 고정 바인딩 포인트 지정 (이후 링킹되는 모든 쉐이더 프로그램에 적용됨)
+  static void setUniformBlockBinding(const std::string &blockName, unsigned int binding);
+
+  // 링킹 후 리플렉션으로 찾은 유니폼 블록 중에 blockName 이 있는지 여부
+  bool hasUniformBlock(const std::string &blockName) const;
+
+  // 링킹 시점에 조회한 입력 변수, 유니폼 변수, 유니폼 블록 메타데이터
+  const ShaderReflection &getReflection() const;
+
+  // 유니폼 변수 location 조회 (리플렉션 메타데이터를 사용하므로 대부분 드라이버 호출 없이 조회됨)
+  GLint getUniformLocation(const std::string &name) const;
+
   // 유니폼 변수 관련 유틸리티
   void setBool(const std::string &name, bool value) const;
   void setInt(const std::string &name, int value) const;
@@ -52,9 +90,59 @@ public:
   void setMat3(const std::string &name, const glm::mat3 &mat) const;
   void setMat4(const std::string &name, const glm::mat4 &mat) const;
 
+  // 배열 유니폼 변수 관련 유틸리티 (uniform mat4 bones[64]; 처럼 선언된 배열에 연속된 count 개의 값을 한 번에 전송)
+  void setIntArray(const std::string &name, const int *values, GLsizei count) const;
+  void setFloatArray(const std::string &name, const float *values, GLsizei count) const;
+  void setVec2Array(const std::string &name, const glm::vec2 *values, GLsizei count) const;
+  void setVec3Array(const std::string &name, const glm::vec3 *values, GLsizei count) const;
+  void setVec4Array(const std::string &name, const glm::vec4 *values, GLsizei count) const;
+  void setMat3Array(const std::string &name, const glm::mat3 *mats, GLsizei count) const;
+  void setMat4Array(const std::string &name, const glm::mat4 *mats, GLsizei count) const;
+
 private:
-  // 쉐이더 객체 및 쉐이더 프로그램 객체의 컴파일 및 링킹 에러 대응
-  void checkCompileErrors(unsigned int shader, std::string type);
+  // 쉐이더 컴파일 과정을 나눠서 처리하는 ShaderLibrary, ShaderWatcher, ShaderPipelineCache 에서도 아래 유틸리티들을 재사용함
+  friend class ShaderLibrary;
+  friend class ShaderWatcher;
+  friend class ShaderPipelineCache;
+
+  std::string vertexPath;   // 버텍스 쉐이더 소스 파일 경로
+  std::string fragmentPath; // 프래그먼트 쉐이더 소스 파일 경로
+  std::string defines;      // 쉐이더 코드의 #version 다음에 삽입된 #define 블록 (쉐이더 변형용)
+
+  ShaderReflection metadata; // 링킹 시점에 조회한 리플렉션 메타데이터
+
+  ShaderWatcher *watcher;      // 핫 리로드를 위해 등록된 ShaderWatcher (등록하지 않았다면 nullptr)
+  ShaderHandle reloadVertex;   // 재컴파일 중인 버텍스 쉐이더 객체
+  ShaderHandle reloadFragment; // 재컴파일 중인 프래그먼트 쉐이더 객체
+  ProgramHandle reloadProgram; // 재컴파일 중인 쉐이더 프로그램 객체 (완료되면 ID 와 교체됨)
+
+  // 새로운 쉐이더 코드로 재컴파일 시작
+  void beginReload(const std::string &vertexCode, const std::string &fragmentCode);
+
+  // 재컴파일이 끝났다면 결과 처리 후 true 반환 (성공 시 replaced 가 true 가 되며, 실패 시 기존 프로그램 유지)
+  bool finishReload(bool &replaced);
+
+  // 재컴파일 중인 쉐이더 객체 및 프로그램 객체 메모리 반납
+  void discardReload();
+
+  // 리플렉션 메타데이터를 복원하거나(reflectionData 가 주어진 경우) 새로 조회한 뒤, 유니폼 블록 바인딩
+  void initReflection(const std::string &reflectionData);
+
+  // 리플렉션으로 찾은 유니폼 블록들을 지정된 바인딩 포인트에 연결
+  void bindUniformBlocks();
+  static void bindUniformBlocks(unsigned int program, const ShaderReflection &reflection, const std::string &label);
+
+  // 유니폼 블록 이름 -> 고정 바인딩 포인트
+  static std::map<std::string, unsigned int> &uniformBlockBindings();
+
+  // 다른 Shader 객체에서 이동해 온 경우, 핫 리로드 등록을 새로운 주소로 옮김
+  void takeOverHotReload(Shader &other);
+
+  // 쉐이더 파일을 읽고 #include 를 펼친 뒤 #define 블록을 삽입한 코드를 std::string 타입으로 반환
+  static std::string loadShaderSource(const GLchar *path, const std::string &defines = "");
+
+  // 쉐이더 객체 및 쉐이더 프로그램 객체의 컴파일 및 링킹 에러 대응 (성공 여부 반환)
+  static bool checkCompileErrors(unsigned int shader, std::string type);
 };
 
 #endif // SHADER_HPP
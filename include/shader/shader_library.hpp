@@ -0,0 +1,102 @@
+#ifndef SHADER_LIBRARY_HPP
+#define SHADER_LIBRARY_HPP
+
+#include <glad/glad.h> // OpenGL 함수를 초기화하기 위한 헤더
+#include <string>      // std::string
+#include <vector>      // std::vector
+#include <memory>      // std::shared_ptr, std::unique_ptr
+
+#include "shader/shader.hpp"        // Shader 클래스
+#include "shader/program_cache.hpp" // 프로그램 바이너리 캐시
+
+/*
+  ShaderFuture 클래스
+
+  ShaderLibrary::submit() 으로 제출한 쉐이더 프로그램의 컴파일 결과를
+  나중에 받아볼 수 있도록 해주는 핸들.
+
+  컴파일 및 링킹이 끝나기 전까지 get() 은 nullptr 을 반환하며,
+  ready() 가 true 가 된 이후부터 Shader 객체를 사용할 수 있음.
+*/
+class ShaderFuture
+{
+public:
+  ShaderFuture();
+
+  // 컴파일 및 링킹이 성공적으로 완료되었는지 여부
+  bool ready() const;
+
+  // 컴파일 또는 링킹에 실패했는지 여부
+  bool failed() const;
+
+  // 완료된 Shader 객체 반환 (아직 완료되지 않았거나 실패했다면 nullptr)
+  Shader *get() const;
+
+private:
+  friend class ShaderLibrary;
+
+  // 쉐이더 프로그램 하나의 컴파일 진행 상태
+  struct Request;
+
+  std::shared_ptr<Request> request;
+};
+
+/*
+  ShaderLibrary 클래스
+
+  여러 개의 쉐이더 프로그램을 한꺼번에 제출받아,
+  렌더링 루프를 막지 않고 컴파일 및 링킹을 진행하는 클래스!
+
+  Shader 생성자는 glCompileShader() 직후 checkCompileErrors() 로 컴파일 상태를 조회하기 때문에
+  드라이버가 그 자리에서 컴파일을 끝마칠 때까지 메인 스레드가 멈추게 됨.
+
+  GL_KHR_parallel_shader_compile 확장을 지원하는 드라이버에서는
+  모든 쉐이더를 한꺼번에 컴파일 및 링킹 요청해두고, 매 프레임마다 GL_COMPLETION_STATUS_KHR 만
+  조회하여(= 블로킹 없음) 완료된 프로그램부터 차례대로 넘겨줌.
+
+  확장을 지원하지 않는 드라이버에서는, 남은 컴파일 작업들을
+  '버텍스 컴파일 -> 프래그먼트 컴파일 -> 링킹' 단계로 잘게 쪼개서
+  프레임마다 주어진 시간 예산(ms) 안에서만 처리하는 time-slicing 방식으로 대체함.
+*/
+class ShaderLibrary
+{
+public:
+  // ShaderLibrary 클래스 생성자 (GLAD 초기화 이후에 생성해야 함)
+  explicit ShaderLibrary(ProgramCache *cache = nullptr);
+
+  // ShaderLibrary 클래스 소멸자
+  ~ShaderLibrary();
+
+  // 쉐이더 프로그램 컴파일 요청 (defines 는 두 쉐이더의 #version 다음에 삽입할 #define 블록)
+  ShaderFuture submit(const std::string &vertexPath, const std::string &fragmentPath, const std::string &defines = "");
+
+  // 매 프레임마다 호출하여 컴파일 진행 상태 갱신 (budgetMs 는 병렬 컴파일 미지원 시의 프레임당 시간 예산)
+  void update(double budgetMs);
+
+  // 아직 완료되지 않은 모든 요청이 끝날 때까지 대기 (로딩 화면 등에서 사용)
+  void finish();
+
+  // 아직 완료되지 않은 요청 개수
+  size_t pendingCount() const;
+
+  // GL_KHR_parallel_shader_compile 을 사용한 병렬 컴파일 여부
+  bool isParallel() const;
+
+private:
+  ProgramCache *cache; // 프로그램 바이너리 캐시 (nullptr 이면 사용 안 함)
+  bool parallel;       // 병렬 컴파일 지원 여부
+
+  // 완료되지 않은 요청 목록 (제출 순서 유지)
+  std::vector<std::shared_ptr<ShaderFuture::Request> > pending;
+
+  // 병렬 컴파일 모드에서 컴파일 및 링킹이 완료되었는지 조회 (블로킹 없음)
+  bool isComplete(const ShaderFuture::Request &request) const;
+
+  // time-slicing 모드에서 요청의 다음 단계 하나를 처리
+  void step(ShaderFuture::Request &request);
+
+  // 링킹이 끝난 요청의 에러 확인 및 Shader 객체 생성
+  void finalize(ShaderFuture::Request &request);
+};
+
+#endif // SHADER_LIBRARY_HPP
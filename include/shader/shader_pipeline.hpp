@@ -0,0 +1,87 @@
+#ifndef SHADER_PIPELINE_HPP
+#define SHADER_PIPELINE_HPP
+
+#include <glad/glad.h> // OpenGL 함수를 초기화하기 위한 헤더
+#include <string>      // std::string
+#include <map>         // std::map
+#include <memory>      // std::unique_ptr
+#include <utility>     // std::pair
+
+#include "gl/gl_handle.hpp"             // ProgramHandle, ProgramPipelineHandle
+#include "shader/shader_reflection.hpp" // 쉐이더 리플렉션 메타데이터
+
+/*
+  ShaderStage 클래스
+
+  glCreateShaderProgramv() 로 쉐이더 스테이지 하나(버텍스 또는 프래그먼트)만 컴파일 및 링킹한
+  분리형(separable) 쉐이더 프로그램.
+
+  일반적인 쉐이더 프로그램과 달리 다른 스테이지와 미리 링킹되지 않으므로,
+  ShaderPipelineCache 를 통해 프로그램 파이프라인 객체에서 다른 스테이지와 조합해서 사용함.
+*/
+class ShaderStage
+{
+public:
+  ProgramHandle ID; // 분리형 쉐이더 프로그램의 핸들
+
+  // 쉐이더 스테이지 타입 (GL_VERTEX_SHADER, GL_FRAGMENT_SHADER)
+  GLenum getType() const;
+
+  // 링킹 시점에 조회한 리플렉션 메타데이터
+  const ShaderReflection &getReflection() const;
+
+  // 유니폼 변수 location 조회 (값은 glProgramUniform*() 으로 바인딩 여부와 상관없이 전송할 수 있음)
+  GLint getUniformLocation(const std::string &name) const;
+
+private:
+  friend class ShaderPipelineCache;
+
+  GLenum type;
+  ShaderReflection metadata;
+};
+
+/*
+  ShaderPipelineCache 클래스
+
+  분리형 쉐이더 오브젝트(GL_ARB_separate_shader_objects, OpenGL 4.1 core) 를 사용해서
+  쉐이더 스테이지들을 각각 한 번씩만 컴파일하고, 스테이지 조합은 프로그램 파이프라인 객체로 만드는 클래스!
+
+  버텍스 쉐이더 N 개와 프래그먼트 쉐이더 M 개를 조합해서 사용하는 경우,
+  Shader 클래스로는 조합마다 프로그램을 링킹해야 하므로 N x M 번의 링킹이 필요하지만,
+  분리형 쉐이더 오브젝트를 사용하면 스테이지별로 N + M 번만 링킹하고
+  조합은 링킹 비용이 없는 glUseProgramStages() 로 만들 수 있음.
+
+  - 스테이지는 (타입, 경로, #define 블록) 으로, 파이프라인은 (버텍스, 프래그먼트) 스테이지 쌍으로 캐싱됨
+  - #version 330 쉐이더도 그대로 사용할 수 있도록, 컴파일 시 #extension GL_ARB_separate_shader_objects 를 삽입함
+  - 파이프라인을 바인딩할 때에는 glUseProgram(0) 으로 일반 프로그램 바인딩을 해제함
+    (일반 프로그램이 바인딩되어 있으면 파이프라인보다 우선 적용되기 때문)
+*/
+class ShaderPipelineCache
+{
+public:
+  // ShaderPipelineCache 클래스 생성자
+  ShaderPipelineCache();
+
+  // 현재 컨텍스트에서 분리형 쉐이더 오브젝트를 사용할 수 있는지 여부
+  bool isSupported() const;
+
+  // 쉐이더 스테이지 반환 (처음 요청된 스테이지라면 이때 컴파일함. 실패 시 nullptr)
+  const ShaderStage *getStage(GLenum type, const std::string &path, const std::string &defines = "");
+
+  // 두 스테이지를 조합한 프로그램 파이프라인 객체 반환 (처음 요청된 조합이라면 이때 생성함)
+  GLuint getPipeline(const ShaderStage *vertex, const ShaderStage *fragment);
+
+  // 두 스테이지를 조합한 프로그램 파이프라인 바인딩
+  void bind(const ShaderStage *vertex, const ShaderStage *fragment);
+
+  // 캐시된 스테이지 및 파이프라인 개수
+  size_t stageCount() const;
+  size_t pipelineCount() const;
+
+private:
+  bool supported;
+  std::map<std::string, std::unique_ptr<ShaderStage>> stages;             // "타입:경로:defines" -> 스테이지
+  std::map<std::pair<GLuint, GLuint>, ProgramPipelineHandle> pipelines; // (버텍스, 프래그먼트) 프로그램 -> 파이프라인
+};
+
+#endif // SHADER_PIPELINE_HPP
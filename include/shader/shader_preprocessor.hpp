@@ -0,0 +1,116 @@
+#ifndef SHADER_PREPROCESSOR_HPP
+#define SHADER_PREPROCESSOR_HPP
+
+#include <string>  // std::string
+#include <vector>  // std::vector
+#include <map>     // std::map
+#include <set>     // std::set
+#include <mutex>   // std::mutex
+#include <thread>  // std::thread
+#include <cstdint> // uint64_t
+
+/*
+  ShaderPreprocessor 클래스
+
+  GLSL 자체는 #include 를 지원하지 않기 때문에, 드라이버에 쉐이더 코드를 넘겨주기 전에
+  #include "..." 지시문을 실제 파일 내용으로 펼쳐주는 전처리 단계를 담당하는 클래스!
+
+  - #include 경로는 '포함하는 파일의 디렉토리' -> '등록된 검색 경로' 순서로 찾음
+  - 헤더 파일의 중복 포함은 C/C++ 헤더처럼 include guard (#ifndef ~ #endif) 로 막으면 됨
+    (GLSL 전처리기가 직접 처리하므로, 펼쳐진 결과가 포함 순서에 의존하지 않아 캐싱하기 쉬움)
+  - 파일마다 고유한 번호를 붙여서 #line <라인> <파일번호> 지시문을 삽입하므로,
+    드라이버가 출력하는 컴파일 에러의 위치를 annotateLog() 로 원래 파일 경로와 라인으로 되돌릴 수 있음
+  - 파일 간의 포함 관계(의존성 그래프)를 기록해두므로,
+    공통 헤더가 수정되었을 때 어떤 쉐이더를 다시 컴파일해야 하는지 알 수 있음
+
+  또한, 각 파일의 원본 코드와 #include 를 펼친 결과를 '내용 해시' 기준으로 캐싱하기 때문에,
+  여러 쉐이더가 공유하는 헤더 파일은 프로세스 전체에서 한 번만 읽고 한 번만 펼쳐짐.
+  (여러 쉐이더가 캐시를 공유할 수 있도록 shared() 로 프로세스 전역 인스턴스를 사용함)
+
+  씬에서 사용할 쉐이더 파일 목록을 미리 알고 있다면 prefetch() 로 별도의 I/O 스레드에서 파일들을 미리 읽어둘 수 있음.
+  이후 GL 스레드에서 process() 를 호출하면 디스크 I/O 없이 캐시된 원본 코드를 곧바로 펼치기만 함.
+*/
+class ShaderPreprocessor
+{
+public:
+  // 프로세스 전역에서 공유하는 인스턴스
+  static ShaderPreprocessor &shared();
+
+  ShaderPreprocessor();
+
+  // 진행 중인 prefetch 가 있다면 끝날 때까지 대기
+  ~ShaderPreprocessor();
+
+  // #include 검색 경로 추가
+  void addSearchPath(const std::string &path);
+
+  // 쉐이더 파일을 읽어서 #include 를 모두 펼친 코드 반환 (실패 시 빈 문자열)
+  std::string process(const std::string &path);
+
+  // paths 의 쉐이더 파일들과 그 파일들이 포함하는 파일들을 I/O 스레드에서 미리 읽어둠 (곧바로 반환)
+  void prefetch(const std::vector<std::string> &paths);
+
+  // 진행 중인 prefetch 가 끝날 때까지 대기
+  void waitPrefetch();
+
+  // path 가 직간접적으로 포함하는 모든 파일 경로 (path 자신 포함)
+  std::vector<std::string> dependencies(const std::string &path);
+
+  // 파일이 수정되었을 때 해당 파일의 캐시를 무효화
+  void invalidate(const std::string &path);
+
+  // 드라이버의 컴파일 에러 로그에 포함된 '파일번호:라인' 을 '파일경로:라인' 으로 변환
+  std::string annotateLog(const std::string &log);
+
+  // 전처리된 코드의 #version 바로 다음 줄에 #define 블록 삽입 (쉐이더 변형(variant) 생성에 사용)
+  static std::string injectDefines(const std::string &code, const std::string &defines);
+
+  // 주석, 불필요한 공백 및 #line 지시문을 제거한 코드 반환 (빌드 시점에 쉐이더를 미리 가공해 둘 때 사용)
+  static std::string minify(const std::string &code);
+
+  // 경로의 './' 와 'dir/../' 를 정리하여 같은 파일이 항상 같은 경로 문자열을 갖도록 함
+  static std::string normalizePath(const std::string &path);
+
+private:
+  // 파일 하나의 캐시 정보
+  struct File
+  {
+    int id;                            // #line 지시문에 사용할 파일 번호
+    bool loaded;                       // 원본 코드를 읽어두었는지 여부
+    std::string code;                  // 원본 코드
+    uint64_t contentHash;              // 원본 코드의 해시
+    std::vector<std::string> includes; // 직접 포함하는 파일 경로들 (의존성 그래프의 간선, 찾지 못한 파일은 빈 문자열)
+    bool expanded[2];                  // 이 파일을 펼친 결과가 expansions 에 있는지 여부 (포함된 파일, 최상위 파일 순서)
+    uint64_t expansionKeys[2];         // 그 결과의 expansions 키 (내용이 바뀌어 새로 펼치면 이전 결과는 지움)
+  };
+
+  std::mutex mutex;                           // 여러 스레드(쉐이더 감시 스레드 등)에서 접근하므로 보호
+  std::vector<std::string> searchPaths;       // #include 검색 경로
+  std::map<std::string, File> files;          // 파일 경로 -> 캐시 정보
+  std::vector<std::string> fileNames;         // 파일 번호 -> 파일 경로
+  std::map<uint64_t, std::string> expansions; // (파일 내용 + 포함된 파일들의 펼쳐진 내용) 해시 -> 펼쳐진 코드
+  std::thread prefetcher;                     // prefetch() 로 시작된 I/O 스레드
+
+  // 파일 캐시 정보 조회 (없으면 파일을 읽고 #include 지시문을 분석하여 생성)
+  File *load(const std::string &path);
+
+  // 파일 캐시 항목 조회 (처음 보는 파일이라면 새로운 파일 번호를 발급해서 생성)
+  File &entry(const std::string &path);
+
+  // 읽어들인 원본 코드의 해시 계산 및 #include 지시문 분석 후 loaded 로 표시
+  void parse(File &file, const std::string &path);
+
+  // I/O 스레드에서 실행할 prefetch 루프
+  void runPrefetch(std::vector<std::string> paths);
+
+  // #include 로 지정된 파일의 실제 경로 탐색
+  std::string resolve(const std::string &includer, const std::string &name) const;
+
+  // #include 를 재귀적으로 펼침 (hash 에는 펼쳐진 결과를 식별하는 해시가 저장됨)
+  bool expand(const std::string &path, std::vector<std::string> &stack, bool isRoot, std::string &out, uint64_t &hash);
+
+  // 의존성 그래프를 따라 path 가 포함하는 파일들을 수집
+  void collect(const std::string &path, std::set<std::string> &visited, std::vector<std::string> &out);
+};
+
+#endif // SHADER_PREPROCESSOR_HPP
@@ -0,0 +1,87 @@
+#ifndef SHADER_REFLECTION_HPP
+#define SHADER_REFLECTION_HPP
+
+#include <glad/glad.h> // OpenGL 함수를 초기화하기 위한 헤더
+#include <string>      // std::string
+#include <vector>      // std::vector
+
+#include "gl/vertex_layout.hpp" // VertexLayout
+
+// 쉐이더 프로그램의 입력 변수(attribute) 정보
+struct ShaderAttribute
+{
+  std::string name;
+  GLint location; // 버텍스 속성 번호 (gl_VertexID 같은 내장 변수는 -1)
+  GLenum type;    // GL_FLOAT_VEC3 등
+  GLint size;     // 배열 크기 (배열이 아니면 1)
+};
+
+// 쉐이더 프로그램의 유니폼 변수 정보
+struct ShaderUniform
+{
+  std::string name;
+  GLint location;    // 유니폼 location (유니폼 블록 멤버는 -1)
+  GLenum type;       // GL_FLOAT_MAT4 등
+  GLint size;        // 배열 크기 (배열이 아니면 1)
+  GLint blockIndex;  // 속한 유니폼 블록 번호 (기본 블록이면 -1)
+  GLint blockOffset; // 유니폼 블록 내 바이트 오프셋 (기본 블록이면 -1)
+};
+
+// 쉐이더 프로그램의 유니폼 블록 정보
+struct ShaderUniformBlock
+{
+  std::string name;
+  GLuint index;   // 유니폼 블록 번호 (glUniformBlockBinding() 에 사용)
+  GLint dataSize; // 블록 전체 크기 (바이트)
+};
+
+/*
+  ShaderReflection 클래스
+
+  링킹이 완료된 쉐이더 프로그램에서 실제로 사용되는(active) 입력 변수, 유니폼 변수, 유니폼 블록 정보를
+  한 번만 조회해서 이름순으로 정렬해 둔 읽기 전용 메타데이터!
+
+  - reflect() 로 생성된 이후에는 내용을 바꿀 수 없으며, find*() 는 이진 탐색으로 조회함
+  - validate() 로 VAO 설정(VertexLayout)과 버텍스 쉐이더의 입력 변수가 일치하는지 미리 확인할 수 있음
+    (불일치 시 드라이버 에러나 조용한 성능 저하로 나타나기 전에 콘솔에 바로 알려줌)
+  - serialize() / deserialize() 로 텍스트 형태로 변환하여 프로그램 바이너리 캐시에 함께 저장할 수 있음
+    (캐시된 바이너리를 로드할 때 glGetActive* 조회를 다시 하지 않아도 됨)
+*/
+class ShaderReflection
+{
+public:
+  // 빈 메타데이터
+  ShaderReflection();
+
+  // 링킹이 완료된 program 에서 메타데이터 조회
+  static ShaderReflection reflect(GLuint program);
+
+  // serialize() 로 만든 문자열에서 메타데이터 복원 (형식이 맞지 않으면 false 반환)
+  static bool deserialize(const std::string &data, ShaderReflection &reflection);
+
+  // 메타데이터를 텍스트 형태로 변환
+  std::string serialize() const;
+
+  // 이름으로 조회 (없으면 nullptr)
+  const ShaderAttribute *findAttribute(const std::string &name) const;
+  const ShaderUniform *findUniform(const std::string &name) const;
+  const ShaderUniformBlock *findUniformBlock(const std::string &name) const;
+
+  // 전체 목록 (이름순 정렬)
+  const std::vector<ShaderAttribute> &getAttributes() const;
+  const std::vector<ShaderUniform> &getUniforms() const;
+  const std::vector<ShaderUniformBlock> &getUniformBlocks() const;
+
+  // 버텍스 쉐이더의 입력 변수들이 layout 과 일치하는지 확인 (불일치 항목은 label 과 함께 콘솔에 출력)
+  bool validate(const VertexLayout &layout, const std::string &label) const;
+
+private:
+  std::vector<ShaderAttribute> attributes;
+  std::vector<ShaderUniform> uniforms;
+  std::vector<ShaderUniformBlock> uniformBlocks;
+
+  // 각 목록을 이름순으로 정렬
+  void sort();
+};
+
+#endif // SHADER_REFLECTION_HPP
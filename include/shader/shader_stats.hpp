@@ -0,0 +1,71 @@
+#ifndef SHADER_STATS_HPP
+#define SHADER_STATS_HPP
+
+#include <string> // std::string
+#include <vector> // std::vector
+
+/*
+  ShaderTiming 구조체
+
+  쉐이더 프로그램 하나를 만드는 데 걸린 시간 측정 결과 (단위는 모두 ms)
+
+  - readMs      : 쉐이더 파일 읽기 및 #include 펼치기
+  - vertexMs    : 버텍스 쉐이더 glCompileShader() 호출
+  - fragmentMs  : 프래그먼트 쉐이더 glCompileShader() 호출
+  - linkMs      : glLinkProgram() 호출 (바이너리 캐시 적중 시에는 캐시 파일 읽기 및 glProgramBinary() 호출)
+  - completionMs: 첫 glCompileShader() 호출부터 링킹 결과를 얻을 때까지 걸린 시간
+                  (GL_KHR_parallel_shader_compile 을 지원하는 드라이버는 위의 호출들이 곧바로 반환되고
+                   실제 컴파일은 드라이버의 컴파일러 스레드에서 진행되므로, 이 값이 실제 컴파일 비용에 가까움.
+                   측정하지 않았다면 음수)
+*/
+struct ShaderTiming
+{
+  std::string vertexPath;
+  std::string fragmentPath;
+  std::string defines;
+  size_t sourceBytes; // #include 를 펼친 두 쉐이더 코드의 크기 합
+  bool cached;        // 프로그램 바이너리 캐시 적중 여부
+  double readMs;
+  double vertexMs;
+  double fragmentMs;
+  double linkMs;
+  double completionMs;
+
+  ShaderTiming();
+
+  // 컴파일 비용 (호출 시간의 합과 완료까지 걸린 시간 중 큰 값)
+  double compileMs() const;
+};
+
+/*
+  ShaderStats 클래스
+
+  어떤 쉐이더 프로그램이 컴파일하기 비싼지 알 수 있도록,
+  Shader 생성자와 ShaderLibrary 가 측정한 쉐이더 프로그램별 시간을 모아두는 클래스!
+
+  report() 를 호출하면 컴파일 비용이 큰 순서대로 정렬한 표를 콘솔에 출력함.
+  (Shader 객체를 만드는 GL 스레드에서만 사용하므로 별도의 동기화는 하지 않음)
+*/
+class ShaderStats
+{
+public:
+  // 프로세스 전역에서 공유하는 인스턴스
+  static ShaderStats &shared();
+
+  // 쉐이더 프로그램 하나의 측정 결과 기록
+  void record(const ShaderTiming &timing);
+
+  // 지금까지 기록된 측정 결과
+  const std::vector<ShaderTiming> &getTimings() const;
+
+  // 컴파일 비용이 큰 순서대로 maxRows 개(0 이면 전부)의 측정 결과를 콘솔에 출력
+  void report(size_t maxRows = 0) const;
+
+  // 기록된 측정 결과 모두 삭제
+  void clear();
+
+private:
+  std::vector<ShaderTiming> timings;
+};
+
+#endif // SHADER_STATS_HPP
@@ -0,0 +1,61 @@
+#ifndef SHADER_VARIANTS_HPP
+#define SHADER_VARIANTS_HPP
+
+#include <string> // std::string
+#include <vector> // std::vector
+#include <list>   // std::list
+#include <map>    // std::map
+
+#include "shader/shader_library.hpp" // ShaderLibrary, ShaderFuture
+
+/*
+  ShaderVariants 클래스
+
+  하나의 기본 쉐이더 코드에 서로 다른 #define 조합을 삽입하여 만든
+  쉐이더 변형(variant, permutation)들을 관리하는 클래스!
+
+  ex> debugging.fs 를 '텍스쳐 사용 여부', '알파 테스트 여부' 에 따라 4가지로 나눠 쓰고 싶을 때,
+      파일을 4개 만들어서 직접 관리하는 대신, #ifdef USE_TEXTURE ~ #endif 처럼 작성해두고
+      필요한 #define 조합만 비트마스크로 요청하면 됨.
+
+  - 생성자에 넘겨준 define 이름 목록의 i번째 이름은 비트마스크의 i번째 비트에 대응됨
+  - 각 변형은 get() 으로 처음 요청될 때에만 ShaderLibrary 에 컴파일을 요청하므로,
+    실제로 사용하는 변형만 컴파일됨 (컴파일은 ShaderLibrary 를 통해 렌더링 루프를 막지 않고 진행됨)
+  - 캐시된 변형 개수가 maxVariants 를 넘어서면, 가장 오랫동안 요청되지 않은 변형부터 제거함 (LRU)
+    (이미 받아간 ShaderFuture 가 남아있다면, 그 핸들이 모두 사라질 때까지 Shader 객체는 유지됨)
+*/
+class ShaderVariants
+{
+public:
+  // ShaderVariants 클래스 생성자
+  ShaderVariants(ShaderLibrary &library, const std::string &vertexPath, const std::string &fragmentPath,
+                 const std::vector<std::string> &defineNames, size_t maxVariants = 16);
+
+  // mask 에 해당하는 쉐이더 변형 반환 (처음 요청된 변형이라면 이때 컴파일을 요청함)
+  ShaderFuture get(unsigned int mask);
+
+  // 현재 캐시된 변형 개수
+  size_t size() const;
+
+  // mask 에 해당하는 #define 블록 생성
+  std::string makeDefines(unsigned int mask) const;
+
+private:
+  // 캐시된 변형 하나
+  struct Variant
+  {
+    ShaderFuture future;                      // 컴파일 결과
+    std::list<unsigned int>::iterator lruPos; // LRU 목록에서의 위치
+  };
+
+  ShaderLibrary &library;               // 컴파일을 요청할 쉐이더 라이브러리
+  std::string vertexPath;               // 기본 버텍스 쉐이더 경로
+  std::string fragmentPath;             // 기본 프래그먼트 쉐이더 경로
+  std::vector<std::string> defineNames; // 비트 번호 -> define 이름
+  size_t maxVariants;                   // 최대 캐시 개수
+
+  std::map<unsigned int, Variant> variants; // 비트마스크 -> 쉐이더 변형
+  std::list<unsigned int> lru;              // 최근에 요청된 순서 (앞쪽이 가장 최근)
+};
+
+#endif // SHADER_VARIANTS_HPP
@@ -0,0 +1,94 @@
+#ifndef SHADER_WATCHER_HPP
+#define SHADER_WATCHER_HPP
+
+#include <string>  // std::string
+#include <vector>  // std::vector
+#include <map>     // std::map
+#include <set>     // std::set
+#include <mutex>   // std::mutex
+#include <thread>  // std::thread
+#include <atomic>  // std::atomic
+
+class Shader;
+
+/*
+  ShaderWatcher 클래스
+
+  쉐이더 소스 파일이 수정되면 해당 Shader 객체를 다시 컴파일해서
+  앱을 재시작하지 않고도 수정된 쉐이더를 바로 확인할 수 있게 해주는 핫 리로드 관리 클래스!
+
+  리눅스에서는 inotify 로 쉐이더 파일이 들어있는 디렉토리를 감시하는 별도의 스레드를 띄우고,
+  파일이 수정되면 그 스레드에서 새로운 쉐이더 코드를 미리 읽어둔 뒤 플래그만 세워둠.
+  (에디터들이 파일을 '임시 파일 작성 후 rename' 방식으로 저장하는 경우가 많아서,
+  파일 자체가 아니라 디렉토리를 감시해야 수정 사항을 놓치지 않음.)
+
+  렌더링 루프에서는 매 프레임 경계마다 poll() 을 호출하는데,
+  아무 파일도 바뀌지 않았다면 atomic 플래그 하나만 확인하고 곧바로 반환하므로
+  프레임당 추가 비용이 사실상 없음.
+
+  리눅스가 아닌 플랫폼에서는 isSupported() 가 false 를 반환하며 아무 동작도 하지 않음.
+*/
+class ShaderWatcher
+{
+public:
+  // ShaderWatcher 클래스 생성자 (감시 스레드 시작)
+  ShaderWatcher();
+
+  // ShaderWatcher 클래스 소멸자 (감시 스레드 종료)
+  ~ShaderWatcher();
+
+  // 현재 플랫폼에서 파일 감시를 지원하는지 여부
+  bool isSupported() const;
+
+  // 프레임 경계에서 호출하여, 수정된 쉐이더들의 재컴파일 요청 및 완료된 프로그램 교체
+  // (하나라도 새로운 프로그램으로 교체되었다면 true 반환 -> uniform 변수들을 다시 전송해야 함)
+  bool poll();
+
+private:
+  // Shader 클래스에서만 감시 등록 및 해제를 요청함
+  friend class Shader;
+
+  // Shader 객체의 소스 파일 경로들을 감시 대상으로 등록 (defines 는 다시 읽을 때 삽입할 쉐이더 변형의 #define 블록)
+  void add(Shader *shader, const std::string &vertexPath, const std::string &fragmentPath, const std::string &defines);
+
+  // Shader 객체를 감시 대상에서 제거 (Shader 소멸자에서 호출)
+  void remove(Shader *shader);
+
+  // 감시 스레드에서 실행할 루프
+  void run();
+
+  // 감시 스레드에서 파일 변경이 감지되었을 때, 해당 파일을 사용하는 Shader 객체들의 소스코드를 다시 읽어둠
+  void onFileChanged(const std::string &path);
+
+  // 감시 중인 Shader 객체의 소스 파일 경로
+  struct Sources
+  {
+    std::string vertexPath;
+    std::string fragmentPath;
+    std::string defines;         // 등록 시점에 복사해둔 #define 블록 (감시 스레드는 Shader 객체의 멤버를 읽지 않음)
+    std::set<std::string> files; // #include 로 포함된 파일들까지 포함한 전체 의존 파일 목록
+  };
+
+  // 감시 스레드에서 미리 읽어둔 새로운 쉐이더 코드
+  struct Code
+  {
+    std::string vertexCode;
+    std::string fragmentCode;
+  };
+
+  // Sources 의 의존 파일 목록을 갱신하고, 해당 파일들이 있는 디렉토리를 감시 대상으로 추가 (mutex 를 잠근 상태에서 호출)
+  void watchDependencies(Sources &sources);
+
+  int inotifyFd;  // inotify 인스턴스의 파일 디스크립터
+  int wakeFd[2];  // 감시 스레드를 깨워서 종료시키기 위한 파이프
+  std::thread thread;
+
+  std::mutex mutex;                            // 아래 컨테이너들을 보호하는 뮤텍스
+  std::map<int, std::string> directories;      // inotify watch descriptor -> 감시 중인 디렉토리 경로
+  std::map<Shader *, Sources> shaders;         // 감시 중인 Shader 객체 -> 소스 파일 경로
+  std::map<Shader *, Code> changed;            // 파일이 수정된 Shader 객체 -> 새로운 쉐이더 코드
+  std::set<Shader *> reloading;                // 재컴파일이 진행중인 Shader 객체 (메인 스레드 전용)
+  std::atomic<bool> hasChanges;                // changed 가 비어있지 않은지 여부 (poll() 의 빠른 경로용)
+};
+
+#endif // SHADER_WATCHER_HPP
@@ -0,0 +1,89 @@
+#ifndef UNIFORM_BATCH_HPP
+#define UNIFORM_BATCH_HPP
+
+#include <glad/glad.h> // OpenGL 함수를 초기화하기 위한 헤더
+#include <glm/glm.hpp> // glm 라이브러리
+#include <string>      // std::string
+#include <vector>      // std::vector
+#include <map>         // std::map
+
+class Shader;
+
+/*
+  UniformBatch 클래스
+
+  기본 블록(default block) 유니폼 변수 값들을 모아두었다가,
+  draw call 직전에 flush() 로 바뀐 값들만 한꺼번에 전송하는 클래스!
+
+  - set*() 은 GL 함수를 호출하지 않고 값을 내부 버퍼에 복사해두기만 함
+  - 마지막으로 전송한 값의 사본(shadow copy) 과 memcmp 로 비교해서,
+    값이 바뀌지 않았다면 dirty 로 표시하지 않으므로 flush() 에서 전송하지 않음
+  - flush() 에 이전과 다른 쉐이더 프로그램이 주어지면 (다른 쉐이더 변형이거나 핫 리로드로 교체된 경우)
+    location 을 다시 조회하고 모든 값을 다시 전송함
+*/
+class UniformBatch
+{
+public:
+  // UniformBatch 클래스 생성자
+  UniformBatch();
+
+  // 값 설정 (실제 전송은 flush() 에서 이루어짐)
+  void setInt(const std::string &name, int value);
+  void setFloat(const std::string &name, float value);
+  void setVec2(const std::string &name, const glm::vec2 &value);
+  void setVec3(const std::string &name, const glm::vec3 &value);
+  void setVec4(const std::string &name, const glm::vec4 &value);
+  void setMat3(const std::string &name, const glm::mat3 &mat);
+  void setMat4(const std::string &name, const glm::mat4 &mat);
+
+  // 배열 값 설정
+  void setIntArray(const std::string &name, const int *values, GLsizei count);
+  void setFloatArray(const std::string &name, const float *values, GLsizei count);
+  void setVec4Array(const std::string &name, const glm::vec4 *values, GLsizei count);
+  void setMat4Array(const std::string &name, const glm::mat4 *mats, GLsizei count);
+
+  // 바뀐 값들을 shader 에 전송 (shader 가 바인딩(use())된 상태에서 호출해야 함. 전송한 유니폼 개수 반환)
+  size_t flush(const Shader &shader);
+
+private:
+  // 유니폼 값의 GLSL 타입
+  enum Kind
+  {
+    KIND_INT,
+    KIND_FLOAT,
+    KIND_VEC2,
+    KIND_VEC3,
+    KIND_VEC4,
+    KIND_MAT3,
+    KIND_MAT4
+  };
+
+  // 유니폼 변수 하나의 상태
+  struct Slot
+  {
+    std::string name;
+    Kind kind;
+    GLint location; // 현재 쉐이더 프로그램에서의 location
+    bool resolved;  // location 을 현재 쉐이더 프로그램에서 조회했는지 여부
+    GLsizei count;  // 배열 원소 개수
+    size_t offset;  // values / shadow 버퍼 내 시작 위치
+    size_t size;    // 값 전체 크기 (바이트)
+    bool uploaded;  // shadow 에 현재 쉐이더 프로그램에 전송된 값이 들어있는지 여부
+    bool dirty;     // 다음 flush() 에서 전송해야 하는지 여부
+  };
+
+  std::map<std::string, size_t> slotIndices; // 유니폼 이름 -> slots 인덱스
+  std::vector<Slot> slots;
+  std::vector<size_t> dirtySlots;     // 다음 flush() 에서 전송할 slots 인덱스 목록
+  std::vector<unsigned char> values;  // set*() 으로 설정된 값
+  std::vector<unsigned char> shadow;  // 마지막으로 전송한 값
+  unsigned int program;               // 마지막으로 flush() 한 쉐이더 프로그램
+
+  // 값을 내부 버퍼에 복사하고, 마지막으로 전송한 값과 다르면 dirty 로 표시
+  void stage(const std::string &name, Kind kind, const void *data, GLsizei count, size_t elementSize);
+
+  // Slot 하나를 현재 바인딩된 쉐이더 프로그램에 전송
+  void upload(const Slot &slot) const;
+};
+
+#endif // UNIFORM_BATCH_HPP
@@ -0,0 +1,56 @@
+#ifndef UNIFORM_BLOCKS_HPP
+#define UNIFORM_BLOCKS_HPP
+
+#include <glm/glm.hpp> // glm 라이브러리
+
+/*
+  resources/shaders/uniform_blocks.glsl, material_blocks.glsl 에 선언된 유니폼 블록들과
+  같은 메모리 배치를 갖는 C++ 구조체 및 고정 바인딩 포인트 정의
+
+  std140 레이아웃 규칙에 따라 mat4 는 vec4 4개(64 바이트), vec4 는 16 바이트로 정렬되므로
+  glm::mat4, glm::vec4 만으로 구성된 구조체는 별도의 패딩 없이 그대로 UniformRing 에 써넣을 수 있음.
+  (vec3, float 등을 추가할 때에는 std140 정렬 규칙에 맞게 패딩을 직접 넣어줘야 함!)
+*/
+
+// 유니폼 블록 바인딩 포인트
+enum UniformBlockBinding
+{
+  UNIFORM_BINDING_CAMERA = 0, // Camera 블록 (프레임당 한 번 갱신)
+  UNIFORM_BINDING_OBJECT = 1,   // Object 블록 (오브젝트마다 갱신)
+  UNIFORM_BINDING_MATERIALS = 2 // Materials 블록 (텍스쳐 아틀라스를 만들 때 한 번 갱신)
+};
+
+// Materials 블록에 담을 수 있는 최대 머티리얼 수 (material_blocks.glsl 의 MAX_MATERIAL_SLOTS 와 같아야 함)
+const int MAX_MATERIAL_SLOTS = 64;
+
+// layout(std140) uniform Camera
+struct CameraBlock
+{
+  glm::mat4 projection;
+  glm::mat4 view;
+};
+
+// layout(std140) uniform Object
+struct ObjectBlock
+{
+  glm::mat4 model;
+};
+
+// Materials 블록의 머티리얼 하나 (TexturePacker 가 채워줌)
+struct MaterialSlot
+{
+  glm::vec4 uvRect; // 텍스쳐 배열 레이어 안에서의 영역 (xy : 시작 uv, zw : 크기)
+  glm::vec4 layer;  // x : 텍스쳐 배열의 레이어 (나머지는 std140 패딩)
+};
+
+// layout(std140) uniform Materials
+struct MaterialsBlock
+{
+  MaterialSlot slots[MAX_MATERIAL_SLOTS];
+};
+
+static_assert(sizeof(CameraBlock) == 128, "CameraBlock must match std140 layout");
+static_assert(sizeof(ObjectBlock) == 64, "ObjectBlock must match std140 layout");
+static_assert(sizeof(MaterialsBlock) == 32 * MAX_MATERIAL_SLOTS, "MaterialsBlock must match std140 layout");
+
+#endif // UNIFORM_BLOCKS_HPP
@@ -0,0 +1,48 @@
+#ifndef BLOCK_COMPRESSION_HPP
+#define BLOCK_COMPRESSION_HPP
+
+#include <cstddef> // size_t
+#include <cstdint> // uint8_t
+#include <string>  // std::string
+
+/*
+  블록 압축(Block Compression) 텍스쳐 포맷
+
+  4x4 픽셀 블록 하나를 고정된 크기로 압축하는 GPU 텍스쳐 포맷들.
+  GPU 가 샘플링할 때 하드웨어에서 곧바로 압축을 풀기 때문에,
+  압축된 상태 그대로 VRAM 에 올려두고 사용할 수 있음. (RGBA8 대비 BC1 은 1/8, BC3/BC7 은 1/4 크기)
+
+  - BC1 (DXT1) : 블록당 8 바이트. 불투명한 RGB 이미지용
+  - BC3 (DXT5) : 블록당 16 바이트. BC1 색상 블록 + 8 단계 보간 알파 블록
+  - BC7        : 블록당 16 바이트. BC3 보다 색상 품질이 훨씬 좋음 (OpenGL 4.2 이상)
+*/
+enum BlockFormat
+{
+  BLOCK_FORMAT_BC1,
+  BLOCK_FORMAT_BC3,
+  BLOCK_FORMAT_BC7
+};
+
+// 블록 하나의 바이트 수
+inline size_t blockBytes(BlockFormat format)
+{
+  return format == BLOCK_FORMAT_BC1 ? 8 : 16;
+}
+
+// width x height 이미지를 압축했을 때의 바이트 수 (가장자리의 블록은 4x4 로 채워서 계산)
+inline size_t compressedSize(BlockFormat format, int width, int height)
+{
+  size_t blocksX = (size_t)(width + 3) / 4;
+  size_t blocksY = (size_t)(height + 3) / 4;
+  return blocksX * blocksY * blockBytes(format);
+}
+
+// 4x4 RGBA8 픽셀(64 바이트, 행 우선)을 블록 하나로 압축
+void encodeBC1Block(const uint8_t rgba[64], uint8_t out[8]);
+void encodeBC3Block(const uint8_t rgba[64], uint8_t out[16]);
+void encodeBC7Block(const uint8_t rgba[64], uint8_t out[16]);
+
+// RGBA8 이미지 전체를 압축하여 out 에 덧붙임 (블록 행 단위로 threadCount 개의 스레드에 나눠서 처리. 0 이면 CPU 코어 수. 가로나 세로가 0 이하라면 아무것도 덧붙이지 않음)
+void compressImage(BlockFormat format, const uint8_t *rgba, int width, int height, std::string &out, unsigned int threadCount = 0);
+
+#endif // BLOCK_COMPRESSION_HPP
@@ -0,0 +1,64 @@
+#ifndef DDS_HPP
+#define DDS_HPP
+
+#include <string> // std::string
+#include <vector> // std::vector
+
+#include "texture/block_compression.hpp" // BlockFormat
+
+/*
+  DDS(DirectDraw Surface) 파일 포맷
+
+  블록 압축된 텍스쳐를 밉맵 레벨까지 통째로 담아두는 컨테이너.
+  픽셀 데이터가 GPU 가 그대로 읽을 수 있는 배치로 저장되어 있으므로,
+  로딩할 때는 헤더만 해석한 뒤 레벨마다 glCompressedTexImage2D() 로 곧바로 넘기면 됨. (디코딩 없음)
+
+  - 선형(linear) BC1, BC3 는 옛 헤더의 FourCC('DXT1', 'DXT5')로 저장하여 대부분의 도구에서 열 수 있도록 함
+  - sRGB 포맷과 BC7 은 옛 헤더로 표현할 수 없으므로 DX10 확장 헤더(DXGI_FORMAT)를 덧붙여 저장함
+*/
+
+// 밉맵 레벨 하나의 크기와 data 안에서의 위치
+struct DdsLevel
+{
+  int width;
+  int height;
+  size_t offset; // DdsImage::data 안에서의 시작 위치
+  size_t size;   // 압축된 바이트 수
+};
+
+// DDS 파일 하나의 내용
+struct DdsImage
+{
+  BlockFormat format;
+  bool srgb; // 색상 데이터라면 sRGB 포맷으로 업로드
+  int width;
+  int height;
+  std::vector<DdsLevel> levels; // 0 번이 원본 크기
+  std::string data;             // 모든 레벨의 압축된 블록 데이터를 이어붙인 것
+  const char *view;             // nullptr 이 아니라면 data 대신 외부 메모리(에셋 팩의 매핑 등)의 블록 데이터를 가리킴
+
+  DdsImage() : format(BLOCK_FORMAT_BC1), srgb(false), width(0), height(0), view(nullptr) {}
+
+  // 모든 레벨의 압축된 블록 데이터 (view 가 있다면 view)
+  const char *bytes() const { return view ? view : data.data(); }
+
+  // 모든 레벨의 압축된 블록 데이터 크기
+  size_t byteCount() const { return levels.empty() ? 0 : levels.back().offset + levels.back().size; }
+};
+
+// 메모리에 읽어둔 DDS 파일 해석 (지원하지 않는 포맷이거나 파일이 잘렸다면 false 반환. 블록 데이터는 out.data 로 복사됨)
+bool parseDds(const std::string &file, DdsImage &out);
+
+// 메모리에 있는 DDS 파일을 복사 없이 해석 (out.view 가 file 안을 가리키므로, out 을 사용하는 동안 file 이 유지되어야 함)
+bool parseDdsView(const char *file, size_t size, DdsImage &out);
+
+// DDS 파일의 헤더만 읽기 (블록 데이터는 읽지 않으므로 out.bytes() 는 비어있음. 레벨의 파일 내 위치는 dataOffset + DdsLevel::offset)
+bool readDdsHeader(const std::string &path, DdsImage &out, size_t &dataOffset);
+
+// DDS 파일 읽기
+bool readDds(const std::string &path, DdsImage &out);
+
+// DDS 파일 저장
+bool writeDds(const std::string &path, const DdsImage &image);
+
+#endif // DDS_HPP
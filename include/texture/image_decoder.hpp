@@ -0,0 +1,102 @@
+#ifndef IMAGE_DECODER_HPP
+#define IMAGE_DECODER_HPP
+
+#include <cstddef> // size_t
+#include <cstdint> // uint8_t
+#include <memory>  // std::unique_ptr
+#include <vector>  // std::vector
+
+/*
+  DecodedImage 구조체
+
+  디코딩된 픽셀 데이터. (행 사이에 여백 없이 채워져 있으며, 위쪽 행부터 저장됨)
+  pixels 는 모든 백엔드가 std::malloc() 으로 할당하므로 freeImagePixels() 로 반납함. (stb_image 의 기본 할당자도 malloc)
+*/
+struct DecodedImage
+{
+  int width;
+  int height;
+  int channels;       // pixels 의 채널 수 (디코딩할 때 요청한 채널 수)
+  int bitsPerChannel; // 8 또는 16
+  void *pixels;
+
+  DecodedImage() : width(0), height(0), channels(0), bitsPerChannel(8), pixels(nullptr) {}
+};
+
+// DecodedImage::pixels 메모리 반납
+void freeImagePixels(void *pixels);
+
+/*
+  ImageDecoder 클래스
+
+  이미지 파일 포맷 하나를 디코딩하는 백엔드의 인터페이스.
+  모든 함수는 여러 워커 스레드에서 동시에 호출되므로, 백엔드는 상태를 갖지 않아야 함.
+*/
+class ImageDecoder
+{
+public:
+  virtual ~ImageDecoder() {}
+
+  // 백엔드 이름 (벤치마크, 로그 출력용)
+  virtual const char *name() const = 0;
+
+  // 파일 시그니처(앞부분의 매직 넘버)로 이 백엔드가 맡을 파일인지 판단
+  virtual bool accepts(const uint8_t *data, size_t size) const = 0;
+
+  // 헤더만 해석하여 크기, 채널 수, 채널당 비트 수 반환 (지원하지 않는 변형이라면 false 반환)
+  virtual bool info(const uint8_t *data, size_t size, int &width, int &height, int &channels, int &bitsPerChannel) const = 0;
+
+  // desiredChannels 채널로 디코딩 (0 이면 원본 채널 수. 지원하지 않는 변형이라면 false 반환)
+  virtual bool decode(const uint8_t *data, size_t size, int desiredChannels, DecodedImage &out) const = 0;
+};
+
+/*
+  ImageDecoders 클래스
+
+  파일 시그니처에 맞는 디코더 백엔드를 골라주는 클래스!
+
+  등록된 순서대로 accepts() 를 확인하여 처음으로 받아들인 백엔드를 사용하고,
+  받아들인 백엔드가 없거나 해당 백엔드가 지원하지 않는 변형(팔레트 PNG, 16 비트 등)이라면 stb_image 로 대신 디코딩함.
+
+  기본 백엔드 :
+  - PngDecoder     : 8 비트 PNG (SIMD 필터 복원. CMake 의 IMAGE_DECODER_LIBDEFLATE 옵션을 켜면 압축 해제도 libdeflate 로 처리)
+  - JpegDecoder    : JPEG (CMake 의 IMAGE_DECODER_TURBOJPEG 옵션을 켠 경우에만. libjpeg-turbo 의 SIMD 디코더)
+  - stb_image      : 그 외 모든 포맷 (대체 백엔드)
+*/
+class ImageDecoders
+{
+public:
+  // 앱 전체에서 공유하는 ImageDecoders 객체 (처음 호출될 때 기본 백엔드들을 등록함)
+  static ImageDecoders &shared();
+
+  ImageDecoders();
+  ~ImageDecoders();
+
+  ImageDecoders(const ImageDecoders &) = delete;
+  ImageDecoders &operator=(const ImageDecoders &) = delete;
+
+  // 백엔드 추가 (먼저 등록된 백엔드보다 뒤에 확인됨. 워커 스레드들이 디코딩을 시작하기 전에 호출해야 함)
+  void add(std::unique_ptr<ImageDecoder> decoder);
+
+  // 파일 시그니처에 맞는 백엔드 (없다면 stb_image 백엔드)
+  const ImageDecoder &find(const uint8_t *data, size_t size) const;
+
+  // 헤더만 해석 (맞는 백엔드가 지원하지 않는 변형이라면 stb_image 로 대신 해석)
+  bool info(const uint8_t *data, size_t size, int &width, int &height, int &channels, int &bitsPerChannel) const;
+
+  // 디코딩 (맞는 백엔드가 지원하지 않는 변형이라면 stb_image 로 대신 디코딩)
+  bool decode(const uint8_t *data, size_t size, int desiredChannels, DecodedImage &out) const;
+
+  // 등록된 백엔드들 (stb_image 백엔드는 포함되지 않음. 벤치마크용)
+  size_t count() const;
+  const ImageDecoder &get(size_t index) const;
+
+  // stb_image 백엔드
+  const ImageDecoder &fallback() const;
+
+private:
+  std::vector<std::unique_ptr<ImageDecoder> > decoders;
+  std::unique_ptr<ImageDecoder> stbDecoder;
+};
+
+#endif // IMAGE_DECODER_HPP
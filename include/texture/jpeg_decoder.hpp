@@ -0,0 +1,24 @@
+#ifndef JPEG_DECODER_HPP
+#define JPEG_DECODER_HPP
+
+#include "texture/image_decoder.hpp" // ImageDecoder
+
+/*
+  JpegDecoder 클래스
+
+  libjpeg-turbo 의 TurboJPEG API 로 JPEG 를 디코딩하는 백엔드.
+  IDCT, 업샘플링, YCbCr -> RGB 변환이 모두 SIMD 로 처리되므로 stb_image 의 JPEG 디코더보다 몇 배 빠름.
+
+  CMake 의 IMAGE_DECODER_TURBOJPEG 옵션을 켠 경우에만 빌드되고 등록됨. (시스템에 설치된 libturbojpeg 를 pkg-config 로 찾음)
+  CMYK JPEG 나 2 채널 요청은 지원하지 않으므로 false 를 반환하여 stb_image 가 대신 디코딩하도록 함.
+*/
+class JpegDecoder : public ImageDecoder
+{
+public:
+  const char *name() const;
+  bool accepts(const uint8_t *data, size_t size) const;
+  bool info(const uint8_t *data, size_t size, int &width, int &height, int &channels, int &bitsPerChannel) const;
+  bool decode(const uint8_t *data, size_t size, int desiredChannels, DecodedImage &out) const;
+};
+
+#endif // JPEG_DECODER_HPP
@@ -0,0 +1,50 @@
+#ifndef MIP_GENERATOR_HPP
+#define MIP_GENERATOR_HPP
+
+#include <cstdint> // uint8_t
+#include <vector>  // std::vector
+
+/*
+  CPU 밉맵 생성기
+
+  glGenerateMipmap() 은 로딩 시점에 텍스쳐마다 드라이버에서 실행되고, 어떤 필터를 쓸지는 드라이버 마음대로임.
+  (대부분 감마를 고려하지 않은 2x2 박스 필터라서, sRGB 텍스쳐의 밉맵이 실제보다 어둡게 보이기도 함)
+
+  그래서 밉맵 체인을 CPU 에서 직접 만들어서 레벨마다 업로드하거나, 빌드 시점에 미리 만들어 둠.
+
+  - sRGB 이미지는 선형 공간으로 바꿔서 필터링한 뒤 다시 sRGB 로 인코딩함 (알파 채널은 항상 선형)
+  - 필터는 가로 -> 세로 순서로 나눠서 적용(separable)하며, 밉맵 레벨마다 바로 윗 레벨을 절반으로 줄여서 만듦
+  - 세로 방향 누적은 행 전체를 한 번에 처리하므로 SSE (실행 중인 CPU 가 지원한다면 AVX2 + FMA) 로 8 개씩 계산함
+  - 행들을 스레드 개수만큼 나눠서 병렬로 처리함
+*/
+
+// 밉맵 축소 필터
+enum MipFilter
+{
+  MIP_FILTER_BOX,    // 면적 평균 (glGenerateMipmap 과 비슷하지만 감마를 고려함)
+  MIP_FILTER_KAISER, // Kaiser 창을 씌운 sinc (선명하면서도 링잉이 적음)
+  MIP_FILTER_LANCZOS // Lanczos3 (가장 선명하지만 경계에서 약간의 링잉이 생김)
+};
+
+// 밉맵 레벨 하나
+struct MipLevel
+{
+  int width;
+  int height;
+  std::vector<uint8_t> pixels; // 원본과 같은 채널 수의 8 비트 픽셀 (행 사이에 여백 없음)
+};
+
+// 필터 이름("box", "kaiser", "lanczos")을 MipFilter 로 변환 (알 수 없는 이름이면 false 반환)
+bool parseMipFilter(const char *name, MipFilter &out);
+
+/**
+ * 8 비트 이미지(channels 는 1 ~ 4)의 밉맵 체인을 1x1 까지 생성하여 out 에 저장.
+ *
+ * out 에는 원본(레벨 0)을 제외한 레벨 1 부터 저장됨.
+ * srgb 가 true 라면 3, 4 채널 이미지의 RGB 채널을 선형 공간에서 필터링함.
+ * threadCount 가 0 이면 CPU 코어 수만큼의 스레드를 사용함. (이미 여러 텍스쳐를 병렬로 처리 중이라면 1 을 넘길 것)
+ */
+void generateMipmaps(const uint8_t *pixels, int width, int height, int channels, bool srgb, MipFilter filter,
+                     std::vector<MipLevel> &out, unsigned int threadCount = 0);
+
+#endif // MIP_GENERATOR_HPP
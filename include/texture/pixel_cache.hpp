@@ -0,0 +1,99 @@
+#ifndef PIXEL_CACHE_HPP
+#define PIXEL_CACHE_HPP
+
+#include <atomic>  // std::atomic
+#include <cstddef> // size_t
+#include <cstdint> // uint64_t
+#include <memory>  // std::shared_ptr
+#include <mutex>   // std::mutex
+#include <string>  // std::string
+#include <vector>  // std::vector
+
+#include "util/file_io.hpp" // FileStamp, MappedFile
+
+/*
+  PixelCache 클래스
+
+  디코딩(+ 채널 순서 변환, 밉맵 생성)이 끝난 픽셀 데이터를 디스크에 그대로 저장해두었다가,
+  다음 실행 시 파일을 메모리에 매핑해서 디코딩을 통째로 건너뛸 수 있도록 관리하는 클래스!
+
+  PNG, JPEG 디코딩과 밉맵 생성은 텍스쳐 하나당 수 ms ~ 수십 ms 가 걸리지만,
+  이미 디코딩된 픽셀은 페이지 캐시에서 매핑하기만 하면 되므로 두 번째 실행부터는 시작 시간이 크게 줄어듬.
+
+  - 캐시 키는 원본 파일 경로와 로더 설정(settings)을 해싱하여 만들고,
+    원본 파일의 크기와 마지막 수정 시각은 캐시 파일 헤더에 기록해두었다가 조회할 때 비교함 (원본이 바뀌면 캐시 미스)
+  - 밉맵 레벨들은 64 바이트 단위로 정렬된 위치에 연속으로 저장되므로, 매핑된 메모리를 복사 없이 그대로 업로드할 수 있음
+  - 캐시 적중 시 캐시 파일의 수정 시각을 갱신하고, 저장할 때 디렉토리 전체 크기가 maxBytes 를 넘으면
+    수정 시각이 가장 오래된 파일(가장 오랫동안 사용되지 않은 파일)부터 삭제함
+  - 임시 파일에 다 쓴 뒤 rename 으로 교체하므로, 같은 캐시 디렉토리를 쓰는 다른 프로세스는 완성된 파일만 보게 됨
+    (ProgramCache 와 달리 인덱스 파일을 두지 않으므로, 여러 프로세스가 동시에 써도 인덱스가 깨질 일이 없음)
+
+  참고로, 에셋 팩 안의 파일은 원본 파일의 수정 시각을 알 수 없으므로 캐시하지 않음. (팩의 메모리를 곧바로 디코딩함)
+  OpenGL 컨텍스트가 필요 없으므로 워커 스레드들에서 동시에 호출해도 됨.
+*/
+
+// 캐시 항목 하나를 가리키는 키 (makeKey() 로 생성)
+struct PixelCacheKey
+{
+  std::string path;   // 원본 파일 경로
+  FileStamp source;   // 원본 파일의 크기와 마지막 수정 시각
+  uint64_t settings;  // 디코딩 결과에 영향을 주는 로더 설정의 해시값
+  std::string file;   // 캐시 파일 경로
+};
+
+// 캐시에서 찾은 픽셀 데이터 (file 이 살아있는 동안 levels 가 가리키는 메모리가 유효함)
+struct PixelCacheEntry
+{
+  std::shared_ptr<MappedFile> file;
+  int width;
+  int height;
+  int channels;
+  int bitsPerChannel;
+  std::vector<const void *> levels; // 레벨 0 부터의 밉맵 레벨들 (레벨마다 가로, 세로가 절반씩 줄어듬)
+
+  PixelCacheEntry() : width(0), height(0), channels(0), bitsPerChannel(8) {}
+};
+
+class PixelCache
+{
+public:
+  // PixelCache 클래스 생성자 (디렉토리가 없다면 생성함)
+  PixelCache(const std::string &directory, unsigned long long maxBytes = 512ull * 1024ull * 1024ull);
+
+  PixelCache(const PixelCache &) = delete;
+  PixelCache &operator=(const PixelCache &) = delete;
+
+  // 원본 파일 경로와 로더 설정으로 캐시 키 생성 (원본 파일이 디스크에 없으면 false 반환)
+  bool makeKey(const std::string &path, uint64_t settings, PixelCacheKey &out) const;
+
+  // 캐시된 픽셀 데이터를 매핑 (없거나, 원본이 바뀌었거나, 파일이 손상되었다면 false 반환)
+  bool lookup(const PixelCacheKey &key, PixelCacheEntry &out);
+
+  // 픽셀 데이터를 캐시에 저장 (levels 는 레벨 0 부터의 밉맵 레벨들. 실패해도 캐시를 쓰지 않을 뿐이므로 반환값은 참고용)
+  bool store(const PixelCacheKey &key, int width, int height, int channels, int bitsPerChannel, const std::vector<const void *> &levels);
+
+  // 적중률 및 저장, 삭제 통계 출력
+  void report() const;
+
+  // width x height 에서 시작하는 밉맵 체인의 level 번째 레벨 크기 (1x1 까지 절반씩 줄어듬)
+  static int levelDimension(int size, int level);
+
+private:
+  std::string directory;       // 캐시 디렉토리 경로
+  unsigned long long maxBytes; // 캐시 디렉토리 최대 크기
+  std::mutex evictMutex;       // 한 프로세스 안에서 여러 워커 스레드가 동시에 디렉토리를 훑지 않도록 보호
+
+  // 통계 (여러 워커 스레드에서 갱신됨)
+  std::atomic<unsigned long long> hits;
+  std::atomic<unsigned long long> misses;
+  std::atomic<unsigned long long> stores;
+  std::atomic<unsigned long long> evictions;
+  std::atomic<unsigned long long> hitBytes;
+  std::atomic<unsigned long long> storedBytes;
+  std::atomic<unsigned int> tempCounter; // 임시 파일 이름이 겹치지 않도록 붙이는 번호
+
+  // 캐시 디렉토리 크기가 maxBytes 이하가 될 때까지 오래된 파일부터 삭제
+  void evict();
+};
+
+#endif // PIXEL_CACHE_HPP
@@ -0,0 +1,56 @@
+#ifndef PIXEL_CONVERT_HPP
+#define PIXEL_CONVERT_HPP
+
+#include <cstddef> // size_t
+#include <cstdint> // uint8_t, uint16_t
+
+/*
+  픽셀 포맷 변환 커널
+
+  디코더가 내놓는 픽셀은 RGB, 흑백, 흑백 + 알파 등 제각각이지만, 드라이버는 4 바이트로 정렬된 RGBA8 / BGRA8 을 가장 빠르게 받아들임.
+  업로드 전에 워커 스레드에서 픽셀을 변환해두는 커널들로, 실행 중인 CPU 가 지원하는 가장 넓은 명령어 집합을 처음 호출될 때 골라둠.
+
+  - x86 : SSE2 (기본) -> SSSE3 (pshufb 로 바이트 재배치) -> AVX2 (256 비트)
+  - ARM : NEON (vld3 / vld4 로 채널을 나눠 읽고 vst4 로 합쳐서 씀)
+  - 그 외 : 스칼라
+
+  sRGB <-> 선형 변환은 256 칸짜리 표 조회로 처리함. (gather 명령은 표 조회보다 느리므로 SIMD 로 빨라지지 않음)
+*/
+
+// 변환 커널에 사용할 명령어 집합
+enum PixelConvertLevel
+{
+  PIXEL_CONVERT_SCALAR,
+  PIXEL_CONVERT_SSE2,
+  PIXEL_CONVERT_SSSE3,
+  PIXEL_CONVERT_AVX2,
+  PIXEL_CONVERT_NEON
+};
+
+// 현재 사용 중인 명령어 집합 및 그 이름
+PixelConvertLevel pixelConvertLevel();
+const char *pixelConvertLevelName(PixelConvertLevel level);
+
+// 실행 중인 CPU 가 지원하는 명령어 집합인지 여부
+bool isPixelConvertLevelSupported(PixelConvertLevel level);
+
+// 사용할 명령어 집합 변경 (지원하지 않으면 false 반환. 벤치마크용이며, 다른 스레드가 변환 중일 때 호출하면 안 됨)
+bool setPixelConvertLevel(PixelConvertLevel level);
+
+// RGB 픽셀을 알파 255 인 RGBA 픽셀로 확장 (src 와 dst 는 겹치면 안 됨)
+void expandRgbToRgba(const uint8_t *src, uint8_t *dst, size_t pixelCount);
+
+// RGBA <-> BGRA 채널 순서 교환 (R 과 B 를 바꾸므로 양방향 모두 같은 함수. src 와 dst 는 같아도 됨)
+void swizzleRgbaBgra(const uint8_t *src, uint8_t *dst, size_t pixelCount);
+
+// RGBA 픽셀의 RGB 에 알파를 미리 곱함 (제자리 변환. 반올림된 x * a / 255)
+void premultiplyAlpha(uint8_t *pixels, size_t pixelCount);
+
+// 16 비트 채널 값을 8 비트로 줄임 (반올림된 v * 255 / 65535. src 와 dst 는 겹치면 안 됨)
+void convert16To8(const uint16_t *src, uint8_t *dst, size_t valueCount);
+
+// sRGB <-> 선형 변환 (channels 가 2, 4 라면 마지막 채널인 알파는 그대로 복사. src 와 dst 는 같아도 됨)
+void convertSrgbToLinear(const uint8_t *src, uint8_t *dst, size_t pixelCount, int channels);
+void convertLinearToSrgb(const uint8_t *src, uint8_t *dst, size_t pixelCount, int channels);
+
+#endif // PIXEL_CONVERT_HPP
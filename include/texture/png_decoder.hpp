@@ -0,0 +1,28 @@
+#ifndef PNG_DECODER_HPP
+#define PNG_DECODER_HPP
+
+#include "texture/image_decoder.hpp" // ImageDecoder
+
+/*
+  PngDecoder 클래스
+
+  8 비트 PNG(흑백, 흑백 + 알파, RGB, RGBA, 인터레이스 없음)를 디코딩하는 백엔드.
+
+  stb_image 의 PNG 디코딩 시간은 대부분 압축 해제(inflate)와 행마다의 필터 복원(unfilter)이 차지함.
+  - 압축 해제 : 출력 크기(높이 x (행 바이트 수 + 1))를 헤더로 미리 알 수 있으므로, 정확한 크기의 버퍼에 한 번에 풀어냄
+               (CMake 의 IMAGE_DECODER_LIBDEFLATE 옵션을 켜면 stb_image 의 zlib 대신 훨씬 빠른 libdeflate 를 사용)
+  - 필터 복원 : Up 필터는 16 바이트씩, Sub / Average / Paeth 필터는 픽셀 단위로 SSE2 레지스터에서 처리함
+  - 채널 변환 : 필터를 복원한 행을 곧바로 요청한 채널 수로 변환하며 출력에 써넣으므로, 이미지 전체를 한 번 더 훑지 않음
+
+  팔레트 이미지, 16 비트, 인터레이스 이미지는 지원하지 않으므로 false 를 반환하여 stb_image 가 대신 디코딩하도록 함.
+*/
+class PngDecoder : public ImageDecoder
+{
+public:
+  const char *name() const;
+  bool accepts(const uint8_t *data, size_t size) const;
+  bool info(const uint8_t *data, size_t size, int &width, int &height, int &channels, int &bitsPerChannel) const;
+  bool decode(const uint8_t *data, size_t size, int desiredChannels, DecodedImage &out) const;
+};
+
+#endif // PNG_DECODER_HPP
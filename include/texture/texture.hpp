@@ -0,0 +1,113 @@
+#ifndef TEXTURE_HPP
+#define TEXTURE_HPP
+
+#include <glad/glad.h> // OpenGL 함수를 초기화하기 위한 헤더
+
+#include "gl/gl_handle.hpp"              // TextureHandle
+#include "texture/block_compression.hpp" // BlockFormat
+#include "texture/mip_generator.hpp"     // MipLevel
+
+#include <vector> // std::vector
+
+struct DdsImage;
+class PixelUploadRing;
+
+/*
+  TextureFormat 구조체
+
+  텍스쳐의 GPU 저장 포맷(internalFormat)과, 업로드할 픽셀 데이터의 배치(format, type) 조합
+*/
+struct TextureFormat
+{
+  GLenum internalFormat; // GPU 에 저장되는 크기가 정해진(sized) 포맷 (GL_RGBA8, GL_R8 등)
+  GLenum format;         // 업로드할 픽셀 데이터의 채널 구성 (GL_RGBA, GL_RED 등)
+  GLenum type;           // 업로드할 픽셀 데이터의 채널 타입 (GL_UNSIGNED_BYTE 등)
+};
+
+/*
+  Texture 클래스
+
+  이미지의 채널 수와 채널당 비트 수에 맞는 포맷으로 2D 텍스쳐를 생성하는 클래스!
+
+  glTexImage2D(..., GL_RGB, ..., GL_RGB, ...) 처럼 포맷을 고정해두면
+  RGBA 나 흑백 이미지는 깨져서 보이고, GL_RGB 처럼 크기가 정해지지 않은(unsized) 포맷은
+  드라이버가 실제 저장 포맷을 추측해야 하므로 업로드 시 변환 경로를 타기 쉬움.
+
+  - 채널 수(1 ~ 4)와 비트 수(8, 16), sRGB 여부로 크기가 정해진 포맷(GL_R8, GL_RG8, GL_RGBA8, GL_SRGB8_ALPHA8 등)을 선택함
+  - OpenGL 4.2 이상에서는 glTexStorage2D() 로 모든 밉맵 레벨을 한 번에 할당하는 불변(immutable) 텍스쳐를 생성함
+    (드라이버가 레벨마다 크기나 포맷이 바뀌는 경우를 고려하지 않아도 되므로 검증 비용이 줄어듬.
+     4.2 미만에서는 같은 포맷으로 glTexImage2D() 를 레벨마다 호출하여 대체함)
+  - 행(row)의 바이트 수에 맞춰 GL_UNPACK_ALIGNMENT 를 설정함 (1, 3 채널 이미지의 행은 4 바이트 단위로 정렬되지 않을 수 있음)
+  - OpenGL 4.3 이상에서는 드라이버가 선호하는 업로드 포맷을 조회해서, 픽셀 데이터를 변환하지 않고 쓸 수 있는 경우에만 사용함
+  - CPU 에서 미리 만든 밉맵 레벨이 있다면 createWithMipmaps() 로 레벨마다 업로드하여 glGenerateMipmap() 을 생략함
+  - 빌드 시점에 블록 압축해둔 DDS 는 createCompressed() 로 밉맵 레벨마다 압축된 그대로 업로드함 (format, type 은 GL_NONE)
+  - PixelUploadRing 을 넘겨주면 레벨마다의 업로드를 픽셀 언팩 버퍼를 통해 비동기로 처리함 (클라이언트 메모리 복사 대기 없음)
+  - 드라이버가 GL_BGRA 를 선호한다면(prefersBgraUpload()) 워커 스레드에서 채널 순서를 바꿔둔 픽셀을 bgra 로 넘겨서 변환 없이 업로드할 수 있음
+*/
+class Texture
+{
+public:
+  TextureHandle ID; // 텍스쳐 객체 핸들
+
+  // Texture 클래스 생성자 (create() 를 호출하기 전까지는 빈 텍스쳐)
+  Texture();
+
+  // 픽셀 데이터로 텍스쳐 생성 (pixels 는 행 사이에 여백 없이 채워진 데이터. mipmaps 가 true 이면 밉맵까지 생성)
+  bool create(int width, int height, int channels, int bitsPerChannel, const void *pixels, bool srgb = false, bool mipmaps = true,
+              PixelUploadRing *ring = nullptr);
+
+  // 8 비트 픽셀 데이터와 generateMipmaps() 로 만든 레벨 1 부터의 밉맵들로 텍스쳐 생성 (glGenerateMipmap() 을 호출하지 않음)
+  // (bgra 가 true 라면 4 채널 픽셀이 BGRA 순서로 채워져 있음)
+  bool createWithMipmaps(int width, int height, int channels, const void *pixels, const std::vector<MipLevel> &mipmaps, bool srgb = false,
+                         PixelUploadRing *ring = nullptr, bool bgra = false);
+
+  // 레벨 0 부터의 8 비트 밉맵 레벨들로 텍스쳐 생성 (레벨마다 가로, 세로가 절반씩 줄어듬. PixelCache 에서 매핑한 메모리를 그대로 넘길 때 사용)
+  bool createFromLevels(int width, int height, int channels, const std::vector<const void *> &levels, bool srgb = false,
+                        PixelUploadRing *ring = nullptr, bool bgra = false);
+
+  // 블록 압축된 DDS 이미지로 텍스쳐 생성 (드라이버가 해당 압축 포맷을 지원하지 않으면 false 반환)
+  bool createCompressed(const DdsImage &image);
+
+  // 지정한 텍스쳐 유닛에 바인딩
+  void bind(unsigned int unit) const;
+
+  int getWidth() const;
+  int getHeight() const;
+  int getLevels() const;
+  const TextureFormat &getFormat() const;
+
+  // 채널 수, 채널당 비트 수, sRGB 여부에 맞는 포맷 선택 (지원하지 않는 조합이면 false 반환)
+  static bool chooseFormat(int channels, int bitsPerChannel, bool srgb, TextureFormat &out);
+
+  // 블록 압축 포맷에 해당하는 GL 내부 포맷 (BC1, BC3 은 알파 채널이 있는 S3TC 포맷, BC7 은 BPTC 포맷)
+  static GLenum compressedFormat(BlockFormat format, bool srgb);
+
+  // 드라이버가 압축된 데이터를 그대로 받아들이는 내부 포맷인지 여부
+  static bool isCompressedFormatSupported(GLenum internalFormat);
+
+  // 드라이버가 8 비트 RGBA 텍스쳐의 업로드 포맷으로 GL_BGRA 를 선호하는지 여부 (OpenGL 4.3 미만이라면 항상 false)
+  static bool prefersBgraUpload(bool srgb);
+
+  // 행의 바이트 수로 나누어 떨어지는 가장 큰 GL_UNPACK_ALIGNMENT 값 (8, 4, 2, 1)
+  static int unpackAlignment(size_t rowBytes);
+
+  // 1x1 까지의 밉맵 레벨 개수
+  static int mipLevelCount(int width, int height);
+
+private:
+  // 포맷을 선택하고 levelCount 개의 밉맵 레벨을 할당한 뒤 바인딩된 상태로 둠 (bgra 라면 업로드 포맷을 GL_BGRA 로 지정)
+  bool allocate(int width, int height, int channels, int bitsPerChannel, bool srgb, int levelCount, bool bgra = false);
+
+  // 바인딩된 텍스쳐의 밉맵 레벨 하나 업로드 (ring 이 있다면 픽셀 언팩 버퍼를 통해 업로드)
+  void uploadLevel(int level, int width, int height, int channels, int bitsPerChannel, const void *pixels, PixelUploadRing *ring);
+
+  // 바인딩된 텍스쳐의 샘플링 파라미터를 설정하고 바인딩 해제
+  void applyParameters(int channels);
+
+  int width;
+  int height;
+  int levels;
+  TextureFormat format;
+};
+
+#endif // TEXTURE_HPP
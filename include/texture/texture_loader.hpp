@@ -0,0 +1,155 @@
+#ifndef TEXTURE_LOADER_HPP
+#define TEXTURE_LOADER_HPP
+
+#include <glad/glad.h>        // OpenGL 함수를 초기화하기 위한 헤더
+#include <string>             // std::string
+#include <vector>             // std::vector
+#include <deque>              // std::deque
+#include <memory>             // std::shared_ptr
+#include <mutex>              // std::mutex
+#include <condition_variable> // std::condition_variable
+#include <thread>             // std::thread
+#include <chrono>             // 디코딩 및 업로드 시간 측정
+
+#include "gl/gl_handle.hpp"           // TextureHandle
+#include "texture/texture.hpp"       // Texture 클래스
+#include "texture/mip_generator.hpp" // MipFilter
+
+class PixelCache;
+
+/*
+  TextureFuture 클래스
+
+  TextureLoader::submit() 으로 요청한 텍스쳐를 나중에 받아볼 수 있도록 해주는 핸들.
+
+  디코딩 및 업로드가 끝나기 전까지 get() 은 1x1 크기의 대체(placeholder) 텍스쳐를 반환하므로,
+  완료 여부와 상관없이 항상 get() 의 결과를 바인딩하면 됨.
+*/
+class TextureFuture
+{
+public:
+  TextureFuture();
+
+  // 디코딩 및 업로드가 성공적으로 완료되었는지 여부
+  bool ready() const;
+
+  // 디코딩에 실패했는지 여부
+  bool failed() const;
+
+  // 바인딩할 텍스쳐 객체 (아직 완료되지 않았거나 실패했다면 대체 텍스쳐)
+  GLuint get() const;
+
+  // 완료된 텍스쳐 (아직 완료되지 않았거나 실패했다면 nullptr)
+  const Texture *texture() const;
+
+private:
+  friend class TextureLoader;
+
+  // 텍스쳐 하나의 로딩 진행 상태
+  struct Request;
+
+  std::shared_ptr<Request> request;
+};
+
+/*
+  TextureLoader 클래스
+
+  이미지 파일(PNG, JPG 등)의 디코딩을 워커 스레드 풀에서 처리하고,
+  디코딩된 픽셀 데이터는 큐를 통해 GL 스레드로 넘겨서 업로드하는 클래스!
+
+  stbi_load() 로 이미지를 디코딩하는 데에는 이미지 하나당 수 ms ~ 수십 ms 가 걸리기 때문에,
+  텍스쳐가 수백 개라면 첫 프레임을 그리기까지의 시간 대부분을 디코딩이 차지하게 됨.
+
+  - 디코딩은 OpenGL 컨텍스트가 필요 없으므로 워커 스레드들에서 병렬로 처리함
+  - 업로드는 Texture 클래스를 통해 이미지의 채널 수와 비트 수에 맞는 포맷으로 생성됨
+  - 3 채널 이미지는 RGBA 로, 드라이버가 GL_BGRA 를 선호한다면 BGRA 로 워커 스레드에서 SIMD 커널로 변환해둠 (pixel_convert.hpp 참고)
+  - 8 비트 이미지의 밉맵 체인도 워커 스레드에서 감마를 고려한 필터로 만들어두고, 업로드할 때 레벨마다 넘김 (glGenerateMipmap() 생략)
+  - 빌드 시점에 블록 압축해둔 DDS 파일은 디코딩 없이 압축된 밉맵 레벨들을 그대로 업로드함 (tools/texture_cook.cpp 참고)
+  - 업로드(glTexImage2D 등)는 컨텍스트가 있는 GL 스레드에서만 할 수 있으므로,
+    매 프레임 update() 에서 주어진 시간 예산(ms) 안에서만 처리함 (적어도 한 개는 매 프레임 업로드됨)
+  - setUploadRing() 으로 PixelUploadRing 을 넘겨주면 픽셀 데이터는 픽셀 언팩 버퍼를 통해 업로드하고,
+    링의 이번 프레임 구간에 남은 공간이 부족한 텍스쳐는 다음 프레임으로 미룸 (프레임당 업로드 바이트 수가 링 크기로 제한됨)
+  - setDiskCache() 로 PixelCache 를 넘겨주면 디코딩(+ 밉맵 생성, 채널 순서 변환)이 끝난 픽셀을 디스크에 저장해두고,
+    다음 실행부터는 캐시 파일을 매핑해서 곧바로 업로드함 (원본 파일이나 로더 설정이 바뀌면 다시 디코딩함)
+  - 업로드되기 전까지는 1x1 크기의 대체 텍스쳐를 대신 바인딩하므로, 렌더링 루프는 기다리지 않고 곧바로 시작할 수 있음
+*/
+class TextureLoader
+{
+public:
+  // TextureLoader 클래스 생성자 (GLAD 초기화 이후에 생성해야 함. threadCount 가 0 이면 CPU 코어 수에 맞춤)
+  explicit TextureLoader(unsigned int threadCount = 0, MipFilter mipFilter = MIP_FILTER_KAISER);
+
+  // TextureLoader 클래스 소멸자 (워커 스레드 종료 대기)
+  ~TextureLoader();
+
+  TextureLoader(const TextureLoader &) = delete;
+  TextureLoader &operator=(const TextureLoader &) = delete;
+
+  // 텍스쳐 로딩 요청 (곧바로 반환되며, 디코딩은 워커 스레드에서 진행됨. 색상 텍스쳐라면 srgb 를 true 로 지정)
+  TextureFuture submit(const std::string &path, bool srgb = false);
+
+  // 매 프레임마다 호출하여 디코딩이 끝난 텍스쳐를 budgetMs 안에서 업로드
+  void update(double budgetMs);
+
+  // 픽셀 데이터를 업로드할 때 사용할 링 (nullptr 이면 클라이언트 메모리에서 곧바로 업로드. 링은 TextureLoader 보다 오래 살아있어야 함)
+  void setUploadRing(PixelUploadRing *ring);
+
+  // 디코딩된 픽셀을 저장하고 다시 읽어올 디스크 캐시 (nullptr 이면 사용하지 않음. 캐시는 TextureLoader 보다 오래 살아있어야 함)
+  void setDiskCache(PixelCache *cache);
+
+  // 아직 완료되지 않은 모든 요청이 끝날 때까지 대기 (로딩 화면 등에서 사용)
+  void finish();
+
+  // 아직 완료되지 않은 요청 개수
+  size_t pendingCount() const;
+
+  // 디코딩 및 업로드되기 전까지 대신 바인딩되는 1x1 텍스쳐
+  GLuint placeholder() const;
+
+  // 디코딩 처리량 및 업로드 시간 출력
+  void report() const;
+
+private:
+  typedef std::chrono::steady_clock Clock;
+
+  TextureHandle placeholderTexture; // 1x1 대체 텍스쳐
+  MipFilter mipFilter;              // 워커 스레드에서 밉맵을 만들 때 사용할 필터
+  bool bgraUpload[2];               // 드라이버가 GL_BGRA 업로드를 선호하는지 여부 (선형, sRGB 포맷 순서)
+  std::vector<std::thread> workers; // 디코딩 워커 스레드들
+
+  mutable std::mutex mutex;                                     // 아래의 큐 및 통계값 보호
+  std::condition_variable wakeUp;                               // 디코딩할 요청이 생겼거나 종료할 때 워커를 깨움
+  std::condition_variable decodedSignal;                        // 디코딩이 끝났을 때 finish() 를 깨움
+  std::deque<std::shared_ptr<TextureFuture::Request> > jobs;    // 디코딩 대기 중인 요청들
+  std::deque<std::shared_ptr<TextureFuture::Request> > decoded; // 디코딩이 끝나고 업로드 대기 중인 요청들
+  bool stopping;                                                // 소멸자에서 워커 스레드 종료 요청
+  PixelCache *diskCache;                                        // 디코딩된 픽셀을 저장할 디스크 캐시
+
+  size_t pending;               // 제출된 후 아직 업로드되지 않은 요청 개수 (GL 스레드에서만 접근)
+  PixelUploadRing *uploadRing; // 픽셀 데이터를 업로드할 때 사용할 링 (GL 스레드에서만 접근)
+
+  // 디코딩 통계 (워커 스레드에서 갱신되므로 mutex 로 보호됨)
+  size_t decodeCount;            // 디코딩에 성공한 텍스쳐 개수
+  size_t decodeBytes;            // 디코딩된 픽셀 데이터 크기 합
+  double decodeMs;               // 워커 스레드들이 디코딩에 사용한 시간의 합
+  Clock::time_point firstSubmit; // 첫 요청 시점
+  Clock::time_point lastDecoded; // 마지막으로 디코딩이 끝난 시점
+
+  // 업로드 통계 (GL 스레드에서만 접근)
+  size_t uploadCount;
+  double uploadMs;
+
+  // 워커 스레드 루프
+  void run();
+
+  // 워커 스레드에서 이미지 파일 하나를 디코딩하고 밉맵 생성 (DDS 파일이라면 헤더만 해석. cache 에 있다면 캐시 파일을 매핑)
+  static void decode(TextureFuture::Request &request, PixelCache *cache);
+
+  // 디코딩이 끝난 요청 하나를 GL 스레드에서 업로드
+  void upload(TextureFuture::Request &request);
+
+  // 요청 하나를 업로드할 때 링을 거치는 바이트 수 (밉맵 레벨 포함. 압축된 DDS 는 링을 거치지 않으므로 0)
+  static size_t ringBytes(const TextureFuture::Request &request);
+};
+
+#endif // TEXTURE_LOADER_HPP
@@ -0,0 +1,119 @@
+#ifndef TEXTURE_PACKER_HPP
+#define TEXTURE_PACKER_HPP
+
+#include <glad/glad.h> // OpenGL 함수를 초기화하기 위한 헤더
+
+#include "gl/gl_handle.hpp"          // TextureHandle
+#include "shader/uniform_blocks.hpp" // MaterialsBlock
+#include "texture/mip_generator.hpp" // MipFilter
+
+#include <cstdint> // uint8_t
+#include <string>  // std::string
+#include <vector>  // std::vector
+
+/*
+  TexturePage 구조체
+
+  TexturePacker 가 만든 GL_TEXTURE_2D_ARRAY 텍스쳐 하나. (한 번 바인딩으로 여러 머티리얼을 그릴 수 있는 단위)
+*/
+struct TexturePage
+{
+  TextureHandle ID;
+  int width;  // 레이어 하나의 크기
+  int height;
+  int layers; // 레이어 개수
+  int levels; // 밉맵 레벨 개수
+  bool atlas; // 크기가 다른 텍스쳐들을 나눠 담은 아틀라스 레이어들이라면 true (GL_CLAMP_TO_EDGE 로 샘플링)
+  bool srgb;
+};
+
+/*
+  MaterialPlacement 구조체
+
+  머티리얼 하나의 텍스쳐가 어느 페이지의 몇 번째 레이어, 어느 uv 영역에 들어갔는지
+*/
+struct MaterialPlacement
+{
+  int page;        // TexturePacker::page() 의 번호
+  int layer;       // 텍스쳐 배열의 레이어
+  float uvRect[4]; // 레이어 안에서의 영역 (시작 u, 시작 v, 너비, 높이)
+};
+
+/*
+  TexturePacker 클래스
+
+  머티리얼마다 텍스쳐를 따로 바인딩하는 대신, 텍스쳐들을 GL_TEXTURE_2D_ARRAY 의 레이어로 묶어서
+  같은 페이지의 머티리얼들은 텍스쳐 바인딩 한 번으로 그릴 수 있게 해주는 클래스!
+
+  - 크기와 포맷(sRGB 여부)이 같은 텍스쳐가 여러 개라면 각각을 텍스쳐 배열의 레이어 하나로 넣음 (밉맵 체인 전체 사용)
+  - 크기가 제각각인 작은 텍스쳐들은 atlasSize 크기의 아틀라스 레이어에 선반(shelf) 방식으로 나눠 담음
+    (텍스쳐마다 가장자리 픽셀을 복제한 gutter 만큼의 여백을 두고, gutter 단위로 정렬된 위치에 배치함.
+     gutter 가 2^k 라면 레벨 k 까지는 박스 필터로 줄이더라도 이웃한 텍스쳐의 픽셀이 섞이지 않으므로, 밉맵은 레벨 k 까지만 만듬)
+  - 쉐이더에서는 material_atlas.glsl 의 sampleMaterial() 로 Materials 블록(fillMaterials() 로 채움)의 레이어와 uv 영역을 찾아 샘플링함
+
+  픽셀 데이터는 8 비트만 지원하며, 채널 수와 상관없이 RGBA 로 확장하여 담음.
+*/
+class TexturePacker
+{
+public:
+  // TexturePacker 클래스 생성자 (gutter 는 2 의 거듭제곱이어야 함)
+  explicit TexturePacker(int atlasSize = 2048, int gutter = 8);
+
+  // 텍스쳐 하나 추가 (pixels 는 8 비트 픽셀 데이터이며 곧바로 복사됨). 머티리얼 번호 반환
+  int add(const std::string &name, int width, int height, int channels, const uint8_t *pixels, bool srgb = false);
+
+  // 추가된 텍스쳐들을 페이지로 묶고 업로드 (GL 스레드에서 호출. filter 는 크기가 같은 텍스쳐들의 레이어에 사용)
+  bool build(MipFilter filter = MIP_FILTER_KAISER);
+
+  // 머티리얼 개수
+  int materialCount() const;
+
+  // 머티리얼의 페이지, 레이어, uv 영역
+  const MaterialPlacement &placement(int material) const;
+
+  // 이름으로 머티리얼 번호 찾기 (없다면 -1)
+  int find(const std::string &name) const;
+
+  // 페이지 개수 및 페이지
+  int pageCount() const;
+  const TexturePage &page(int index) const;
+
+  // 페이지를 지정한 텍스쳐 유닛에 바인딩
+  void bindPage(int index, unsigned int unit) const;
+
+  // Materials 블록 채우기 (MAX_MATERIAL_SLOTS 를 넘는 머티리얼은 채우지 않음. 채운 버퍼는 UNIFORM_BINDING_MATERIALS 에 바인딩하고,
+  // 쉐이더를 만들기 전에 Shader::setUniformBlockBinding("Materials", UNIFORM_BINDING_MATERIALS) 로 등록할 것)
+  void fillMaterials(MaterialsBlock &out) const;
+
+  // 페이지 수, 레이어 수, 아틀라스 사용률 출력
+  void report() const;
+
+private:
+  // 추가된 텍스쳐 하나
+  struct Input
+  {
+    std::string name;
+    int width;
+    int height;
+    bool srgb;
+    std::vector<uint8_t> pixels; // RGBA
+  };
+
+  int atlasSize;
+  int gutter;
+  std::vector<Input> inputs;
+  std::vector<MaterialPlacement> placements;
+  std::vector<TexturePage> pages;
+  size_t atlasUsedTexels; // 아틀라스 레이어에서 텍스쳐가 차지하는 텍셀 수 (사용률 계산용)
+
+  // 레이어들의 픽셀 데이터와 밉맵으로 텍스쳐 배열 하나를 만들어 pages 에 추가
+  void createPage(int width, int height, bool atlas, bool srgb, const std::vector<const uint8_t *> &layers, MipFilter filter);
+
+  // 크기가 제각각인 텍스쳐들을 아틀라스 레이어들에 나눠 담음 (레이어가 maxLayers 개를 넘으면 페이지를 나눔)
+  void packAtlas(const std::vector<int> &materials, bool srgb, int maxLayers);
+
+  // 채워둔 아틀라스 레이어들로 페이지 하나를 만들고 레이어들을 비움
+  void flushAtlas(std::vector<std::vector<uint8_t> > &layers, bool srgb);
+};
+
+#endif // TEXTURE_PACKER_HPP
@@ -0,0 +1,139 @@
+#ifndef TEXTURE_STREAMER_HPP
+#define TEXTURE_STREAMER_HPP
+
+#include <glad/glad.h>        // OpenGL 함수를 초기화하기 위한 헤더
+#include <string>             // std::string
+#include <vector>             // std::vector
+#include <deque>              // std::deque
+#include <memory>             // std::shared_ptr
+#include <mutex>              // std::mutex
+#include <condition_variable> // std::condition_variable
+#include <thread>             // std::thread
+
+/*
+  StreamedTexture 클래스
+
+  TextureStreamer::open() 으로 연 텍스쳐의 핸들.
+
+  가장 작은 밉맵 레벨들(꼬리)은 open() 시점에 이미 올라와 있으므로 곧바로 바인딩할 수 있고,
+  화면에 크게 보일수록 더 세밀한 레벨들이 백그라운드 스레드에서 읽혀서 한 레벨씩 채워짐.
+*/
+class StreamedTexture
+{
+public:
+  StreamedTexture();
+
+  // 스트리밍할 수 있는 텍스쳐인지 여부 (블록 압축된 DDS 가 아니었다면 false)
+  bool valid() const;
+
+  // 바인딩할 텍스쳐 객체
+  GLuint get() const;
+
+  // GPU 에 올라와 있는 가장 세밀한 밉맵 레벨 (GL_TEXTURE_BASE_LEVEL 과 같음)
+  int residentLevel() const;
+
+  // 전체 밉맵 레벨 개수
+  int levelCount() const;
+
+private:
+  friend class TextureStreamer;
+
+  // 텍스쳐 하나의 스트리밍 상태
+  struct Entry;
+
+  std::shared_ptr<Entry> entry;
+};
+
+/*
+  TextureStreamer 클래스
+
+  큰 텍스쳐를 통째로 읽어서 올리는 대신, 작은 밉맵 레벨부터 먼저 보여주고
+  화면에 보이는 크기에 필요한 만큼만 세밀한 레벨을 디스크에서 스트리밍하는 클래스!
+
+  - 빌드 시점에 블록 압축해둔 DDS 파일만 지원함 (레벨마다 파일 안의 위치가 정해져 있으므로 필요한 레벨만 읽을 수 있음)
+  - open() 에서는 헤더와 tailSize 이하 크기의 작은 레벨들만 읽어서 곧바로 업로드함
+  - 매 프레임 use() 로 텍스쳐가 화면에서 차지하는 크기(픽셀)를 알려주면, 텍셀 하나가 픽셀 하나에 대응하는 레벨을 목표로 삼음
+  - update() 에서 화면에 크게 보이는 텍스쳐부터 한 레벨씩 I/O 스레드에 읽기 요청을 보내고,
+    읽기가 끝난 레벨은 시간 예산 안에서 업로드한 뒤 GL_TEXTURE_BASE_LEVEL 을 낮춰서 샘플링 범위를 넓힘
+  - GPU 메모리 예산(budgetBytes)을 넘게 되면, 가장 오래 사용되지 않은(LRU) 텍스쳐의 가장 세밀한 레벨부터 내려놓음
+    (GL_TEXTURE_BASE_LEVEL 을 올린 뒤 해당 레벨을 크기 0 으로 다시 지정하여 드라이버가 메모리를 해제하도록 함)
+  - 예산 안에 넣을 수 없는 레벨은 읽지 않고 한 단계 흐린 레벨로 그대로 그리므로, 텍스쳐가 GPU 메모리보다 많아도 멈추지 않음
+
+  레벨을 내려놓으려면 레벨마다 따로 할당해야 하므로, glTexStorage2D() 의 불변(immutable) 텍스쳐 대신
+  레벨마다 glCompressedTexImage2D() 로 할당하는 가변 텍스쳐를 사용함.
+  (GL_TEXTURE_BASE_LEVEL ~ GL_TEXTURE_MAX_LEVEL 밖의 레벨은 완전성(completeness) 검사에서 제외되므로 비워둬도 됨)
+*/
+class TextureStreamer
+{
+public:
+  // TextureStreamer 클래스 생성자 (GLAD 초기화 이후에 생성해야 함. tailSize 이하 크기의 레벨들은 항상 올려둠)
+  explicit TextureStreamer(size_t budgetBytes, int tailSize = 64);
+
+  // TextureStreamer 클래스 소멸자 (I/O 스레드 종료 대기)
+  ~TextureStreamer();
+
+  TextureStreamer(const TextureStreamer &) = delete;
+  TextureStreamer &operator=(const TextureStreamer &) = delete;
+
+  // DDS 텍스쳐를 열고 작은 레벨들만 곧바로 업로드 (DDS 가 아니거나 읽을 수 없다면 valid() 가 false 인 핸들 반환)
+  StreamedTexture open(const std::string &path);
+
+  // 이번 프레임에 텍스쳐를 screenPixels 크기(가로, 세로 중 큰 쪽)로 그린다고 알리고, 바인딩할 텍스쳐 객체 반환
+  GLuint use(const StreamedTexture &texture, float screenPixels);
+
+  // 매 프레임마다 호출하여 읽기가 끝난 레벨을 budgetMs 안에서 업로드하고, 다음에 읽을 레벨들을 요청
+  void update(double budgetMs);
+
+  // GPU 에 올라와 있는 밉맵 레벨들의 크기 합
+  size_t residentBytes() const;
+
+  // GPU 메모리 예산 변경 (줄어든 만큼은 다음 update() 에서 LRU 로 내려놓음)
+  void setBudget(size_t budgetBytes);
+
+  // 스트리밍 및 내려놓은 레벨 수, 메모리 사용량 출력
+  void report() const;
+
+private:
+  // I/O 스레드에서 읽을 레벨 하나
+  struct Job
+  {
+    std::shared_ptr<StreamedTexture::Entry> entry;
+    int level;
+    std::string bytes; // 읽어온 압축된 블록 데이터
+    bool ok;
+  };
+
+  size_t budget;         // GPU 메모리 예산 (바이트)
+  int tailSize;          // 항상 올려두는 레벨의 최대 크기
+  unsigned long frame;   // update() 마다 증가하는 프레임 번호
+  size_t resident;       // 올라와 있는 레벨들의 크기 합
+  size_t reserved;       // 읽는 중인 레벨들의 크기 합 (업로드되면 resident 로 옮겨감)
+  size_t streamedLevels; // 스트리밍으로 업로드한 레벨 수
+  size_t evictedLevels;  // 예산 때문에 내려놓은 레벨 수
+
+  std::vector<std::shared_ptr<StreamedTexture::Entry> > entries; // 열려있는 텍스쳐들 (GL 스레드에서만 접근)
+
+  std::thread ioThread;                        // 레벨을 읽는 I/O 스레드
+  std::mutex mutex;                            // 아래의 큐 보호
+  std::condition_variable wakeUp;              // 읽을 레벨이 생겼거나 종료할 때 I/O 스레드를 깨움
+  std::deque<std::shared_ptr<Job> > jobs;      // 읽기 대기 중인 레벨들 (우선순위 순서)
+  std::deque<std::shared_ptr<Job> > completed; // 읽기가 끝나고 업로드 대기 중인 레벨들
+  bool stopping;                               // 소멸자에서 I/O 스레드 종료 요청
+
+  // I/O 스레드 루프
+  void run();
+
+  // 읽기가 끝난 레벨 하나를 업로드하고 GL_TEXTURE_BASE_LEVEL 을 낮춤
+  void upload(Job &job);
+
+  // 화면 크기에 비해 부족한 레벨을 우선순위 순서대로 I/O 스레드에 요청
+  void schedule();
+
+  // bytes 만큼의 예산이 생길 때까지 LRU 순서로 레벨을 내려놓음 (keep 의 레벨은 내려놓지 않음. 자리를 만들지 못하면 false 반환)
+  bool makeRoom(size_t bytes, const StreamedTexture::Entry *keep);
+
+  // 텍스쳐의 가장 세밀한 레벨 하나를 내려놓음
+  void evict(StreamedTexture::Entry &entry);
+};
+
+#endif // TEXTURE_STREAMER_HPP
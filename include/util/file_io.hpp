@@ -0,0 +1,87 @@
+#ifndef FILE_IO_HPP
+#define FILE_IO_HPP
+
+#include <cstddef> // size_t
+#include <cstdint> // uint64_t, int64_t
+#include <string>  // std::string
+#include <vector>  // std::vector
+
+/*
+  파일 입출력 유틸리티
+
+  std::ifstream -> std::stringstream -> std::string 으로 읽으면
+  파일 하나를 읽는 데 버퍼 복사가 세 번 일어나므로,
+  파일 크기를 먼저 조회해서 out 을 한 번에 할당한 뒤 read() 로 곧바로 읽어들임. (복사 없음)
+*/
+
+// 파일 내용 전체를 out 에 읽기 (실패 시 false 반환)
+bool readWholeFile(const std::string &path, std::string &out);
+
+// 파일(디렉토리 제외)이 존재하는지 여부 (파일을 열지 않고 stat 으로만 확인)
+bool fileExists(const std::string &path);
+
+// 파일 크기와 마지막 수정 시각
+struct FileStamp
+{
+  uint64_t size;
+  int64_t modified; // 마지막 수정 시각 (유닉스 시간, 초)
+};
+
+// 파일(디렉토리 제외)의 크기와 마지막 수정 시각 조회 (파일을 열지 않고 stat 으로만 확인)
+bool fileStamp(const std::string &path, FileStamp &out);
+
+// 마지막 수정 시각을 현재 시각으로 갱신
+bool touchFile(const std::string &path);
+
+// from 파일을 to 로 원자적으로 교체 (같은 파일 시스템 안에서만. to 가 이미 있다면 덮어씀)
+bool replaceFile(const std::string &from, const std::string &to);
+
+// 디렉토리 생성 (이미 있다면 true 반환. 상위 디렉토리는 만들지 않음)
+bool makeDirectory(const std::string &path);
+
+// 빈 디렉토리 삭제 (안에 파일이 남아있으면 실패함)
+bool removeDirectory(const std::string &path);
+
+// 디렉토리 안의 파일 이름 목록 (하위 디렉토리, ".", ".." 제외)
+bool listFiles(const std::string &directory, std::vector<std::string> &out);
+
+/*
+  MappedFile 클래스
+
+  파일 전체를 읽기 전용으로 메모리에 매핑(mmap, Windows 는 MapViewOfFile)하는 클래스!
+
+  readWholeFile() 과 달리 파일 크기만큼의 버퍼를 할당하거나 복사하지 않고,
+  실제로 접근한 페이지만 운영체제가 그때그때 페이지 캐시에서 읽어들임.
+  (에셋 팩처럼 큰 파일의 일부분만 골라서 읽을 때 유리함)
+
+  data() 가 가리키는 메모리는 close() 하거나 객체가 소멸될 때까지 유효함.
+*/
+class MappedFile
+{
+public:
+  MappedFile();
+  ~MappedFile();
+
+  MappedFile(const MappedFile &) = delete;
+  MappedFile &operator=(const MappedFile &) = delete;
+
+  // 파일을 읽기 전용으로 매핑 (이미 열려있던 파일은 먼저 닫음. 실패 시 false 반환)
+  bool open(const std::string &path);
+
+  // 매핑 해제
+  void close();
+
+  bool isOpen() const;
+  const char *data() const;
+  size_t size() const;
+
+private:
+  const char *address; // 매핑된 메모리 시작 주소
+  size_t length;       // 파일 크기
+#ifdef _WIN32
+  void *fileHandle;    // CreateFile() 로 연 파일 핸들
+  void *mappingHandle; // CreateFileMapping() 으로 만든 매핑 핸들
+#endif
+};
+
+#endif // FILE_IO_HPP
@@ -0,0 +1,47 @@
+#ifndef HASH_HPP
+#define HASH_HPP
+
+#include <string>  // std::string
+#include <cstdint> // uint64_t
+#include <cstddef> // size_t
+#include <cstdio>  // snprintf
+
+/*
+  FNV-1a 64비트 해시 유틸리티
+
+  암호학적으로 안전한 해시는 아니지만, 구현이 매우 간단하고 빠르기 때문에
+  쉐이더 소스코드나 에셋 경로처럼 '내용이 바뀌었는지' 만 구분하면 되는
+  캐시 키를 만들 때 사용함.
+
+  여러 개의 데이터를 이어서 해싱하려면, 이전 해시값을 seed 로 넘겨주면 됨.
+*/
+const uint64_t FNV1A64_OFFSET_BASIS = 14695981039346656037ull;
+const uint64_t FNV1A64_PRIME = 1099511628211ull;
+
+inline uint64_t fnv1a64(const void *data, size_t size, uint64_t seed = FNV1A64_OFFSET_BASIS)
+{
+  const unsigned char *bytes = static_cast<const unsigned char *>(data);
+  uint64_t hash = seed;
+  for (size_t i = 0; i < size; i++)
+  {
+    hash ^= bytes[i];
+    hash *= FNV1A64_PRIME;
+  }
+  return hash;
+}
+
+inline uint64_t fnv1a64(const std::string &str, uint64_t seed = FNV1A64_OFFSET_BASIS)
+{
+  // 문자열 경계를 구분하기 위해 '\0' 까지 포함하여 해싱 ("ab" + "c" 와 "a" + "bc" 가 같은 해시가 되지 않도록)
+  return fnv1a64(str.c_str(), str.size() + 1, seed);
+}
+
+// 해시값을 16자리 16진수 문자열로 변환 (캐시 파일명 등에 사용)
+inline std::string hashToHex(uint64_t hash)
+{
+  char buffer[17];
+  snprintf(buffer, sizeof(buffer), "%016llx", (unsigned long long)hash);
+  return std::string(buffer);
+}
+
+#endif // HASH_HPP
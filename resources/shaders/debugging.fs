@@ -1,15 +1,42 @@
 #version 330 core
 
+/*
+  쉐이더 변형(variant) 별로 ShaderVariants 가 #version 바로 다음에 삽입해주는 define 들
+
+  USE_TEXTURE : 텍스쳐 샘플링 색상 사용 (정의되지 않았다면 uv 좌표를 색상으로 출력)
+  ALPHA_TEST  : 알파값이 alphaCutoff 보다 작은 프래그먼트 discard
+*/
+
 // 프래그먼트 쉐이더 최종 색상 출력 변수 선언
 out vec4 FragColor;
 
 // 버텍스 쉐이더에서 보간되어 전송된 uv 좌표값 입력 변수 선언
 in vec2 TexCoords;
 
+#ifdef USE_TEXTURE
 // 텍스쳐 샘플러 변수 선언
 uniform sampler2D tex;
+#endif
+
+#ifdef ALPHA_TEST
+// 알파 테스트 기준값
+uniform float alphaCutoff;
+#endif
 
 void main() {
+#ifdef USE_TEXTURE
   // 텍스쳐 샘플링하여 적용
-  FragColor = texture(tex, TexCoords);
+  vec4 color = texture(tex, TexCoords);
+#else
+  // 텍스쳐 없이 uv 좌표를 색상으로 출력
+  vec4 color = vec4(TexCoords, 0.0, 1.0);
+#endif
+
+#ifdef ALPHA_TEST
+  if (color.a < alphaCutoff) {
+    discard;
+  }
+#endif
+
+  FragColor = color;
 }
@@ -4,14 +4,13 @@
 layout(location = 0) in vec3 position;
 layout(location = 1) in vec2 texCoords;
 
-// 변환행렬 관련 uniform 변수 선언
-uniform mat4 projection;
-uniform mat4 model;
+// 변환행렬 관련 유니폼 블록 선언 (Camera, Object)
+#include "uniform_blocks.glsl"
 
 // 프래그먼트 쉐이더로 출력할 uv 출력 변수 선언
 out vec2 TexCoords;
 
 void main() {
-  gl_Position = projection * model * vec4(position, 1.0);
+  gl_Position = projection * view * model * vec4(position, 1.0);
   TexCoords = texCoords;
 }
@@ -0,0 +1,25 @@
+#ifndef MATERIAL_ATLAS_GLSL
+#define MATERIAL_ATLAS_GLSL
+
+/*
+  TexturePacker 로 묶은 텍스쳐 배열에서 머티리얼의 텍스쳐를 샘플링하는 함수
+
+  같은 페이지(텍스쳐 배열)에 묶인 머티리얼들은 텍스쳐를 다시 바인딩하지 않고,
+  머티리얼 번호만 바꿔가며 Materials 블록에서 레이어와 uv 영역을 찾아 샘플링함.
+*/
+
+#include "material_blocks.glsl"
+
+vec4 sampleMaterial(sampler2DArray pages, int material, vec2 uv) {
+  MaterialSlot slot = materials[material];
+
+  // 아틀라스 안의 영역에서는 GL_REPEAT 이 동작하지 않으므로 fract() 로 직접 반복시킴
+  vec2 local = slot.uvRect.xy + fract(uv) * slot.uvRect.zw;
+
+  // fract() 의 경계에서 uv 가 튀면서 가장 흐린 밉맵이 선택되지 않도록, 밉맵 레벨은 원래 uv 의 변화량으로 계산함
+  vec2 dx = dFdx(uv) * slot.uvRect.zw;
+  vec2 dy = dFdy(uv) * slot.uvRect.zw;
+  return textureGrad(pages, vec3(local, slot.layer.x), dx, dy);
+}
+
+#endif // MATERIAL_ATLAS_GLSL
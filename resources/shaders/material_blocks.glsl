@@ -0,0 +1,22 @@
+#ifndef MATERIAL_BLOCKS_GLSL
+#define MATERIAL_BLOCKS_GLSL
+
+/*
+  텍스쳐 아틀라스 안에서 머티리얼마다의 위치를 담는 유니폼 블록 선언 (TexturePacker 가 채워줌. material_atlas.glsl 참고)
+
+  std140 블록은 쉐이더에서 사용하지 않더라도 활성(active) 블록으로 남으므로,
+  모든 쉐이더가 포함하는 uniform_blocks.glsl 과 분리해서 아틀라스를 샘플링하는 쉐이더만 포함하도록 함.
+  메모리 배치는 include/shader/uniform_blocks.hpp 의 MaterialsBlock 과 반드시 일치해야 함!
+*/
+#define MAX_MATERIAL_SLOTS 64
+
+struct MaterialSlot {
+  vec4 uvRect; // xy : 시작 uv, zw : 크기
+  vec4 layer;  // x : 텍스쳐 배열의 레이어
+};
+
+layout(std140) uniform Materials {
+  MaterialSlot materials[MAX_MATERIAL_SLOTS];
+};
+
+#endif // MATERIAL_BLOCKS_GLSL
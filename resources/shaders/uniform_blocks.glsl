@@ -0,0 +1,22 @@
+#ifndef UNIFORM_BLOCKS_GLSL
+#define UNIFORM_BLOCKS_GLSL
+
+/*
+  여러 쉐이더 프로그램이 공유하는 유니폼 블록 선언
+
+  각 블록은 Shader 클래스가 링킹 후 리플렉션으로 찾아서 고정 바인딩 포인트에 연결해 줌.
+  메모리 배치는 include/shader/uniform_blocks.hpp 의 구조체와 반드시 일치해야 함!
+*/
+
+// 프레임당 한 번 갱신되는 카메라 데이터
+layout(std140) uniform Camera {
+  mat4 projection;
+  mat4 view;
+};
+
+// 오브젝트마다 갱신되는 데이터
+layout(std140) uniform Object {
+  mat4 model;
+};
+
+#endif // UNIFORM_BLOCKS_GLSL
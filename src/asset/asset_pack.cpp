@@ -0,0 +1,356 @@
+#include "asset/asset_pack.hpp"
+#include "util/hash.hpp"
+
+#include <algorithm> // std::sort, std::replace
+#include <atomic>    // std::atomic
+#include <cstring>   // std::memcmp
+#include <fstream>   // 파일 입출력을 위한 헤더
+#include <iostream>  // 콘솔 입출력을 위한 헤더
+
+// 팩 파일 구조의 크기 및 상수
+static const char PACK_MAGIC[4] = {'G', 'L', 'P', 'K'};
+static const uint32_t PACK_VERSION = 1;
+static const size_t PACK_HEADER_SIZE = 32;
+static const size_t PACK_ENTRY_SIZE = 32;
+static const size_t PACK_DATA_ALIGNMENT = 64; // 캐시 라인 및 SIMD 로드에 맞춘 데이터 정렬
+
+// 리틀 엔디안 정수 읽기
+static uint32_t readUint32(const char *data)
+{
+  const uint8_t *p = reinterpret_cast<const uint8_t *>(data);
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint64_t readUint64(const char *data)
+{
+  return (uint64_t)readUint32(data) | ((uint64_t)readUint32(data + 4) << 32);
+}
+
+// 리틀 엔디안 정수 덧붙이기
+static void appendUint32(std::string &out, uint32_t value)
+{
+  for (int b = 0; b < 4; b++)
+    out += (char)(uint8_t)(value >> (8 * b));
+}
+
+static void appendUint64(std::string &out, uint64_t value)
+{
+  appendUint32(out, (uint32_t)value);
+  appendUint32(out, (uint32_t)(value >> 32));
+}
+
+// 인덱스의 항목 하나
+struct PackEntry
+{
+  uint64_t hash;
+  uint64_t offset;
+  uint64_t size;
+  uint32_t pathOffset;
+  uint32_t pathSize;
+};
+
+static PackEntry readEntry(const char *index, size_t i)
+{
+  const char *p = index + i * PACK_ENTRY_SIZE;
+  PackEntry entry;
+  entry.hash = readUint64(p);
+  entry.offset = readUint64(p + 8);
+  entry.size = readUint64(p + 16);
+  entry.pathOffset = readUint32(p + 24);
+  entry.pathSize = readUint32(p + 28);
+  return entry;
+}
+
+/** AssetPack 구현부 */
+
+// 앱 전체에서 공유하는 AssetPack 객체
+AssetPack &AssetPack::shared()
+{
+  static AssetPack pack;
+  return pack;
+}
+
+// AssetPack 클래스 생성자
+AssetPack::AssetPack()
+    : base(nullptr), index(nullptr), strings(nullptr), entryCount(0)
+{
+}
+
+// 팩 파일을 매핑하고 헤더와 인덱스를 검증
+bool AssetPack::mount(const std::string &path)
+{
+  index = nullptr;
+  if (!file.open(path))
+    return false;
+  if (!attach(file.data(), file.size(), path))
+  {
+    file.close();
+    return false;
+  }
+  return true;
+}
+
+// 메모리에 있는 팩(실행 파일에 포함된 배열 등)을 그대로 사용
+bool AssetPack::mountMemory(const char *data, size_t size, const std::string &name)
+{
+  file.close();
+  return attach(data, size, name);
+}
+
+// data 에 있는 팩의 헤더와 인덱스를 검증하고 조회에 사용할 주소들을 기록
+bool AssetPack::attach(const char *data, size_t size, const std::string &name)
+{
+  base = nullptr;
+  index = nullptr;
+  strings = nullptr;
+  entryCount = 0;
+
+  if (size < PACK_HEADER_SIZE || std::memcmp(data, PACK_MAGIC, 4) != 0 || readUint32(data + 4) != PACK_VERSION)
+  {
+    std::cout << "ERROR::ASSET_PACK::INVALID_HEADER: " << name << std::endl;
+    return false;
+  }
+
+  size_t count = readUint32(data + 8);
+  uint64_t indexOffset = readUint64(data + 16);
+  uint64_t stringsOffset = readUint64(data + 24);
+
+  /**
+   * 인덱스의 모든 항목이 팩 안을 가리키고, 해시 순서대로 정렬되어 있는지 미리 확인해둠 (이후 조회에서는 검사하지 않음)
+   *
+   * 손상된 팩의 오프셋과 크기는 더하면 uint64_t 범위를 넘어 작은 값으로 돌아올 수 있으므로,
+   * 덧셈 대신 남은 크기와 비교하는 뺄셈 형태로 검사함.
+   */
+  bool valid = indexOffset <= size && count <= (size - indexOffset) / PACK_ENTRY_SIZE && stringsOffset <= size;
+  for (size_t i = 0; valid && i < count; i++)
+  {
+    PackEntry entry = readEntry(data + indexOffset, i);
+    uint64_t stringsSize = size - stringsOffset;
+    valid = entry.offset <= size && entry.size <= size - entry.offset && entry.pathOffset <= stringsSize &&
+            entry.pathSize <= stringsSize - entry.pathOffset && (i == 0 || readEntry(data + indexOffset, i - 1).hash <= entry.hash);
+  }
+  if (!valid)
+  {
+    std::cout << "ERROR::ASSET_PACK::CORRUPTED_INDEX: " << name << std::endl;
+    return false;
+  }
+
+  base = data;
+  index = data + indexOffset;
+  strings = data + stringsOffset;
+  entryCount = count;
+  return true;
+}
+
+// 팩 파일이 마운트되었는지 여부
+bool AssetPack::isMounted() const
+{
+  return index != nullptr;
+}
+
+// 팩 안에 path 에 해당하는 에셋이 있다면 매핑된 메모리의 주소와 크기를 반환
+bool AssetPack::find(const std::string &path, const char *&data, size_t &size) const
+{
+  if (!index)
+    return false;
+
+  std::string key = normalize(path);
+  uint64_t hash = hashPath(key);
+
+  // 해시가 hash 이상인 첫 항목을 이진 탐색으로 찾음
+  size_t low = 0;
+  size_t high = entryCount;
+  while (low < high)
+  {
+    size_t middle = low + (high - low) / 2;
+    if (readEntry(index, middle).hash < hash)
+      low = middle + 1;
+    else
+      high = middle;
+  }
+
+  // 해시가 같은 항목들 중 경로까지 일치하는 항목 반환
+  for (size_t i = low; i < entryCount; i++)
+  {
+    PackEntry entry = readEntry(index, i);
+    if (entry.hash != hash)
+      break;
+    if (entry.pathSize == key.size() && key.compare(0, key.size(), strings + entry.pathOffset, entry.pathSize) == 0)
+    {
+      data = base + entry.offset;
+      size = (size_t)entry.size;
+      return true;
+    }
+  }
+  return false;
+}
+
+// 에셋 개수
+size_t AssetPack::count() const
+{
+  return entryCount;
+}
+
+// 팩 파일 작성
+bool AssetPack::write(const std::string &packPath, const std::vector<std::pair<std::string, std::string> > &files)
+{
+  struct Input
+  {
+    std::string key;
+    std::string contents;
+    uint64_t hash;
+
+    bool operator<(const Input &other) const
+    {
+      return hash != other.hash ? hash < other.hash : key < other.key;
+    }
+  };
+
+  std::vector<Input> inputs(files.size());
+  for (size_t i = 0; i < files.size(); i++)
+  {
+    inputs[i].key = normalize(files[i].first);
+    inputs[i].hash = hashPath(inputs[i].key);
+    if (!readWholeFile(files[i].second, inputs[i].contents))
+    {
+      std::cout << "ERROR::ASSET_PACK::FILE_NOT_SUCCESSFULLY_READ: " << files[i].second << std::endl;
+      return false;
+    }
+  }
+  std::sort(inputs.begin(), inputs.end());
+  for (size_t i = 1; i < inputs.size(); i++)
+  {
+    if (inputs[i].key == inputs[i - 1].key)
+    {
+      std::cout << "ERROR::ASSET_PACK::DUPLICATE_PATH: " << inputs[i].key << std::endl;
+      return false;
+    }
+  }
+
+  // 경로 문자열 영역
+  std::string pathTable;
+  std::vector<uint32_t> pathOffsets(inputs.size());
+  for (size_t i = 0; i < inputs.size(); i++)
+  {
+    pathOffsets[i] = (uint32_t)pathTable.size();
+    pathTable += inputs[i].key;
+  }
+
+  // 데이터 영역의 위치 계산 (에셋마다 PACK_DATA_ALIGNMENT 경계에서 시작)
+  uint64_t indexOffset = PACK_HEADER_SIZE;
+  uint64_t stringsOffset = indexOffset + inputs.size() * PACK_ENTRY_SIZE;
+  uint64_t cursor = stringsOffset + pathTable.size();
+  std::vector<uint64_t> dataOffsets(inputs.size());
+  for (size_t i = 0; i < inputs.size(); i++)
+  {
+    cursor = (cursor + PACK_DATA_ALIGNMENT - 1) / PACK_DATA_ALIGNMENT * PACK_DATA_ALIGNMENT;
+    dataOffsets[i] = cursor;
+    cursor += inputs[i].contents.size();
+  }
+
+  // 헤더 + 인덱스 + 경로 문자열
+  std::string header(PACK_MAGIC, 4);
+  appendUint32(header, PACK_VERSION);
+  appendUint32(header, (uint32_t)inputs.size());
+  appendUint32(header, 0);
+  appendUint64(header, indexOffset);
+  appendUint64(header, stringsOffset);
+  for (size_t i = 0; i < inputs.size(); i++)
+  {
+    appendUint64(header, inputs[i].hash);
+    appendUint64(header, dataOffsets[i]);
+    appendUint64(header, inputs[i].contents.size());
+    appendUint32(header, pathOffsets[i]);
+    appendUint32(header, (uint32_t)inputs[i].key.size());
+  }
+  header += pathTable;
+
+  std::ofstream out(packPath.c_str(), std::ios::binary);
+  out.write(header.data(), (std::streamsize)header.size());
+  uint64_t written = header.size();
+  for (size_t i = 0; i < inputs.size(); i++)
+  {
+    std::string padding((size_t)(dataOffsets[i] - written), '\0');
+    out.write(padding.data(), (std::streamsize)padding.size());
+    out.write(inputs[i].contents.data(), (std::streamsize)inputs[i].contents.size());
+    written = dataOffsets[i] + inputs[i].contents.size();
+  }
+  return out.good();
+}
+
+// 팩 안의 경로 정규화
+std::string AssetPack::normalize(const std::string &path)
+{
+  std::string out = path;
+  std::replace(out.begin(), out.end(), '\\', '/');
+  while (out.compare(0, 2, "./") == 0)
+    out.erase(0, 2);
+  return out;
+}
+
+// 경로 해시 (FNV-1a 64 비트)
+uint64_t AssetPack::hashPath(const std::string &path)
+{
+  return fnv1a64(path);
+}
+
+/** 에셋 조회 */
+
+// 팩과 디스크에서 읽은 에셋 통계 (I/O 스레드, 텍스쳐 워커 스레드에서도 갱신됨)
+static std::atomic<size_t> packedReads(0);
+static std::atomic<size_t> packedBytes(0);
+static std::atomic<size_t> diskReads(0);
+static std::atomic<size_t> diskBytes(0);
+
+// 에셋 파일 내용 전체를 out 에 읽기
+bool readAsset(const std::string &path, std::string &out)
+{
+  const char *data;
+  size_t size;
+  if (AssetPack::shared().find(path, data, size))
+  {
+    out.assign(data, size);
+    packedReads++;
+    packedBytes += size;
+    return true;
+  }
+  if (!readWholeFile(path, out))
+    return false;
+  diskReads++;
+  diskBytes += out.size();
+  return true;
+}
+
+// 에셋 내용을 가능하면 복사 없이 조회
+bool readAssetView(const std::string &path, std::string &storage, const char *&data, size_t &size)
+{
+  storage.clear();
+  if (AssetPack::shared().find(path, data, size))
+  {
+    packedReads++;
+    packedBytes += size;
+    return true;
+  }
+  if (!readWholeFile(path, storage))
+    return false;
+  data = storage.data();
+  size = storage.size();
+  diskReads++;
+  diskBytes += size;
+  return true;
+}
+
+// 에셋이 존재하는지 여부
+bool assetExists(const std::string &path)
+{
+  const char *data;
+  size_t size;
+  return AssetPack::shared().find(path, data, size) || fileExists(path);
+}
+
+// 지금까지 팩과 디스크에서 읽은 에셋 개수 및 크기 출력
+void reportAssetIo()
+{
+  std::cout << "ASSET_IO: " << packedReads << " assets (" << packedBytes << " bytes) from pack, " << diskReads << " files ("
+            << diskBytes << " bytes) from disk" << std::endl;
+}
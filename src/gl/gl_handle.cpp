@@ -0,0 +1,136 @@
+#include "gl/gl_handle.hpp"
+
+// 프로세스 전역에서 공유하는 삭제 큐
+GLDeletionQueue &GLDeletionQueue::shared()
+{
+  static GLDeletionQueue instance;
+  return instance;
+}
+
+// 삭제할 오브젝트 이름 추가
+void GLDeletionQueue::enqueue(GLResourceType type, GLuint name)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  pending[type].push_back(name);
+}
+
+// 삭제할 펜스 객체 추가
+void GLDeletionQueue::enqueueSync(GLsync sync)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  pendingSyncs.push_back(sync);
+}
+
+// 모아둔 오브젝트들을 종류별로 일괄 삭제
+void GLDeletionQueue::flush()
+{
+  // 펜스 객체는 개수가 적으므로 잠금을 잡은 채로 바로 삭제
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (size_t i = 0; i < pendingSyncs.size(); i++)
+    {
+      glDeleteSync(pendingSyncs[i]);
+    }
+    pendingSyncs.clear();
+  }
+
+  for (int type = 0; type < GL_RESOURCE_TYPE_COUNT; type++)
+  {
+    // 삭제 목록을 옮겨담은 뒤 잠금을 풀고 GL 함수를 호출 (다른 스레드의 enqueue() 를 오래 막지 않도록)
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      if (pending[type].empty())
+        continue;
+      flushing.swap(pending[type]);
+    }
+
+    GLsizei count = (GLsizei)flushing.size();
+    const GLuint *names = flushing.data();
+    switch (type)
+    {
+    case GL_RESOURCE_PROGRAM:
+      for (GLsizei i = 0; i < count; i++)
+        glDeleteProgram(names[i]);
+      break;
+    case GL_RESOURCE_SHADER:
+      for (GLsizei i = 0; i < count; i++)
+        glDeleteShader(names[i]);
+      break;
+    case GL_RESOURCE_BUFFER:
+      glDeleteBuffers(count, names);
+      break;
+    case GL_RESOURCE_VERTEX_ARRAY:
+      glDeleteVertexArrays(count, names);
+      break;
+    case GL_RESOURCE_TEXTURE:
+      glDeleteTextures(count, names);
+      break;
+    case GL_RESOURCE_SAMPLER:
+      glDeleteSamplers(count, names);
+      break;
+    case GL_RESOURCE_QUERY:
+      glDeleteQueries(count, names);
+      break;
+    case GL_RESOURCE_FRAMEBUFFER:
+      glDeleteFramebuffers(count, names);
+      break;
+    case GL_RESOURCE_PROGRAM_PIPELINE:
+      glDeleteProgramPipelines(count, names);
+      break;
+    default:
+      break;
+    }
+
+    // 메모리는 유지한 채로 비워서 다음 flush() 에서 재사용
+    flushing.clear();
+  }
+}
+
+// 아직 삭제되지 않은 오브젝트 개수
+size_t GLDeletionQueue::pendingCount()
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  size_t count = pendingSyncs.size();
+  for (int type = 0; type < GL_RESOURCE_TYPE_COUNT; type++)
+  {
+    count += pending[type].size();
+  }
+  return count;
+}
+
+// 종류에 맞는 glGen* / glCreate* 함수로 새로운 오브젝트 생성
+GLuint generateGLResource(GLResourceType type)
+{
+  GLuint name = 0;
+  switch (type)
+  {
+  case GL_RESOURCE_PROGRAM:
+    name = glCreateProgram();
+    break;
+  case GL_RESOURCE_BUFFER:
+    glGenBuffers(1, &name);
+    break;
+  case GL_RESOURCE_VERTEX_ARRAY:
+    glGenVertexArrays(1, &name);
+    break;
+  case GL_RESOURCE_TEXTURE:
+    glGenTextures(1, &name);
+    break;
+  case GL_RESOURCE_SAMPLER:
+    glGenSamplers(1, &name);
+    break;
+  case GL_RESOURCE_QUERY:
+    glGenQueries(1, &name);
+    break;
+  case GL_RESOURCE_FRAMEBUFFER:
+    glGenFramebuffers(1, &name);
+    break;
+  case GL_RESOURCE_PROGRAM_PIPELINE:
+    glGenProgramPipelines(1, &name);
+    break;
+  default:
+    // 쉐이더 오브젝트는 glCreateShader(stage) 로 직접 생성해서 ShaderHandle 에 넘겨줘야 함
+    break;
+  }
+  return name;
+}
@@ -0,0 +1,173 @@
+#include "gl/pixel_upload_ring.hpp"
+
+#include <chrono>   // 펜스 대기 시간 측정
+#include <cstring>  // std::memcpy
+#include <iostream> // 콘솔 입출력을 위한 헤더
+
+// 펜스 대기 시 한 번에 기다릴 최대 시간 (나노초)
+static const GLuint64 FENCE_TIMEOUT_NS = 1000000000;
+
+// 업로드마다 시작 오프셋을 맞춰줄 단위 (픽셀 타입의 크기 및 캐시 라인 크기의 배수)
+static const size_t OFFSET_ALIGNMENT = 64;
+
+// value 를 alignment 의 배수로 올림
+static size_t alignUp(size_t value, size_t alignment)
+{
+  return (value + alignment - 1) / alignment * alignment;
+}
+
+// PixelUploadRing 클래스 생성자
+PixelUploadRing::PixelUploadRing(size_t frameSize, unsigned int frameCount)
+    : frameSize(alignUp(frameSize, OFFSET_ALIGNMENT)), frameCount(frameCount > 0 ? frameCount : 1), frameIndex(0), offset(0),
+      mapped(nullptr), frames(0), ringBytes(0), peakBytes(0), ringUploads(0), directUploads(0), directBytes(0), stalls(0), stallMs(0.0)
+{
+  fences.resize(this->frameCount, nullptr);
+
+  GLsizeiptr totalSize = (GLsizeiptr)(this->frameSize * this->frameCount);
+  buffer = BufferHandle::generate();
+  glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer.get());
+
+  if (GLAD_GL_VERSION_4_4)
+  {
+    // 버퍼를 매핑한 상태로 계속 사용 (coherent 이므로 써넣은 데이터를 명시적으로 flush 할 필요 없음)
+    GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    glBufferStorage(GL_PIXEL_UNPACK_BUFFER, totalSize, nullptr, flags);
+    mapped = (unsigned char *)glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, totalSize, flags);
+    if (!mapped)
+    {
+      std::cout << "ERROR::PIXEL_UPLOAD_RING::MAP_FAILED" << std::endl;
+    }
+  }
+
+  if (!mapped)
+  {
+    // 영구 매핑을 사용할 수 없다면 일반적인 버퍼로 생성 (glBufferStorage 로 만든 버퍼는 크기를 다시 지정할 수 없으므로 새로 생성)
+    if (GLAD_GL_VERSION_4_4)
+    {
+      buffer = BufferHandle::generate();
+      glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer.get());
+    }
+    glBufferData(GL_PIXEL_UNPACK_BUFFER, totalSize, nullptr, GL_STREAM_DRAW);
+  }
+
+  // 픽셀 언팩 버퍼가 바인딩되어 있으면 다른 모든 업로드의 포인터가 버퍼 오프셋으로 해석되므로 반드시 해제
+  glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+}
+
+// PixelUploadRing 클래스 소멸자
+PixelUploadRing::~PixelUploadRing()
+{
+  // 펜스 객체는 삭제 큐로 넘김 (버퍼 객체는 삭제될 때 매핑도 함께 해제됨)
+  for (size_t i = 0; i < fences.size(); i++)
+  {
+    if (fences[i])
+      GLDeletionQueue::shared().enqueueSync(fences[i]);
+  }
+}
+
+// 영구 매핑(persistent mapping) 을 사용하는지 여부
+bool PixelUploadRing::isPersistent() const
+{
+  return mapped != nullptr;
+}
+
+// 새로운 프레임 시작
+void PixelUploadRing::beginFrame()
+{
+  offset = 0;
+
+  GLsync fence = fences[frameIndex];
+  if (!fence)
+    return;
+
+  // 기다리지 않고 먼저 확인해서, 이미 끝나 있다면 대기로 집계하지 않음
+  GLenum result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+  if (result == GL_TIMEOUT_EXPIRED)
+  {
+    // frameCount 프레임 전의 업로드가 아직 끝나지 않았음 (링이 작거나 GPU 가 밀려있음)
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    while (result == GL_TIMEOUT_EXPIRED)
+    {
+      result = glClientWaitSync(fence, 0, FENCE_TIMEOUT_NS);
+    }
+    stalls++;
+    stallMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+  }
+  if (result == GL_WAIT_FAILED)
+  {
+    std::cout << "ERROR::PIXEL_UPLOAD_RING::FENCE_WAIT_FAILED" << std::endl;
+  }
+
+  glDeleteSync(fence);
+  fences[frameIndex] = nullptr;
+}
+
+// 이번 프레임 구간에 남은 바이트 수
+size_t PixelUploadRing::remaining() const
+{
+  return frameSize - offset;
+}
+
+// 바인딩된 텍스쳐에 픽셀 언팩 버퍼를 통해 업로드
+bool PixelUploadRing::texSubImage2D(GLenum target, GLint level, GLint x, GLint y, GLsizei width, GLsizei height, GLenum format,
+                                    GLenum type, const void *pixels, size_t size)
+{
+  if (size > remaining())
+  {
+    // 남은 공간이 부족하면 기존처럼 클라이언트 메모리에서 업로드 (드라이버가 동기적으로 복사함)
+    glTexSubImage2D(target, level, x, y, width, height, format, type, pixels);
+    directUploads++;
+    directBytes += size;
+    return false;
+  }
+
+  size_t bufferOffset = frameIndex * frameSize + offset;
+  glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer.get());
+  if (mapped)
+  {
+    std::memcpy(mapped + bufferOffset, pixels, size);
+  }
+  else
+  {
+    glBufferSubData(GL_PIXEL_UNPACK_BUFFER, (GLintptr)bufferOffset, (GLsizeiptr)size, pixels);
+  }
+
+  // 픽셀 언팩 버퍼가 바인딩되어 있으므로 마지막 인자는 포인터가 아니라 버퍼 안의 오프셋으로 해석됨
+  glTexSubImage2D(target, level, x, y, width, height, format, type, reinterpret_cast<const void *>(bufferOffset));
+  glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+  // 다음 업로드의 시작 위치 정렬 (구간 끝을 넘어가면 남은 공간이 없는 것으로 처리)
+  offset = alignUp(offset + size, OFFSET_ALIGNMENT);
+  if (offset > frameSize)
+    offset = frameSize;
+
+  ringUploads++;
+  ringBytes += size;
+  return true;
+}
+
+// 프레임 종료
+void PixelUploadRing::endFrame()
+{
+  // 이번 프레임에 업로드한 바이트 수 (정렬로 생긴 여백 포함)
+  if (offset > peakBytes)
+    peakBytes = offset;
+
+  // 이번 프레임 구간을 사용했고, 드라이버가 동기화를 처리하지 않는 경우에만 펜스가 필요함
+  if (mapped && offset > 0)
+  {
+    fences[frameIndex] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+  }
+  frameIndex = (frameIndex + 1) % frameCount;
+  frames++;
+}
+
+// 프레임당 업로드 바이트 수, 링을 거치지 못한 업로드 수, 펜스 대기 횟수 출력
+void PixelUploadRing::report() const
+{
+  double averageKB = frames > 0 ? ringBytes / 1024.0 / frames : 0.0;
+  std::cout << "PIXEL_UPLOAD_RING: " << ringUploads << " uploads (" << ringBytes / 1024 << " KB) through "
+            << (mapped ? "persistent" : "glBufferSubData") << " PBO over " << frames << " frames, " << averageKB
+            << " KB/frame (peak " << peakBytes / 1024 << " KB of " << frameSize / 1024 << " KB), " << directUploads
+            << " direct uploads (" << directBytes / 1024 << " KB), " << stalls << " fence stalls (" << stallMs << " ms)" << std::endl;
+}
@@ -0,0 +1,146 @@
+#include "gl/uniform_ring.hpp"
+
+#include <cstring>  // std::memcpy
+#include <iostream> // 콘솔 입출력을 위한 헤더
+
+// 펜스 대기 시 한 번에 기다릴 최대 시간 (나노초)
+static const GLuint64 FENCE_TIMEOUT_NS = 1000000000;
+
+// value 를 alignment 의 배수로 올림
+static size_t alignUp(size_t value, size_t alignment)
+{
+  return (value + alignment - 1) / alignment * alignment;
+}
+
+// UniformRing 클래스 생성자
+UniformRing::UniformRing(size_t frameSize, unsigned int frameCount)
+    : frameCount(frameCount > 0 ? frameCount : 1), frameIndex(0), alignment(256), offset(0), mapped(nullptr)
+{
+  // 유니폼 블록에 연결할 구간의 시작 오프셋은 GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT 의 배수여야 함
+  GLint offsetAlignment = 0;
+  glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &offsetAlignment);
+  if (offsetAlignment > 0)
+    alignment = (size_t)offsetAlignment;
+
+  this->frameSize = alignUp(frameSize, alignment);
+  fences.resize(this->frameCount, nullptr);
+
+  GLsizeiptr totalSize = (GLsizeiptr)(this->frameSize * this->frameCount);
+  buffer = BufferHandle::generate();
+  glBindBuffer(GL_UNIFORM_BUFFER, buffer.get());
+
+  if (GLAD_GL_VERSION_4_4)
+  {
+    // 버퍼를 매핑한 상태로 계속 사용 (coherent 이므로 써넣은 데이터를 명시적으로 flush 할 필요 없음)
+    GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    glBufferStorage(GL_UNIFORM_BUFFER, totalSize, nullptr, flags);
+    mapped = (unsigned char *)glMapBufferRange(GL_UNIFORM_BUFFER, 0, totalSize, flags);
+    if (!mapped)
+    {
+      std::cout << "ERROR::UNIFORM_RING::MAP_FAILED" << std::endl;
+    }
+  }
+
+  if (!mapped)
+  {
+    // 영구 매핑을 사용할 수 없다면 일반적인 버퍼로 생성 (glBufferStorage 로 만든 버퍼는 크기를 다시 지정할 수 없으므로 새로 생성)
+    if (GLAD_GL_VERSION_4_4)
+    {
+      buffer = BufferHandle::generate();
+      glBindBuffer(GL_UNIFORM_BUFFER, buffer.get());
+    }
+    glBufferData(GL_UNIFORM_BUFFER, totalSize, nullptr, GL_STREAM_DRAW);
+  }
+
+  glBindBuffer(GL_UNIFORM_BUFFER, 0);
+}
+
+// UniformRing 클래스 소멸자
+UniformRing::~UniformRing()
+{
+  // 펜스 객체는 삭제 큐로 넘김 (버퍼 객체는 삭제될 때 매핑도 함께 해제됨)
+  for (size_t i = 0; i < fences.size(); i++)
+  {
+    if (fences[i])
+      GLDeletionQueue::shared().enqueueSync(fences[i]);
+  }
+}
+
+// 영구 매핑(persistent mapping) 을 사용하는지 여부
+bool UniformRing::isPersistent() const
+{
+  return mapped != nullptr;
+}
+
+// 새로운 프레임 시작
+void UniformRing::beginFrame()
+{
+  offset = 0;
+
+  GLsync fence = fences[frameIndex];
+  if (!fence)
+    return;
+
+  // frameCount 프레임 전에 이 구간을 읽던 GPU 명령들이 끝날 때까지 대기
+  // (보통은 이미 끝나 있으므로 곧바로 반환되며, 처음 한 번만 명령 버퍼를 flush 하도록 요청함)
+  GLbitfield waitFlags = GL_SYNC_FLUSH_COMMANDS_BIT;
+  while (true)
+  {
+    GLenum result = glClientWaitSync(fence, waitFlags, FENCE_TIMEOUT_NS);
+    if (result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED)
+      break;
+    if (result == GL_WAIT_FAILED)
+    {
+      std::cout << "ERROR::UNIFORM_RING::FENCE_WAIT_FAILED" << std::endl;
+      break;
+    }
+    waitFlags = 0;
+  }
+
+  glDeleteSync(fence);
+  fences[frameIndex] = nullptr;
+}
+
+// 데이터를 이번 프레임 구간에 써넣고 버퍼 내 오프셋 반환
+GLintptr UniformRing::push(const void *data, size_t size)
+{
+  if (offset + size > frameSize)
+  {
+    std::cout << "ERROR::UNIFORM_RING::FRAME_FULL: " << frameSize << " bytes" << std::endl;
+    return -1;
+  }
+
+  GLintptr bufferOffset = (GLintptr)(frameIndex * frameSize + offset);
+  if (mapped)
+  {
+    std::memcpy(mapped + bufferOffset, data, size);
+  }
+  else
+  {
+    glBindBuffer(GL_UNIFORM_BUFFER, buffer.get());
+    glBufferSubData(GL_UNIFORM_BUFFER, bufferOffset, (GLsizeiptr)size, data);
+  }
+
+  // 다음 데이터의 시작 위치도 바인딩 가능하도록 정렬
+  offset = alignUp(offset + size, alignment);
+  return bufferOffset;
+}
+
+// push() 로 써넣은 구간을 유니폼 블록 바인딩 포인트에 연결
+void UniformRing::bindRange(GLuint binding, GLintptr offset, size_t size) const
+{
+  if (offset < 0)
+    return;
+  glBindBufferRange(GL_UNIFORM_BUFFER, binding, buffer.get(), offset, (GLsizeiptr)size);
+}
+
+// 프레임 종료
+void UniformRing::endFrame()
+{
+  // glBufferSubData 를 사용하는 경우에는 드라이버가 동기화를 처리하므로 펜스가 필요없음
+  if (mapped)
+  {
+    fences[frameIndex] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+  }
+  frameIndex = (frameIndex + 1) % frameCount;
+}
@@ -0,0 +1,75 @@
+#include "gl/vertex_layout.hpp"
+
+// 정수 그대로 쉐이더에 전달되는지 여부
+bool VertexAttribute::isInteger() const
+{
+  if (normalized)
+    return false;
+
+  switch (type)
+  {
+  case GL_BYTE:
+  case GL_UNSIGNED_BYTE:
+  case GL_SHORT:
+  case GL_UNSIGNED_SHORT:
+  case GL_INT:
+  case GL_UNSIGNED_INT:
+    return true;
+  default:
+    return false;
+  }
+}
+
+// 버텍스 속성 추가
+VertexLayout &VertexLayout::add(GLuint location, GLint components, GLenum type, GLsizei stride, size_t offset,
+                                GLboolean normalized)
+{
+  VertexAttribute attribute;
+  attribute.location = location;
+  attribute.components = components;
+  attribute.type = type;
+  attribute.normalized = normalized;
+  attribute.stride = stride;
+  attribute.offset = offset;
+  attributes.push_back(attribute);
+  return *this;
+}
+
+// 현재 바인딩된 VAO 와 GL_ARRAY_BUFFER 에 버텍스 속성들을 설정
+void VertexLayout::apply() const
+{
+  for (size_t i = 0; i < attributes.size(); i++)
+  {
+    const VertexAttribute &attribute = attributes[i];
+    glEnableVertexAttribArray(attribute.location);
+
+    if (attribute.isInteger())
+    {
+      // 정규화하지 않는 정수 속성은 float 로 변환되지 않도록 glVertexAttribIPointer 로 설정
+      glVertexAttribIPointer(attribute.location, attribute.components, attribute.type, attribute.stride,
+                             (void *)attribute.offset);
+    }
+    else
+    {
+      glVertexAttribPointer(attribute.location, attribute.components, attribute.type, attribute.normalized,
+                            attribute.stride, (void *)attribute.offset);
+    }
+  }
+}
+
+// location 에 해당하는 버텍스 속성 (없으면 nullptr)
+const VertexAttribute *VertexLayout::find(GLuint location) const
+{
+  for (size_t i = 0; i < attributes.size(); i++)
+  {
+    if (attributes[i].location == location)
+      return &attributes[i];
+  }
+  return nullptr;
+}
+
+// 등록된 버텍스 속성 목록
+const std::vector<VertexAttribute> &VertexLayout::getAttributes() const
+{
+  return attributes;
+}
@@ -7,15 +7,16 @@
     APIs: gl=4.5
     Profile: compatibility
     Extensions:
-        GL_KHR_debug
+        GL_KHR_debug,
+        GL_KHR_parallel_shader_compile
     Loader: True
     Local files: False
     Omit khrplatform: False
 
     Commandline:
-        --profile="compatibility" --api="gl=4.5" --generator="c" --spec="gl" --extensions="GL_KHR_debug"
+        --profile="compatibility" --api="gl=4.5" --generator="c" --spec="gl" --extensions="GL_KHR_debug,GL_KHR_parallel_shader_compile"
     Online:
-        http://glad.dav1d.de/#profile=compatibility&language=c&specification=gl&loader=on&api=gl%3D4.5&extensions=GL_KHR_debug
+        http://glad.dav1d.de/#profile=compatibility&language=c&specification=gl&loader=on&api=gl%3D4.5&extensions=GL_KHR_debug&extensions=GL_KHR_parallel_shader_compile
 */
 
 #include <stdio.h>
@@ -1322,6 +1323,8 @@ PFNGLGETOBJECTLABELKHRPROC glad_glGetObjectLabelKHR;
 PFNGLOBJECTPTRLABELKHRPROC glad_glObjectPtrLabelKHR;
 PFNGLGETOBJECTPTRLABELKHRPROC glad_glGetObjectPtrLabelKHR;
 PFNGLGETPOINTERVKHRPROC glad_glGetPointervKHR;
+int GLAD_GL_KHR_parallel_shader_compile;
+PFNGLMAXSHADERCOMPILERTHREADSKHRPROC glad_glMaxShaderCompilerThreadsKHR;
 static void load_GL_VERSION_1_0(GLADloadproc load)
 {
   if (!GLAD_GL_VERSION_1_0)
@@ -2488,11 +2491,18 @@ static void load_GL_KHR_debug(GLADloadproc load)
   glad_glGetObjectPtrLabelKHR = (PFNGLGETOBJECTPTRLABELKHRPROC)load("glGetObjectPtrLabelKHR");
   glad_glGetPointervKHR = (PFNGLGETPOINTERVKHRPROC)load("glGetPointervKHR");
 }
+static void load_GL_KHR_parallel_shader_compile(GLADloadproc load)
+{
+  if (!GLAD_GL_KHR_parallel_shader_compile)
+    return;
+  glad_glMaxShaderCompilerThreadsKHR = (PFNGLMAXSHADERCOMPILERTHREADSKHRPROC)load("glMaxShaderCompilerThreadsKHR");
+}
 static int find_extensionsGL(void)
 {
   if (!get_exts())
     return 0;
   GLAD_GL_KHR_debug = has_ext("GL_KHR_debug");
+  GLAD_GL_KHR_parallel_shader_compile = has_ext("GL_KHR_parallel_shader_compile");
   free_exts();
   return 1;
 }
@@ -2595,5 +2605,6 @@ int gladLoadGLLoader(GLADloadproc load)
   if (!find_extensionsGL())
     return 0;
   load_GL_KHR_debug(load);
+  load_GL_KHR_parallel_shader_compile(load);
   return GLVersion.major != 0 || GLVersion.minor != 0;
 }
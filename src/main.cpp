@@ -8,10 +8,28 @@
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
 
+#include <gl/gl_handle.hpp>
+#include <gl/vertex_layout.hpp>
+#include <gl/uniform_ring.hpp>
+#include <gl/pixel_upload_ring.hpp>
 #include <shader/shader.hpp>
+#include <shader/shader_library.hpp>
+#include <shader/shader_pipeline.hpp>
+#include <shader/shader_stats.hpp>
+#include <shader/shader_variants.hpp>
+#include <shader/uniform_batch.hpp>
+#include <shader/uniform_blocks.hpp>
+#include <texture/pixel_cache.hpp>
+#include <texture/texture_loader.hpp>
+#include <texture/texture_streamer.hpp>
+#include <asset/asset_pack.hpp>
+#include <asset/embedded_assets.hpp>
 
 #include <iostream>
+#include <chrono>
+#include <cmath>
 #include <string>
+#include <vector>
 
 /** 콜백함수 전방 선언 */
 
@@ -25,6 +43,63 @@ void processInput(GLFWwindow *window);
 const unsigned int SCR_WIDTH = 800;
 const unsigned int SCR_HEIGHT = 600;
 
+/** debugging.fs 쉐이더 변형(variant) 비트마스크 */
+const unsigned int VARIANT_USE_TEXTURE = 1u << 0; // 텍스쳐 샘플링 사용
+const unsigned int VARIANT_ALPHA_TEST = 1u << 1;  // 알파 테스트 사용
+
+/**
+ * 분리형 쉐이더 오브젝트(프로그램 파이프라인) 경로 사용 여부
+ * (OpenGL 4.1 미만이면 무시되고 기존 Shader 경로를 사용. 파이프라인 경로에서는 핫 리로드가 동작하지 않음)
+ */
+const bool USE_SEPARATE_SHADER_OBJECTS = false;
+
+/**
+ * 쉐이더 파일 디렉토리
+ * (CMake 의 SHADER_OFFLINE_BUILD 옵션을 켜면 빌드 시점에 검증 및 minify 된 쉐이더를 빌드 디렉토리에서 읽음)
+ */
+#ifdef OFFLINE_SHADER_DIR
+const std::string SHADER_DIR = OFFLINE_SHADER_DIR;
+#else
+const std::string SHADER_DIR = "resources/shaders";
+#endif
+
+/**
+ * 텍스쳐 파일 디렉토리 및 나무 상자 텍스쳐 파일명
+ * (CMake 의 TEXTURE_COOK 옵션을 켜면 빌드 시점에 블록 압축된 DDS 를 빌드 디렉토리에서 읽음)
+ */
+#ifdef COOKED_TEXTURE_DIR
+const std::string TEXTURE_DIR = COOKED_TEXTURE_DIR;
+const std::string WOOD_TEXTURE_NAME = "wood.dds";
+#else
+const std::string TEXTURE_DIR = "resources/textures";
+const std::string WOOD_TEXTURE_NAME = "wood.png";
+#endif
+
+/**
+ * 에셋 팩 안의 쉐이더 및 텍스쳐 디렉토리
+ * (CMake 의 ASSET_PACK 옵션을 켜면 위의 파일들을 빌드 시점에 하나의 팩 파일로 묶어두고, 시작할 때 매핑하여 팩 안의 경로로 읽음.
+ *  팩 파일이 없다면 디스크의 파일들을 그대로 읽음.
+ *  EMBED_RESOURCES 옵션을 켜면 팩이 실행 파일 안에 포함되므로, 실행 위치와 상관없이 파일 시스템 접근 없이 읽음)
+ */
+const std::string PACKED_SHADER_DIR = "shaders";
+const std::string PACKED_TEXTURE_DIR = "textures";
+
+/** 병렬 쉐이더 컴파일 미지원 시, 프레임당 쉐이더 컴파일에 사용할 시간 예산 (ms) */
+const double SHADER_COMPILE_BUDGET_MS = 4.0;
+
+/** 프레임당 텍스쳐 업로드에 사용할 시간 예산 (ms) */
+const double TEXTURE_UPLOAD_BUDGET_MS = 2.0;
+
+/** 밉맵 레벨 스트리밍에 사용할 GPU 메모리 예산 (MB) */
+const size_t TEXTURE_STREAMING_BUDGET_MB = 256;
+
+/** 프레임당 픽셀 언팩 버퍼 링을 통해 업로드할 수 있는 최대 크기 (MB. 이보다 큰 텍스쳐는 다음 프레임으로 미뤄짐) */
+const size_t TEXTURE_UPLOAD_RING_MB = 8;
+
+/** 디코딩된 텍스쳐 픽셀을 저장해둘 디스크 캐시 디렉토리 및 최대 크기 (MB. 넘어서면 오래 사용되지 않은 파일부터 삭제됨) */
+const char *TEXTURE_CACHE_DIR = "texture_cache";
+const size_t TEXTURE_CACHE_LIMIT_MB = 512;
+
 /**
  * glGetError() 를 wrapping 하여 에러를 출력하는 함수를 매크로 전처리기로 정의
  *
@@ -186,6 +261,24 @@ void APIENTRY glDebugOutput(GLenum source,
 
 int main()
 {
+  // 첫 프레임을 그리기까지 걸린 시간 측정 시작
+  std::chrono::steady_clock::time_point startupStart = std::chrono::steady_clock::now();
+
+  // 에셋 팩 매핑 (실행 파일에 포함된 팩이 있다면 그것을 사용하고, 팩이 없다면 디스크의 쉐이더와 텍스쳐 파일들을 읽음)
+#if defined(EMBEDDED_RESOURCES)
+  bool packMounted = AssetPack::shared().mountMemory(reinterpret_cast<const char *>(EMBEDDED_ASSET_PACK), EMBEDDED_ASSET_PACK_SIZE, "<embedded>");
+#elif defined(ASSET_PACK_PATH)
+  bool packMounted = AssetPack::shared().mount(ASSET_PACK_PATH);
+#else
+  bool packMounted = false;
+#endif
+  if (packMounted)
+  {
+    std::cout << "ASSET_PACK: " << AssetPack::shared().count() << " assets mapped" << std::endl;
+  }
+  const std::string shaderDir = packMounted ? PACKED_SHADER_DIR : SHADER_DIR;
+  const std::string textureDir = packMounted ? PACKED_TEXTURE_DIR : TEXTURE_DIR;
+
   // GLFW 초기화 및 윈도우 설정 구성
   glfwInit();
   glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
@@ -246,11 +339,40 @@ int main()
   glEnable(GL_DEPTH_TEST);
   glEnable(GL_CULL_FACE);
 
-  // Shader 객체 생성
-  Shader shader("resources/shaders/debugging.vs", "resources/shaders/debugging.fs");
+  // 프로그램 바이너리 캐시 생성 (두 번째 실행부터는 쉐이더 컴파일 및 링킹을 건너뜀)
+  ProgramCache programCache("shader_cache");
+
+  // 쉐이더 #include 검색 경로 등록 (쉐이더 파일과 같은 디렉토리에서 찾지 못한 파일은 여기서 찾음)
+  ShaderPreprocessor::shared().addSearchPath(shaderDir);
+
+  // 이번 씬에서 사용할 쉐이더 파일들을 I/O 스레드에서 미리 읽어둠 (#include 로 포함된 파일들도 함께 읽힘)
+  std::vector<std::string> sceneShaders;
+  sceneShaders.push_back(shaderDir + "/debugging.vs");
+  sceneShaders.push_back(shaderDir + "/debugging.fs");
+  ShaderPreprocessor::shared().prefetch(sceneShaders);
+
+  // 유니폼 블록 이름별 고정 바인딩 포인트 등록 (쉐이더 프로그램이 링킹될 때마다 리플렉션으로 찾아서 연결됨)
+  Shader::setUniformBlockBinding("Camera", UNIFORM_BINDING_CAMERA);
+  Shader::setUniformBlockBinding("Object", UNIFORM_BINDING_OBJECT);
+
+  // 프레임마다 갱신되는 유니폼 블록 데이터를 써넣을 링 버퍼 (한 프레임당 64KB)
+  UniformRing uniformRing(64 * 1024);
+
+  // 쉐이더 소스 파일 감시 (쉐이더 파일을 수정하면 앱을 재시작하지 않아도 자동으로 재컴파일됨)
+  ShaderWatcher shaderWatcher;
+
+  // 쉐이더 라이브러리 생성 (렌더링 루프를 막지 않고 백그라운드에서 컴파일됨)
+  ShaderLibrary shaderLibrary(&programCache);
+
+  // debugging.fs 쉐이더 변형 관리 (각 변형은 처음 요청될 때에만 컴파일됨)
+  std::vector<std::string> variantDefines;
+  variantDefines.push_back("USE_TEXTURE"); // VARIANT_USE_TEXTURE
+  variantDefines.push_back("ALPHA_TEST");  // VARIANT_ALPHA_TEST
+  ShaderVariants debuggingShaders(shaderLibrary, shaderDir + "/debugging.vs", shaderDir + "/debugging.fs", variantDefines, 4);
 
   /** cube VAO, VBO 설정 */
-  unsigned int cubeVAO, cubeVBO;
+  VertexArrayHandle cubeVAO;
+  BufferHandle cubeVBO;
   float vertices[] = {
       // back face
       -0.5f, -0.5f, -0.5f, 0.0f, 0.0f, // bottom-left
@@ -297,52 +419,72 @@ int main()
   };
 
   // VAO, VBO 객체 생성
-  glGenVertexArrays(1, &cubeVAO);
-  glGenBuffers(1, &cubeVBO);
+  cubeVAO = VertexArrayHandle::generate();
+  cubeVBO = BufferHandle::generate();
 
   // VBO 객체에 메모리 할당 및 데이터 쓰기
-  glBindBuffer(GL_ARRAY_BUFFER, cubeVBO);
+  glBindBuffer(GL_ARRAY_BUFFER, cubeVBO.get());
   glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
 
   // VAO 객체 설정 및 정점 데이터 해석 방식 정의
-  glBindVertexArray(cubeVAO);
-  glEnableVertexAttribArray(0);
-  glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void *)0);
-  glEnableVertexAttribArray(1);
-  glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void *)(3 * sizeof(float)));
+  // (쉐이더의 입력 변수와 일치하는지 확인할 수 있도록 VertexLayout 으로 기술해 둠)
+  VertexLayout cubeLayout;
+  cubeLayout.add(0, 3, GL_FLOAT, 5 * sizeof(float), 0);                 // layout(location = 0) in vec3 position
+  cubeLayout.add(1, 2, GL_FLOAT, 5 * sizeof(float), 3 * sizeof(float)); // layout(location = 1) in vec2 texCoords
+  glBindVertexArray(cubeVAO.get());
+  cubeLayout.apply();
 
   // VAO 객체 설정 완료 후 바인딩 해제
   glBindBuffer(GL_ARRAY_BUFFER, 0);
   glBindVertexArray(0);
 
   /** cube Texture 로드 */
-  unsigned int texture;
-  glGenTextures(1, &texture);
-  glBindTexture(GL_TEXTURE_2D, texture);
-  int width, height, nrComponents;
-  unsigned char *data = stbi_load("resources/textures/wood.png", &width, &height, &nrComponents, 0);
-  if (data)
+  // 블록 압축된 DDS 라면 작은 밉맵 레벨들만 곧바로 올리고, 화면에 보이는 크기에 필요한 레벨까지 백그라운드에서 스트리밍함
+  TextureStreamer textureStreamer(TEXTURE_STREAMING_BUDGET_MB * 1024 * 1024);
+  StreamedTexture woodStream = textureStreamer.open(textureDir + "/" + WOOD_TEXTURE_NAME);
+
+  // 그 외의 이미지는 디코딩은 워커 스레드에서 진행되고, 업로드가 끝나기 전까지는 1x1 대체 텍스쳐가 바인딩됨
+  // (디코딩된 픽셀 데이터는 픽셀 언팩 버퍼 링을 통해 업로드되므로, 드라이버의 동기적인 복사를 기다리지 않음)
+  // (디코딩 결과는 디스크 캐시에 저장되므로, 두 번째 실행부터는 캐시 파일을 매핑해서 디코딩을 건너뜀)
+  PixelUploadRing textureUploadRing(TEXTURE_UPLOAD_RING_MB * 1024 * 1024);
+  PixelCache texturePixelCache(TEXTURE_CACHE_DIR, (unsigned long long)TEXTURE_CACHE_LIMIT_MB * 1024 * 1024);
+  TextureLoader textureLoader;
+  textureLoader.setUploadRing(&textureUploadRing);
+  textureLoader.setDiskCache(&texturePixelCache);
+  TextureFuture woodTexture;
+  if (!woodStream.valid())
   {
-    // glTexImage2D(GL_FRAMEBUFFER, 0, GL_RGB, width, height, 0, GL_RGB, GL_UNSIGNED_BYTE, data); // error version
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, width, height, 0, GL_RGB, GL_UNSIGNED_BYTE, data);
-    glGenerateMipmap(GL_TEXTURE_2D);
-
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    woodTexture = textureLoader.submit(textureDir + "/" + WOOD_TEXTURE_NAME);
   }
-  else
+
+  /** projection matrix 계산 */
+  CameraBlock camera;
+  camera.projection = glm::perspective(glm::radians(45.0f), (float)SCR_WIDTH / (float)SCR_HEIGHT, 0.1f, 10.0f);
+
+  // 카메라로부터 2.5 만큼 떨어진 크기 1 의 큐브 면이 화면에서 차지하는 대략적인 크기 (픽셀. 텍스쳐 스트리밍의 우선순위로 사용)
+  const float cubeScreenPixels = (float)SCR_HEIGHT / (2.0f * 2.5f * std::tan(glm::radians(45.0f) * 0.5f));
+  camera.view = glm::mat4(1.0f);
+  // 분리형 쉐이더 오브젝트 경로 : 스테이지별로 한 번씩만 링킹하고, 스테이지 조합은 파이프라인 객체로 캐싱
+  ShaderPipelineCache pipelineCache;
+  const ShaderStage *cubeVertexStage = nullptr;
+  const ShaderStage *cubeFragmentStage = nullptr;
+  if (USE_SEPARATE_SHADER_OBJECTS && pipelineCache.isSupported())
   {
-    std::cout << "Failed to load texture" << std::endl;
+    cubeVertexStage = pipelineCache.getStage(GL_VERTEX_SHADER, shaderDir + "/debugging.vs");
+    cubeFragmentStage = pipelineCache.getStage(GL_FRAGMENT_SHADER, shaderDir + "/debugging.fs",
+                                               debuggingShaders.makeDefines(VARIANT_USE_TEXTURE));
+    if (cubeVertexStage && cubeFragmentStage)
+    {
+      // VAO 설정 검증은 버텍스 스테이지만, 텍스쳐 유닛은 프래그먼트 스테이지에만 전송하면 됨
+      cubeVertexStage->getReflection().validate(cubeLayout, "cubeVAO");
+      glProgramUniform1i(cubeFragmentStage->ID.get(), cubeFragmentStage->getUniformLocation("tex"), 0);
+    }
   }
-  stbi_image_free(data);
+  bool usePipeline = cubeVertexStage && cubeFragmentStage;
 
-  /** projection matrix 계산 및 쉐이더 전송 */
-  glm::mat4 projection = glm::perspective(glm::radians(45.0f), (float)SCR_WIDTH / (float)SCR_HEIGHT, 0.1f, 10.0f);
-  shader.use();
-  shader.setMat4("projection", projection);
-  shader.setInt("tex", 0);
+  Shader *initializedShader = nullptr; // VAO 설정 검증 및 핫 리로드 등록을 마친 쉐이더
+  UniformBatch cubeUniforms;           // 큐브를 그릴 때 사용할 기본 블록 유니폼 값
+  bool reportedShaderStats = false;    // 시작 시점의 쉐이더 컴파일 비용 리포트 출력 여부
 
   /** rendering loop */
   while (!glfwWindowShouldClose(window))
@@ -353,31 +495,126 @@ int main()
     glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
-    // 쉐이더 바인딩
-    shader.use();
+    // 지난 프레임 동안 소멸된 OpenGL 오브젝트들을 한꺼번에 삭제
+    GLDeletionQueue::shared().flush();
+
+    // 쉐이더 컴파일 진행 상태 갱신
+    shaderLibrary.update(SHADER_COMPILE_BUDGET_MS);
+
+    // 디코딩이 끝난 텍스쳐 업로드 (모두 업로드되면 디코딩 처리량과 업로드 링 통계를 한 번만 출력)
+    textureUploadRing.beginFrame();
+    if (textureLoader.pendingCount() > 0)
+    {
+      textureLoader.update(TEXTURE_UPLOAD_BUDGET_MS);
+      if (textureLoader.pendingCount() == 0)
+      {
+        textureLoader.report();
+        textureUploadRing.report();
+        texturePixelCache.report();
+      }
+    }
+    textureUploadRing.endFrame();
+
+    // 읽기가 끝난 밉맵 레벨 업로드 및 지난 프레임에 그린 크기에 맞춰 다음 레벨 요청
+    textureStreamer.update(TEXTURE_UPLOAD_BUDGET_MS);
 
-    // model matrix 계산 및 쉐이더 전송
+    // 수정된 쉐이더 파일이 있다면 재컴파일 및 교체 (교체된 프로그램에는 uniform 변수들을 다시 전송해야 함)
+    if (shaderWatcher.poll())
+    {
+      initializedShader = nullptr;
+    }
+
+    // 쉐이더 컴파일이 아직 끝나지 않았다면 이번 프레임은 그리지 않고 넘어감
+    Shader *shader = usePipeline ? nullptr : debuggingShaders.get(VARIANT_USE_TEXTURE).get();
+    if (!usePipeline && !shader)
+    {
+      glfwSwapBuffers(window);
+      glfwPollEvents();
+      continue;
+    }
+
+    // 시작 시점에 요청한 쉐이더들의 컴파일이 모두 끝나면, 컴파일 비용이 큰 순서대로 한 번만 출력
+    if (!reportedShaderStats && shaderLibrary.pendingCount() == 0)
+    {
+      ShaderStats::shared().report();
+      reportedShaderStats = true;
+    }
+
+    // 유니폼 링 버퍼의 이번 프레임 구간 사용 시작 후, 카메라 데이터는 프레임당 한 번만 써넣음
+    uniformRing.beginFrame();
+    GLintptr cameraOffset = uniformRing.push(&camera, sizeof(camera));
+    uniformRing.bindRange(UNIFORM_BINDING_CAMERA, cameraOffset, sizeof(camera));
+
+    if (usePipeline)
+    {
+      // 프로그램 파이프라인 바인딩 (유니폼 블록 및 텍스쳐 유닛은 스테이지 생성 시 이미 설정됨)
+      pipelineCache.bind(cubeVertexStage, cubeFragmentStage);
+    }
+    else
+    {
+      // 쉐이더 바인딩
+      shader->use();
+
+      // 컴파일(또는 재컴파일) 완료 후 처음 사용하는 시점에 한 번만 VAO 설정 검증 및 핫 리로드 등록
+      if (initializedShader != shader)
+      {
+        shader->getReflection().validate(cubeLayout, "cubeVAO");
+        if (!packMounted)
+          shader->enableHotReload(shaderWatcher); // 팩 안의 쉐이더는 수정할 수 없으므로 감시하지 않음
+        initializedShader = shader;
+      }
+
+      // 기본 블록 유니폼은 매 프레임 설정하더라도 값이 바뀌었거나 쉐이더가 바뀐 경우에만 실제로 전송됨
+      cubeUniforms.setInt("tex", 0);
+      cubeUniforms.flush(*shader);
+    }
+
+    // model matrix 계산 후 링 버퍼에 써넣고 Object 블록에 연결 (오브젝트당 glBindBufferRange() 한 번)
     float rotationSpeed = 10.0f;
     float angle = (float)glfwGetTime() * rotationSpeed;
-    glm::mat4 model = glm::mat4(1.0f);
-    model = glm::translate(model, glm::vec3(0.0f, 0.0f, -2.5f));
-    model = glm::rotate(model, glm::radians(angle), glm::vec3(1.0f, 1.0f, 1.0f));
-    shader.setMat4("model", model);
+    ObjectBlock object;
+    object.model = glm::mat4(1.0f);
+    object.model = glm::translate(object.model, glm::vec3(0.0f, 0.0f, -2.5f));
+    object.model = glm::rotate(object.model, glm::radians(angle), glm::vec3(1.0f, 1.0f, 1.0f));
+    GLintptr objectOffset = uniformRing.push(&object, sizeof(object));
+    uniformRing.bindRange(UNIFORM_BINDING_OBJECT, objectOffset, sizeof(object));
 
     // draw call
-    glBindTexture(GL_TEXTURE_2D, texture);
-    glBindVertexArray(cubeVAO);
+    glBindTexture(GL_TEXTURE_2D, woodStream.valid() ? textureStreamer.use(woodStream, cubeScreenPixels) : woodTexture.get());
+    glBindVertexArray(cubeVAO.get());
     glDrawArrays(GL_TRIANGLES, 0, 36);
     glBindVertexArray(0);
 
+    // 이번 프레임 구간에 펜스를 걸어둠 (GPU 가 다 읽기 전에는 같은 구간을 다시 덮어쓰지 않음)
+    uniformRing.endFrame();
+
     // Back 버퍼에 렌더링된 최종 이미지를 Front 버퍼에 교체 -> blinking 현상 방지
     glfwSwapBuffers(window);
 
+    // 실제로 큐브를 그린 첫 프레임까지 걸린 시간 출력
+    if (startupStart != std::chrono::steady_clock::time_point())
+    {
+      std::cout << "STARTUP::FIRST_FRAME: "
+                << std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startupStart).count() << " ms" << std::endl;
+
+      // 첫 프레임까지 에셋을 팩과 디스크 중 어디에서 얼마나 읽었는지 출력 (낱개 파일 모드와 팩 / 내장 모드의 시작 시 I/O 비교용)
+      reportAssetIo();
+      startupStart = std::chrono::steady_clock::time_point();
+    }
+
     // 키보드, 마우스 입력 이벤트 발생 검사 후 등록된 콜백함수 호출 + 이벤트 발생에 따른 GLFWwindow 상태 업데이트
     glfwPollEvents();
   }
 
-  // GLFW 종료 및 메모리 반납
+  // 스트리밍된 레벨 수 및 GPU 메모리 사용량 출력
+  if (woodStream.valid())
+  {
+    textureStreamer.report();
+  }
+
+  // 남아있는 삭제 요청 처리 후 GLFW 종료 및 메모리 반납
+  // (이후 main() 을 빠져나가면서 소멸되는 핸들들은 삭제 큐에 쌓이기만 하므로, 컨텍스트가 사라진 뒤에도 안전함)
+  GLDeletionQueue::shared().flush();
   glfwTerminate();
 
   return 0;
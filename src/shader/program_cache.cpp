@@ -0,0 +1,244 @@
+#include "shader/program_cache.hpp"
+#include "util/file_io.hpp"
+#include "util/hash.hpp"
+
+#include <fstream>  // 파일 입출력을 위한 헤더
+#include <iostream> // 콘솔 입출력을 위한 헤더
+#include <vector>   // std::vector
+#include <cstdio>   // std::remove
+
+// 바이너리 파일 헤더에 기록할 매직 넘버 ('GLPB') 및 파일 포맷 버전
+static const unsigned int PROGRAM_BINARY_MAGIC = 0x42504C47;
+// (버전 2 : 바이너리 뒤에 리플렉션 메타데이터 추가)
+static const unsigned int PROGRAM_BINARY_FILE_VERSION = 2;
+
+// ProgramCache 클래스 생성자
+ProgramCache::ProgramCache(const std::string &directory, unsigned long long maxBytes)
+    : directory(directory), maxBytes(maxBytes), totalBytes(0), useCounter(0), supported(false), indexDirty(false)
+{
+  /**
+   * glGetProgramBinary() 와 glProgramBinary() 는 OpenGL 4.1 부터 core 로 편입된 기능이고,
+   * 4.1 이상이더라도 드라이버가 지원하는 바이너리 포맷이 하나도 없을 수 있으므로
+   * GL_NUM_PROGRAM_BINARY_FORMATS 까지 확인해야 함.
+   */
+  if (GLAD_GL_VERSION_4_1)
+  {
+    int numFormats = 0;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &numFormats);
+    supported = numFormats > 0;
+  }
+
+  // 드라이버가 바뀌면 기존 바이너리는 호환되지 않으므로, 드라이버 정보를 캐시 키에 포함시킴
+  const char *vendor = (const char *)glGetString(GL_VENDOR);
+  const char *renderer = (const char *)glGetString(GL_RENDERER);
+  const char *version = (const char *)glGetString(GL_VERSION);
+  driverInfo = std::string(vendor ? vendor : "") + "\n" + (renderer ? renderer : "") + "\n" + (version ? version : "");
+
+  if (supported)
+  {
+    makeDirectory(directory);
+    loadIndex();
+  }
+}
+
+// ProgramCache 클래스 소멸자
+ProgramCache::~ProgramCache()
+{
+  // 캐시 로드 시 갱신된 LRU 정보를 인덱스 파일에 반영
+  if (indexDirty)
+  {
+    saveIndex();
+  }
+}
+
+// 현재 드라이버가 프로그램 바이너리 저장 및 로드를 지원하는지 여부
+bool ProgramCache::isSupported() const
+{
+  return supported;
+}
+
+// 쉐이더 소스코드와 드라이버 정보를 해싱하여 캐시 키 생성
+std::string ProgramCache::makeKey(const std::string &vertexCode, const std::string &fragmentCode) const
+{
+  uint64_t hash = fnv1a64(vertexCode);
+  hash = fnv1a64(fragmentCode, hash);
+  hash = fnv1a64(driverInfo, hash);
+  return hashToHex(hash);
+}
+
+// 캐시된 바이너리를 program 에 로드 (드라이버가 바이너리를 거부하면 false 반환)
+bool ProgramCache::load(const std::string &key, unsigned int program, std::string *metadata)
+{
+  if (!supported)
+    return false;
+
+  std::map<std::string, Entry>::iterator it = entries.find(key);
+  if (it == entries.end())
+    return false;
+
+  // 헤더 읽기
+  std::ifstream file(entryPath(key).c_str(), std::ios::binary);
+  unsigned int header[5] = {0, 0, 0, 0, 0}; // magic, file version, binary format, binary length, metadata length
+  if (!file.read(reinterpret_cast<char *>(header), sizeof(header)) ||
+      header[0] != PROGRAM_BINARY_MAGIC || header[1] != PROGRAM_BINARY_FILE_VERSION)
+  {
+    remove(key);
+    return false;
+  }
+
+  /**
+   * 잘리거나 손상된 파일의 길이 값으로 버퍼를 할당하면 std::bad_alloc 이 발생하거나 수 GB 를 할당할 수 있으므로,
+   * 헤더에 기록된 길이가 실제 파일에 남은 크기와 맞는지 먼저 확인함. (맞지 않으면 캐시 미스로 처리)
+   */
+  FileStamp stamp;
+  if (!fileStamp(entryPath(key), stamp) || stamp.size < sizeof(header) ||
+      (unsigned long long)header[3] + header[4] != stamp.size - sizeof(header))
+  {
+    remove(key);
+    return false;
+  }
+
+  // 바이너리 데이터 및 메타데이터 읽기
+  std::vector<char> binary(header[3]);
+  std::string storedMetadata(header[4], '\0');
+  if (!file.read(binary.data(), binary.size()) || (header[4] > 0 && !file.read(&storedMetadata[0], header[4])))
+  {
+    remove(key);
+    return false;
+  }
+
+  /**
+   * 드라이버는 자신이 생성하지 않은 바이너리나 호환되지 않는 바이너리를 거부할 수 있음.
+   * 이 경우 glProgramBinary() 는 에러를 발생시키지 않고, 단지 GL_LINK_STATUS 를 GL_FALSE 로 설정하므로
+   * 링킹 상태를 확인해서 실패하면 해당 캐시 항목을 삭제하고 소스코드 컴파일로 되돌아가도록 함.
+   */
+  glProgramBinary(program, (GLenum)header[2], binary.data(), (GLsizei)binary.size());
+
+  int success = 0;
+  glGetProgramiv(program, GL_LINK_STATUS, &success);
+  if (!success)
+  {
+    remove(key);
+    return false;
+  }
+
+  if (metadata)
+  {
+    metadata->swap(storedMetadata);
+  }
+
+  it->second.lastUse = ++useCounter;
+  indexDirty = true;
+  return true;
+}
+
+// 링킹이 완료된 program 의 바이너리를 캐시에 저장
+void ProgramCache::store(const std::string &key, unsigned int program, const std::string &metadata)
+{
+  if (!supported)
+    return;
+
+  int length = 0;
+  glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+  if (length <= 0)
+    return;
+
+  std::vector<char> binary(length);
+  GLenum format = 0;
+  glGetProgramBinary(program, length, NULL, &format, binary.data());
+
+  std::ofstream file(entryPath(key).c_str(), std::ios::binary | std::ios::trunc);
+  unsigned int header[5] = {PROGRAM_BINARY_MAGIC, PROGRAM_BINARY_FILE_VERSION, (unsigned int)format, (unsigned int)length,
+                            (unsigned int)metadata.size()};
+  file.write(reinterpret_cast<const char *>(header), sizeof(header));
+  file.write(binary.data(), binary.size());
+  file.write(metadata.data(), metadata.size());
+  if (!file)
+  {
+    std::cout << "ERROR::PROGRAM_CACHE::FILE_NOT_SUCCESSFULLY_WRITTEN: " << entryPath(key) << std::endl;
+    return;
+  }
+  file.close();
+
+  // 같은 키로 다시 저장하는 경우 기존 크기를 먼저 빼줌
+  std::map<std::string, Entry>::iterator it = entries.find(key);
+  if (it != entries.end())
+  {
+    totalBytes -= it->second.size;
+  }
+
+  Entry entry;
+  entry.size = sizeof(header) + (unsigned long long)length + metadata.size();
+  entry.lastUse = ++useCounter;
+  entries[key] = entry;
+  totalBytes += entry.size;
+
+  evict();
+  saveIndex();
+}
+
+// 캐시 키에 해당하는 바이너리 파일 경로
+std::string ProgramCache::entryPath(const std::string &key) const
+{
+  return directory + "/" + key + ".bin";
+}
+
+// 캐시 인덱스 파일 읽기 ("키 크기 마지막사용시점" 형태의 텍스트 라인들)
+void ProgramCache::loadIndex()
+{
+  std::ifstream index((directory + "/index.txt").c_str());
+
+  std::string key;
+  Entry entry;
+  while (index >> key >> entry.size >> entry.lastUse)
+  {
+    entries[key] = entry;
+    totalBytes += entry.size;
+    if (entry.lastUse > useCounter)
+    {
+      useCounter = entry.lastUse;
+    }
+  }
+}
+
+// 캐시 인덱스 파일 쓰기
+void ProgramCache::saveIndex()
+{
+  std::ofstream index((directory + "/index.txt").c_str(), std::ios::trunc);
+  for (std::map<std::string, Entry>::const_iterator it = entries.begin(); it != entries.end(); ++it)
+  {
+    index << it->first << " " << it->second.size << " " << it->second.lastUse << "\n";
+  }
+  indexDirty = false;
+}
+
+// 캐시 항목 삭제
+void ProgramCache::remove(const std::string &key)
+{
+  std::map<std::string, Entry>::iterator it = entries.find(key);
+  if (it == entries.end())
+    return;
+
+  totalBytes -= it->second.size;
+  entries.erase(it);
+  std::remove(entryPath(key).c_str());
+  indexDirty = true;
+}
+
+// 캐시 크기가 maxBytes 이하가 될 때까지 오래된 항목부터 삭제
+void ProgramCache::evict()
+{
+  while (totalBytes > maxBytes && !entries.empty())
+  {
+    // 가장 오랫동안 사용되지 않은 항목 탐색 (캐시 항목 수가 많지 않으므로 선형 탐색으로 충분함)
+    std::map<std::string, Entry>::iterator oldest = entries.begin();
+    for (std::map<std::string, Entry>::iterator it = entries.begin(); it != entries.end(); ++it)
+    {
+      if (it->second.lastUse < oldest->second.lastUse)
+      {
+        oldest = it;
+      }
+    }
+    remove(oldest->first);
+  }
+}
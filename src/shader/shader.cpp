@@ -1,163 +1,484 @@
 #include "shader/shader.hpp"
+#include "shader/shader_stats.hpp"
 
-// Shader 클래스 생성자
-Shader::Shader(const GLchar *vertexPath, const GLchar *fragmentPath)
+#include <chrono> // 컴파일 및 링킹 시간 측정
+#include <thread> // std::this_thread::yield
+#include <vector> // std::vector
+
+// start 부터 현재까지 흐른 시간 (ms)
+static double elapsedMs(std::chrono::steady_clock::time_point start)
 {
-  // 쉐이더 코드를 std::string 타입으로 파싱하여 저장할 변수 선언
-  std::string vertexCode;
-  std::string fragmentCode;
+  return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
 
-  // std::ifstream을 사용하여 파일 읽기
-  std::ifstream vShaderFile;
-  std::ifstream fShaderFile;
+// 쉐이더 파일을 읽고 #include 를 펼친 뒤 #define 블록을 삽입한 코드를 std::string 타입으로 반환
+std::string Shader::loadShaderSource(const GLchar *path, const std::string &defines)
+{
+  // 여러 쉐이더가 공유하는 헤더 파일은 프로세스 전역 전처리기 캐시를 통해 한 번만 읽고 펼쳐짐
+  std::string code = ShaderPreprocessor::shared().process(path);
+  if (code.empty())
+    return code;
+  return ShaderPreprocessor::injectDefines(code, defines);
+}
 
-  // 파일 열기와 예외 처리
-  vShaderFile.exceptions(std::ifstream::failbit | std::ifstream::badbit);
-  fShaderFile.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+// Shader 클래스 생성자
+Shader::Shader(const GLchar *vertexPath, const GLchar *fragmentPath, ProgramCache *cache)
+    : vertexPath(vertexPath), fragmentPath(fragmentPath), watcher(nullptr)
+{
+  // 쉐이더 프로그램별 컴파일 비용 측정 결과 (ShaderStats 에 기록됨)
+  ShaderTiming timing;
+  timing.vertexPath = vertexPath;
+  timing.fragmentPath = fragmentPath;
 
-  try
-  {
-    // 파일 열기
-    vShaderFile.open(vertexPath);
-    fShaderFile.open(fragmentPath);
-
-    // 파일 스트림을 문자열로 읽기
-    std::stringstream vShaderStream, fShaderStream;
-    vShaderStream << vShaderFile.rdbuf();
-    fShaderStream << fShaderFile.rdbuf();
-
-    // 파일 스트림 닫기
-    vShaderFile.close();
-    fShaderFile.close();
-
-    // 문자열로 파싱
-    vertexCode = vShaderStream.str();
-    fragmentCode = fShaderStream.str();
-  }
-  catch (std::ifstream::failure &e)
-  {
-    std::cout << "ERROR::SHADER::FILE_NOT_SUCCESSFULLY_READ" << e.what() << std::endl;
-  }
+  // 쉐이더 코드를 읽고 #include 를 펼쳐서 std::string 타입으로 저장
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  std::string vertexCode = loadShaderSource(vertexPath);
+  std::string fragmentCode = loadShaderSource(fragmentPath);
+  timing.readMs = elapsedMs(start);
+  timing.sourceBytes = vertexCode.size() + fragmentCode.size();
 
   // C 스타일 문자열로 변환
   const char *vShaderCode = vertexCode.c_str();
   const char *fShaderCode = fragmentCode.c_str();
 
-  // 쉐이더 객체 생성 및 컴파일
-  unsigned int vertex, fragment;
+  // 쉐이더 프로그램 객체 생성
+  ID = ProgramHandle::generate();
+
+  // 프로그램 바이너리 캐시가 주어졌다면, 컴파일 전에 캐시된 바이너리 로드를 먼저 시도
+  std::string cacheKey;
+  if (cache && cache->isSupported())
+  {
+    cacheKey = cache->makeKey(vertexCode, fragmentCode);
+    std::string reflectionData;
+    start = std::chrono::steady_clock::now();
+    if (cache->load(cacheKey, ID.get(), &reflectionData))
+    {
+      // 캐시 적중 시 컴파일 및 링킹 과정을 모두 건너뛰고, 함께 저장된 리플렉션 메타데이터를 복원
+      // (유니폼 블록 바인딩은 바이너리에 포함된다는 보장이 없으므로 다시 연결)
+      timing.cached = true;
+      timing.linkMs = elapsedMs(start);
+      ShaderStats::shared().record(timing);
+      initReflection(reflectionData);
+      return;
+    }
+
+    // 드라이버가 바이너리를 거부했을 수도 있으므로, 깨끗한 프로그램 객체로 다시 시작 (기존 객체는 삭제 큐로 넘어감)
+    ID = ProgramHandle::generate();
+
+    // 링킹 후 glGetProgramBinary() 로 바이너리를 가져올 것임을 드라이버에게 미리 알려줌
+    glProgramParameteri(ID.get(), GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+  }
 
-  // 버텍스 쉐이더 생성 및 컴파일
-  vertex = glCreateShader(GL_VERTEX_SHADER);
-  glShaderSource(vertex, 1, &vShaderCode, NULL);
-  glCompileShader(vertex);
-  checkCompileErrors(vertex, "VERTEX");
+  // 쉐이더 객체 생성 및 컴파일 (생성자가 끝나면 핸들이 소멸되면서 삭제 큐로 넘어감)
+  ShaderHandle vertex(glCreateShader(GL_VERTEX_SHADER));
+  ShaderHandle fragment(glCreateShader(GL_FRAGMENT_SHADER));
 
-  // 프래그먼트 쉐이더 생성 및 컴파일
-  fragment = glCreateShader(GL_FRAGMENT_SHADER);
-  glShaderSource(fragment, 1, &fShaderCode, NULL);
-  glCompileShader(fragment);
-  checkCompileErrors(fragment, "FRAGMENT");
+  /**
+   * 버텍스 / 프래그먼트 쉐이더 컴파일과 링킹을 모두 요청한 뒤에 상태를 조회함.
+   *
+   * 상태 조회(glGetShaderiv 등)는 해당 작업이 끝날 때까지 기다리게 만드므로, 스테이지마다 곧바로 에러를 확인하면
+   * 드라이버가 두 스테이지를 병렬로 컴파일할 수 없음. (각 glCompileShader() / glLinkProgram() 호출 시간은 요청 비용만 측정됨)
+   */
+  std::chrono::steady_clock::time_point compileStart = std::chrono::steady_clock::now();
+  glShaderSource(vertex.get(), 1, &vShaderCode, NULL);
+  glCompileShader(vertex.get());
+  timing.vertexMs = elapsedMs(compileStart);
 
-  // 쉐이더 프로그램 객체 생성 및 쉐이더 객체 연결
-  ID = glCreateProgram();
-  glAttachShader(ID, vertex);
-  glAttachShader(ID, fragment);
-  glLinkProgram(ID);
-  checkCompileErrors(ID, "PROGRAM");
+  start = std::chrono::steady_clock::now();
+  glShaderSource(fragment.get(), 1, &fShaderCode, NULL);
+  glCompileShader(fragment.get());
+  timing.fragmentMs = elapsedMs(start);
 
-  // 쉐이더 객체 삭제
-  glDeleteShader(vertex);
-  glDeleteShader(fragment);
+  // 쉐이더 프로그램 객체에 쉐이더 객체 연결 및 링킹
+  glAttachShader(ID.get(), vertex.get());
+  glAttachShader(ID.get(), fragment.get());
+  start = std::chrono::steady_clock::now();
+  glLinkProgram(ID.get());
+  timing.linkMs = elapsedMs(start);
+
+  // 실제 완료 시점은 GL_COMPLETION_STATUS_KHR 를 폴링해서 측정 (이 조회는 기다리지 않고 곧바로 반환됨)
+  if (GLAD_GL_KHR_parallel_shader_compile)
+  {
+    int completed = GL_FALSE;
+    glGetProgramiv(ID.get(), GL_COMPLETION_STATUS_KHR, &completed);
+    while (!completed)
+    {
+      std::this_thread::yield();
+      glGetProgramiv(ID.get(), GL_COMPLETION_STATUS_KHR, &completed);
+    }
+    timing.completionMs = elapsedMs(compileStart);
+  }
+
+  // 모든 작업을 요청한 뒤에 스테이지별 에러 확인
+  checkCompileErrors(vertex.get(), "VERTEX");
+  checkCompileErrors(fragment.get(), "FRAGMENT");
+  bool linked = checkCompileErrors(ID.get(), "PROGRAM");
+  ShaderStats::shared().record(timing);
+
+  if (linked)
+  {
+    initReflection("");
+  }
+
+  // 링킹에 성공한 프로그램은 다음 실행을 위해 리플렉션 메타데이터와 함께 바이너리 캐시에 저장
+  if (linked && !cacheKey.empty())
+  {
+    cache->store(cacheKey, ID.get(), metadata.serialize());
+  }
+}
+
+// 이미 링킹이 완료된 쉐이더 프로그램 객체의 소유권을 넘겨받는 생성자
+Shader::Shader(unsigned int program, const std::string &vertexPath, const std::string &fragmentPath, const std::string &defines,
+               const std::string &reflectionData)
+    : ID(program), vertexPath(vertexPath), fragmentPath(fragmentPath), defines(defines), watcher(nullptr)
+{
+  initReflection(reflectionData);
 }
 
 // Shader 클래스 소멸자
 Shader::~Shader()
 {
-  // 쉐이더 프로그램 객체 메모리 반납
-  glDeleteProgram(ID);
+  // 핫 리로드 감시 대상에서 제거
+  // (쉐이더 프로그램 객체 및 재컴파일 중이던 객체들은 핸들이 소멸되면서 삭제 큐로 넘어감)
+  if (watcher)
+  {
+    watcher->remove(this);
+  }
+}
+
+// 이동 생성자
+Shader::Shader(Shader &&other)
+    : ID(std::move(other.ID)), vertexPath(std::move(other.vertexPath)), fragmentPath(std::move(other.fragmentPath)),
+      defines(std::move(other.defines)), metadata(std::move(other.metadata)), watcher(nullptr)
+{
+  takeOverHotReload(other);
+}
+
+// 이동 대입 연산자
+Shader &Shader::operator=(Shader &&other)
+{
+  if (this != &other)
+  {
+    if (watcher)
+    {
+      watcher->remove(this);
+      watcher = nullptr;
+    }
+    discardReload();
+
+    ID = std::move(other.ID);
+    vertexPath = std::move(other.vertexPath);
+    fragmentPath = std::move(other.fragmentPath);
+    defines = std::move(other.defines);
+    metadata = std::move(other.metadata);
+    takeOverHotReload(other);
+  }
+  return *this;
 }
 
 // ShaderProgram 객체 활성화
 void Shader::use()
 {
-  glUseProgram(ID);
+  glUseProgram(ID.get());
+}
+
+// 쉐이더 소스 파일이 수정되면 자동으로 재컴파일하도록 ShaderWatcher 에 등록
+void Shader::enableHotReload(ShaderWatcher &watcher)
+{
+  // 이미 등록되어 있거나, 소스 파일 경로를 알 수 없는 Shader 객체는 등록하지 않음
+  if (this->watcher == &watcher || vertexPath.empty() || fragmentPath.empty())
+    return;
+
+  if (this->watcher)
+  {
+    this->watcher->remove(this);
+  }
+  this->watcher = &watcher;
+  watcher.add(this, vertexPath, fragmentPath, defines);
+}
+
+// 새로운 쉐이더 코드로 재컴파일 시작
+void Shader::beginReload(const std::string &vertexCode, const std::string &fragmentCode)
+{
+  // 이전 재컴파일이 아직 끝나지 않았다면 버리고 새로 시작
+  discardReload();
+
+  const char *vShaderCode = vertexCode.c_str();
+  const char *fShaderCode = fragmentCode.c_str();
+
+  /**
+   * 컴파일 상태를 곧바로 조회하지 않고 링킹까지 요청만 해둠.
+   *
+   * GL_KHR_parallel_shader_compile 을 지원하는 드라이버에서는 이 작업들이 드라이버의
+   * 컴파일러 스레드에서 백그라운드로 처리되고, finishReload() 에서 완료 여부만 확인함.
+   */
+  reloadVertex.reset(glCreateShader(GL_VERTEX_SHADER));
+  glShaderSource(reloadVertex.get(), 1, &vShaderCode, NULL);
+  glCompileShader(reloadVertex.get());
+
+  reloadFragment.reset(glCreateShader(GL_FRAGMENT_SHADER));
+  glShaderSource(reloadFragment.get(), 1, &fShaderCode, NULL);
+  glCompileShader(reloadFragment.get());
+
+  reloadProgram = ProgramHandle::generate();
+  glAttachShader(reloadProgram.get(), reloadVertex.get());
+  glAttachShader(reloadProgram.get(), reloadFragment.get());
+  glLinkProgram(reloadProgram.get());
+}
+
+// 재컴파일이 끝났다면 결과 처리 후 true 반환
+bool Shader::finishReload(bool &replaced)
+{
+  replaced = false;
+  if (!reloadProgram)
+    return true;
+
+  // 병렬 컴파일 지원 시, 아직 완료되지 않았다면 다음 프레임에 다시 확인
+  if (GLAD_GL_KHR_parallel_shader_compile)
+  {
+    int completed = GL_FALSE;
+    glGetProgramiv(reloadProgram.get(), GL_COMPLETION_STATUS_KHR, &completed);
+    if (completed != GL_TRUE)
+      return false;
+  }
+
+  bool vertexCompiled = checkCompileErrors(reloadVertex.get(), "VERTEX");
+  bool fragmentCompiled = checkCompileErrors(reloadFragment.get(), "FRAGMENT");
+  bool linked = vertexCompiled && fragmentCompiled && checkCompileErrors(reloadProgram.get(), "PROGRAM");
+
+  if (linked)
+  {
+    // 기존 프로그램을 새로운 프로그램으로 교체 (기존 프로그램은 삭제 큐로 넘어감)
+    ID = std::move(reloadProgram);
+    initReflection("");
+    replaced = true;
+  }
+  else
+  {
+    // 컴파일 실패 시 기존 프로그램을 그대로 사용
+    std::cout << "ERROR::SHADER::HOT_RELOAD_FAILED: keeping previous program (" << vertexPath << ", " << fragmentPath << ")" << std::endl;
+  }
+
+  discardReload();
+  return true;
+}
+
+// 재컴파일 중인 쉐이더 객체 및 프로그램 객체 메모리 반납
+void Shader::discardReload()
+{
+  reloadVertex.reset();
+  reloadFragment.reset();
+  reloadProgram.reset();
+}
+
+// 다른 Shader 객체에서 이동해 온 경우, 핫 리로드 등록을 새로운 주소로 옮김
+void Shader::takeOverHotReload(Shader &other)
+{
+  // 진행 중이던 재컴파일은 이동 전 주소로 관리되고 있으므로 버림 (다음 파일 수정 시 다시 재컴파일됨)
+  other.discardReload();
+
+  // ShaderWatcher 는 Shader 객체의 주소로 감시 대상을 관리하므로, 새로운 주소로 다시 등록
+  if (other.watcher)
+  {
+    ShaderWatcher &otherWatcher = *other.watcher;
+    otherWatcher.remove(&other);
+    other.watcher = nullptr;
+    enableHotReload(otherWatcher);
+  }
+}
+
+// 유니폼 블록 이름 -> 고정 바인딩 포인트 (정적 초기화 순서 문제를 피하기 위해 함수 내 static 으로 보관)
+std::map<std::string, unsigned int> &Shader::uniformBlockBindings()
+{
+  static std::map<std::string, unsigned int> bindings;
+  return bindings;
+}
+
+// 유니폼 블록 이름에 고정 바인딩 포인트 지정
+void Shader::setUniformBlockBinding(const std::string &blockName, unsigned int binding)
+{
+  uniformBlockBindings()[blockName] = binding;
+}
+
+// 링킹 후 리플렉션으로 찾은 유니폼 블록 중에 blockName 이 있는지 여부
+bool Shader::hasUniformBlock(const std::string &blockName) const
+{
+  return metadata.findUniformBlock(blockName) != nullptr;
+}
+
+// 링킹 시점에 조회한 입력 변수, 유니폼 변수, 유니폼 블록 메타데이터
+const ShaderReflection &Shader::getReflection() const
+{
+  return metadata;
+}
+
+// 리플렉션 메타데이터를 복원하거나 새로 조회한 뒤, 유니폼 블록 바인딩
+void Shader::initReflection(const std::string &reflectionData)
+{
+  if (reflectionData.empty() || !ShaderReflection::deserialize(reflectionData, metadata))
+  {
+    metadata = ShaderReflection::reflect(ID.get());
+  }
+  bindUniformBlocks();
+}
+
+// 리플렉션으로 찾은 유니폼 블록들을 지정된 바인딩 포인트에 연결
+void Shader::bindUniformBlocks()
+{
+  bindUniformBlocks(ID.get(), metadata, vertexPath);
+}
+
+// program 의 유니폼 블록들을 지정된 바인딩 포인트에 연결 (label 은 에러 메시지에 함께 출력됨)
+void Shader::bindUniformBlocks(unsigned int program, const ShaderReflection &reflection, const std::string &label)
+{
+  const std::map<std::string, unsigned int> &bindings = uniformBlockBindings();
+  const std::vector<ShaderUniformBlock> &blocks = reflection.getUniformBlocks();
+  for (size_t i = 0; i < blocks.size(); i++)
+  {
+    std::map<std::string, unsigned int>::const_iterator it = bindings.find(blocks[i].name);
+    if (it == bindings.end())
+    {
+      std::cout << "ERROR::SHADER::UNKNOWN_UNIFORM_BLOCK: " << blocks[i].name << " (" << label << ")" << std::endl;
+      continue;
+    }
+    glUniformBlockBinding(program, blocks[i].index, it->second);
+  }
+}
+
+// 유니폼 변수 location 조회
+GLint Shader::getUniformLocation(const std::string &name) const
+{
+  // 링킹 시점에 조회해 둔 메타데이터에서 이진 탐색 (드라이버 호출 없음)
+  // (배열 유니폼은 메타데이터에 "name[0]" 으로 기록되어 있음)
+  const ShaderUniform *uniform = metadata.findUniform(name);
+  if (!uniform)
+    uniform = metadata.findUniform(name + "[0]");
+  if (uniform)
+    return uniform->location;
+
+  // "lights[3]" 처럼 배열의 중간 원소를 가리키는 이름은 드라이버에 직접 조회
+  if (name.find('[') != std::string::npos)
+    return glGetUniformLocation(ID.get(), name.c_str());
+  return -1;
 }
 
 // 유니폼 변수 관련 유틸리티
 void Shader::setBool(const std::string &name, bool value) const
 {
-  glUniform1i(glGetUniformLocation(ID, name.c_str()), (int)value);
+  glUniform1i(getUniformLocation(name), (int)value);
 }
 
 void Shader::setInt(const std::string &name, int value) const
 {
-  glUniform1i(glGetUniformLocation(ID, name.c_str()), value);
+  glUniform1i(getUniformLocation(name), value);
 }
 
 void Shader::setFloat(const std::string &name, float value) const
 {
-  glUniform1f(glGetUniformLocation(ID, name.c_str()), value);
+  glUniform1f(getUniformLocation(name), value);
 }
 
 void Shader::setVec2(const std::string &name, const glm::vec2 &value) const
 {
-  glUniform2fv(glGetUniformLocation(ID, name.c_str()), 1, &value[0]);
+  glUniform2fv(getUniformLocation(name), 1, &value[0]);
 }
 
 void Shader::setVec2(const std::string &name, float x, float y) const
 {
-  glUniform2f(glGetUniformLocation(ID, name.c_str()), x, y);
+  glUniform2f(getUniformLocation(name), x, y);
 }
 
 void Shader::setVec3(const std::string &name, const glm::vec3 &value) const
 {
-  glUniform3fv(glGetUniformLocation(ID, name.c_str()), 1, &value[0]);
+  glUniform3fv(getUniformLocation(name), 1, &value[0]);
 }
 
 void Shader::setVec3(const std::string &name, float x, float y, float z) const
 {
-  glUniform3f(glGetUniformLocation(ID, name.c_str()), x, y, z);
+  glUniform3f(getUniformLocation(name), x, y, z);
 }
 
 void Shader::setVec4(const std::string &name, const glm::vec4 &value) const
 {
-  glUniform4fv(glGetUniformLocation(ID, name.c_str()), 1, &value[0]);
+  glUniform4fv(getUniformLocation(name), 1, &value[0]);
 }
 
 void Shader::setVec4(const std::string &name, float x, float y, float z, float w) const
 {
-  glUniform4f(glGetUniformLocation(ID, name.c_str()), x, y, z, w);
+  glUniform4f(getUniformLocation(name), x, y, z, w);
 }
 
 void Shader::setMat2(const std::string &name, const glm::mat2 &mat) const
 {
-  glUniformMatrix2fv(glGetUniformLocation(ID, name.c_str()), 1, GL_FALSE, &mat[0][0]);
+  glUniformMatrix2fv(getUniformLocation(name), 1, GL_FALSE, &mat[0][0]);
 }
 
 void Shader::setMat3(const std::string &name, const glm::mat3 &mat) const
 {
-  glUniformMatrix3fv(glGetUniformLocation(ID, name.c_str()), 1, GL_FALSE, &mat[0][0]);
+  glUniformMatrix3fv(getUniformLocation(name), 1, GL_FALSE, &mat[0][0]);
 }
 
 void Shader::setMat4(const std::string &name, const glm::mat4 &mat) const
 {
-  glUniformMatrix4fv(glGetUniformLocation(ID, name.c_str()), 1, GL_FALSE, &mat[0][0]);
+  glUniformMatrix4fv(getUniformLocation(name), 1, GL_FALSE, &mat[0][0]);
+}
+
+// 배열 유니폼 변수 관련 유틸리티 (연속된 count 개의 값을 한 번의 호출로 전송)
+void Shader::setIntArray(const std::string &name, const int *values, GLsizei count) const
+{
+  glUniform1iv(getUniformLocation(name), count, values);
+}
+
+void Shader::setFloatArray(const std::string &name, const float *values, GLsizei count) const
+{
+  glUniform1fv(getUniformLocation(name), count, values);
+}
+
+void Shader::setVec2Array(const std::string &name, const glm::vec2 *values, GLsizei count) const
+{
+  glUniform2fv(getUniformLocation(name), count, &values[0][0]);
+}
+
+void Shader::setVec3Array(const std::string &name, const glm::vec3 *values, GLsizei count) const
+{
+  glUniform3fv(getUniformLocation(name), count, &values[0][0]);
+}
+
+void Shader::setVec4Array(const std::string &name, const glm::vec4 *values, GLsizei count) const
+{
+  glUniform4fv(getUniformLocation(name), count, &values[0][0]);
+}
+
+void Shader::setMat3Array(const std::string &name, const glm::mat3 *mats, GLsizei count) const
+{
+  glUniformMatrix3fv(getUniformLocation(name), count, GL_FALSE, &mats[0][0][0]);
+}
+
+void Shader::setMat4Array(const std::string &name, const glm::mat4 *mats, GLsizei count) const
+{
+  glUniformMatrix4fv(getUniformLocation(name), count, GL_FALSE, &mats[0][0][0]);
 }
 
 // 쉐이더 객체 및 쉐이더 프로그램 객체의 컴파일 및 링킹 에러 대응
-void Shader::checkCompileErrors(unsigned int shader, std::string type)
+bool Shader::checkCompileErrors(unsigned int shader, std::string type)
 {
   int success;
-  char infoLog[1024];
+
+  // 에러 로그가 잘리지 않도록 GL_INFO_LOG_LENGTH 로 로그 길이(null 문자 포함)를 먼저 조회해서 버퍼 할당
+  int length = 0;
 
   if (type != "PROGRAM")
   {
     glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
     if (!success)
     {
-      glGetShaderInfoLog(shader, 1024, NULL, infoLog);
+      glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &length);
+      std::vector<GLchar> infoLog(length > 0 ? length : 1, '\0');
+      glGetShaderInfoLog(shader, (GLsizei)infoLog.size(), NULL, infoLog.data());
+
+      // 에러 로그의 '파일번호:라인' 을 원래 파일 경로로 변환하여 출력
       std::cout << "ERROR::SHADER_COMPILATION_ERROR of type: " << type << "\n"
-                << infoLog << "\n -- --------------------------------------------------- -- " << std::endl;
+                << ShaderPreprocessor::shared().annotateLog(infoLog.data()) << "\n -- --------------------------------------------------- -- " << std::endl;
     }
   }
   else
@@ -165,9 +486,12 @@ void Shader::checkCompileErrors(unsigned int shader, std::string type)
     glGetProgramiv(shader, GL_LINK_STATUS, &success);
     if (!success)
     {
-      glGetProgramInfoLog(shader, 1024, NULL, infoLog);
+      glGetProgramiv(shader, GL_INFO_LOG_LENGTH, &length);
+      std::vector<GLchar> infoLog(length > 0 ? length : 1, '\0');
+      glGetProgramInfoLog(shader, (GLsizei)infoLog.size(), NULL, infoLog.data());
       std::cout << "ERROR::PROGRAM_LINKING_ERROR of type: " << type << "\n"
-                << infoLog << "\n -- --------------------------------------------------- -- " << std::endl;
+                << infoLog.data() << "\n -- --------------------------------------------------- -- " << std::endl;
     }
   }
+  return success != 0;
 }
@@ -0,0 +1,352 @@
+#include "shader/shader_library.hpp"
+#include "shader/shader_stats.hpp"
+
+#include <chrono> // 프레임당 시간 예산 및 컴파일 시간 측정
+
+// start 부터 현재까지 흐른 시간 (ms)
+static double elapsedMs(std::chrono::steady_clock::time_point start)
+{
+  return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// 쉐이더 프로그램 하나의 컴파일 진행 상태
+struct ShaderFuture::Request
+{
+  // 컴파일 진행 단계
+  enum Stage
+  {
+    STAGE_COMPILE_VERTEX,   // 버텍스 쉐이더 컴파일 대기 (time-slicing 모드)
+    STAGE_COMPILE_FRAGMENT, // 프래그먼트 쉐이더 컴파일 대기 (time-slicing 모드)
+    STAGE_LINK,             // 링킹 대기 (time-slicing 모드)
+    STAGE_WAIT,             // 드라이버의 병렬 컴파일 및 링킹 완료 대기 (병렬 컴파일 모드)
+    STAGE_READY,            // 완료
+    STAGE_FAILED            // 실패
+  };
+
+  Stage stage;
+  std::string vertexPath;
+  std::string fragmentPath;
+  std::string defines;
+  std::string vertexCode;
+  std::string fragmentCode;
+  std::string cacheKey;
+  ShaderHandle vertex;
+  ShaderHandle fragment;
+  ProgramHandle program;
+  std::unique_ptr<Shader> shader;
+  ShaderTiming timing;                                // 컴파일 비용 측정 결과 (완료 시 ShaderStats 에 기록됨)
+  std::chrono::steady_clock::time_point compileStart; // 첫 glCompileShader() 호출 시점
+
+  Request() : stage(STAGE_COMPILE_VERTEX) {}
+};
+
+/** ShaderFuture 구현부 */
+
+ShaderFuture::ShaderFuture()
+{
+}
+
+// 컴파일 및 링킹이 성공적으로 완료되었는지 여부
+bool ShaderFuture::ready() const
+{
+  return request && request->stage == Request::STAGE_READY;
+}
+
+// 컴파일 또는 링킹에 실패했는지 여부
+bool ShaderFuture::failed() const
+{
+  return request && request->stage == Request::STAGE_FAILED;
+}
+
+// 완료된 Shader 객체 반환 (아직 완료되지 않았거나 실패했다면 nullptr)
+Shader *ShaderFuture::get() const
+{
+  return ready() ? request->shader.get() : nullptr;
+}
+
+/** ShaderLibrary 구현부 */
+
+// ShaderLibrary 클래스 생성자
+ShaderLibrary::ShaderLibrary(ProgramCache *cache)
+    : cache(cache), parallel(GLAD_GL_KHR_parallel_shader_compile != 0)
+{
+  if (parallel)
+  {
+    // 0xFFFFFFFF 를 전달하면 드라이버가 사용할 수 있는 최대 개수의 컴파일러 스레드를 사용함
+    glMaxShaderCompilerThreadsKHR(0xFFFFFFFF);
+  }
+}
+
+// ShaderLibrary 클래스 소멸자
+ShaderLibrary::~ShaderLibrary()
+{
+  // 완료되지 못한 요청들의 쉐이더 객체 및 프로그램 객체 메모리 반납 (핸들을 비우면 삭제 큐로 넘어감)
+  for (size_t i = 0; i < pending.size(); i++)
+  {
+    ShaderFuture::Request &request = *pending[i];
+    request.vertex.reset();
+    request.fragment.reset();
+    request.program.reset();
+    request.stage = ShaderFuture::Request::STAGE_FAILED;
+  }
+}
+
+// 쉐이더 프로그램 컴파일 요청
+ShaderFuture ShaderLibrary::submit(const std::string &vertexPath, const std::string &fragmentPath, const std::string &defines)
+{
+  ShaderFuture future;
+  future.request = std::make_shared<ShaderFuture::Request>();
+  ShaderFuture::Request &request = *future.request;
+
+  // 쉐이더 코드 읽기
+  request.vertexPath = vertexPath;
+  request.fragmentPath = fragmentPath;
+  request.defines = defines;
+  request.timing.vertexPath = vertexPath;
+  request.timing.fragmentPath = fragmentPath;
+  request.timing.defines = defines;
+
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  request.vertexCode = Shader::loadShaderSource(vertexPath.c_str(), defines);
+  request.fragmentCode = Shader::loadShaderSource(fragmentPath.c_str(), defines);
+  request.timing.readMs = elapsedMs(start);
+  request.timing.sourceBytes = request.vertexCode.size() + request.fragmentCode.size();
+
+  // 쉐이더 프로그램 객체 생성
+  request.program = ProgramHandle::generate();
+
+  // 프로그램 바이너리 캐시에 적중하면 컴파일할 필요 없이 곧바로 완료 처리
+  if (cache && cache->isSupported())
+  {
+    request.cacheKey = cache->makeKey(request.vertexCode, request.fragmentCode);
+    std::string reflectionData;
+    start = std::chrono::steady_clock::now();
+    if (cache->load(request.cacheKey, request.program.get(), &reflectionData))
+    {
+      request.timing.cached = true;
+      request.timing.linkMs = elapsedMs(start);
+      ShaderStats::shared().record(request.timing);
+      request.shader.reset(new Shader(request.program.release(), request.vertexPath, request.fragmentPath, request.defines,
+                                      reflectionData));
+      request.stage = ShaderFuture::Request::STAGE_READY;
+      return future;
+    }
+
+    request.program = ProgramHandle::generate();
+    glProgramParameteri(request.program.get(), GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+  }
+
+  if (parallel)
+  {
+    /**
+     * 병렬 컴파일 모드에서는 컴파일과 링킹을 모두 곧바로 요청해 둠.
+     *
+     * 컴파일 상태(GL_COMPILE_STATUS)나 링킹 상태(GL_LINK_STATUS)를 조회하지 않는 한
+     * 드라이버는 내부 컴파일러 스레드에서 작업을 진행하므로 메인 스레드가 멈추지 않음.
+     */
+    const char *vShaderCode = request.vertexCode.c_str();
+    const char *fShaderCode = request.fragmentCode.c_str();
+
+    request.compileStart = std::chrono::steady_clock::now();
+    request.vertex.reset(glCreateShader(GL_VERTEX_SHADER));
+    glShaderSource(request.vertex.get(), 1, &vShaderCode, NULL);
+    glCompileShader(request.vertex.get());
+    request.timing.vertexMs = elapsedMs(request.compileStart);
+
+    start = std::chrono::steady_clock::now();
+    request.fragment.reset(glCreateShader(GL_FRAGMENT_SHADER));
+    glShaderSource(request.fragment.get(), 1, &fShaderCode, NULL);
+    glCompileShader(request.fragment.get());
+    request.timing.fragmentMs = elapsedMs(start);
+
+    glAttachShader(request.program.get(), request.vertex.get());
+    glAttachShader(request.program.get(), request.fragment.get());
+    start = std::chrono::steady_clock::now();
+    glLinkProgram(request.program.get());
+    request.timing.linkMs = elapsedMs(start);
+
+    request.stage = ShaderFuture::Request::STAGE_WAIT;
+  }
+  else
+  {
+    // time-slicing 모드에서는 update() 에서 단계별로 나눠서 처리함
+    request.stage = ShaderFuture::Request::STAGE_COMPILE_VERTEX;
+  }
+
+  pending.push_back(future.request);
+  return future;
+}
+
+// 매 프레임마다 호출하여 컴파일 진행 상태 갱신
+void ShaderLibrary::update(double budgetMs)
+{
+  if (parallel)
+  {
+    // 완료된 요청만 골라서 마무리하고, 나머지는 다음 프레임에 다시 확인
+    std::vector<std::shared_ptr<ShaderFuture::Request> > stillPending;
+    for (size_t i = 0; i < pending.size(); i++)
+    {
+      if (isComplete(*pending[i]))
+      {
+        finalize(*pending[i]);
+      }
+      else
+      {
+        stillPending.push_back(pending[i]);
+      }
+    }
+    pending.swap(stillPending);
+    return;
+  }
+
+  /**
+   * time-slicing 모드
+   *
+   * 각 단계(glCompileShader, glLinkProgram)는 드라이버에서 동기적으로 처리되므로
+   * 하나의 단계가 예산을 넘길 수는 있지만, 적어도 한 단계는 매 프레임 진행되도록 보장함.
+   */
+  typedef std::chrono::steady_clock Clock;
+  Clock::time_point start = Clock::now();
+  size_t index = 0;
+  while (index < pending.size())
+  {
+    ShaderFuture::Request &request = *pending[index];
+    step(request);
+    if (request.stage == ShaderFuture::Request::STAGE_READY || request.stage == ShaderFuture::Request::STAGE_FAILED)
+    {
+      index++;
+    }
+
+    double elapsedMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    if (elapsedMs >= budgetMs)
+      break;
+  }
+  pending.erase(pending.begin(), pending.begin() + index);
+}
+
+// 아직 완료되지 않은 모든 요청이 끝날 때까지 대기
+void ShaderLibrary::finish()
+{
+  for (size_t i = 0; i < pending.size(); i++)
+  {
+    ShaderFuture::Request &request = *pending[i];
+    if (request.stage == ShaderFuture::Request::STAGE_WAIT)
+    {
+      // 에러 확인 시 컴파일 및 링킹 상태를 조회하므로, 드라이버가 완료할 때까지 기다리게 됨
+      finalize(request);
+    }
+    while (request.stage != ShaderFuture::Request::STAGE_READY && request.stage != ShaderFuture::Request::STAGE_FAILED)
+    {
+      step(request);
+    }
+  }
+  pending.clear();
+}
+
+// 아직 완료되지 않은 요청 개수
+size_t ShaderLibrary::pendingCount() const
+{
+  return pending.size();
+}
+
+// GL_KHR_parallel_shader_compile 을 사용한 병렬 컴파일 여부
+bool ShaderLibrary::isParallel() const
+{
+  return parallel;
+}
+
+// 병렬 컴파일 모드에서 컴파일 및 링킹이 완료되었는지 조회 (블로킹 없음)
+bool ShaderLibrary::isComplete(const ShaderFuture::Request &request) const
+{
+  // 프로그램 객체의 GL_COMPLETION_STATUS_KHR 는 연결된 쉐이더들의 컴파일과 링킹이 모두 끝나야 GL_TRUE 가 됨
+  int completed = GL_FALSE;
+  glGetProgramiv(request.program.get(), GL_COMPLETION_STATUS_KHR, &completed);
+  return completed == GL_TRUE;
+}
+
+// time-slicing 모드에서 요청의 다음 단계 하나를 처리
+void ShaderLibrary::step(ShaderFuture::Request &request)
+{
+  switch (request.stage)
+  {
+  case ShaderFuture::Request::STAGE_COMPILE_VERTEX:
+  {
+    const char *vShaderCode = request.vertexCode.c_str();
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    request.vertex.reset(glCreateShader(GL_VERTEX_SHADER));
+    glShaderSource(request.vertex.get(), 1, &vShaderCode, NULL);
+    glCompileShader(request.vertex.get());
+    request.timing.vertexMs = elapsedMs(start);
+    request.stage = ShaderFuture::Request::STAGE_COMPILE_FRAGMENT;
+    break;
+  }
+  case ShaderFuture::Request::STAGE_COMPILE_FRAGMENT:
+  {
+    const char *fShaderCode = request.fragmentCode.c_str();
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    request.fragment.reset(glCreateShader(GL_FRAGMENT_SHADER));
+    glShaderSource(request.fragment.get(), 1, &fShaderCode, NULL);
+    glCompileShader(request.fragment.get());
+    request.timing.fragmentMs = elapsedMs(start);
+    request.stage = ShaderFuture::Request::STAGE_LINK;
+    break;
+  }
+  case ShaderFuture::Request::STAGE_LINK:
+  {
+    glAttachShader(request.program.get(), request.vertex.get());
+    glAttachShader(request.program.get(), request.fragment.get());
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    glLinkProgram(request.program.get());
+    request.timing.linkMs = elapsedMs(start);
+    finalize(request);
+    break;
+  }
+  default:
+    break;
+  }
+}
+
+// 링킹이 끝난 요청의 에러 확인 및 Shader 객체 생성
+void ShaderLibrary::finalize(ShaderFuture::Request &request)
+{
+  bool vertexCompiled = Shader::checkCompileErrors(request.vertex.get(), "VERTEX");
+  bool fragmentCompiled = Shader::checkCompileErrors(request.fragment.get(), "FRAGMENT");
+  bool linked = vertexCompiled && fragmentCompiled && Shader::checkCompileErrors(request.program.get(), "PROGRAM");
+
+  /**
+   * 병렬 컴파일 모드에서는 제출부터 완료까지 걸린 시간을 기록함.
+   *
+   * update() 에서는 프레임마다 한 번씩만 완료 여부를 확인하므로, 이 값은 실제 완료 시간의 상한값이고
+   * 프레임 간격만큼의 오차가 있을 수 있음. (finish() 에서는 위의 상태 조회가 완료될 때까지 기다리므로 정확함)
+   */
+  if (parallel)
+  {
+    request.timing.completionMs = elapsedMs(request.compileStart);
+  }
+  ShaderStats::shared().record(request.timing);
+
+  // 쉐이더 객체 삭제
+  request.vertex.reset();
+  request.fragment.reset();
+
+  if (linked)
+  {
+    request.shader.reset(new Shader(request.program.release(), request.vertexPath, request.fragmentPath, request.defines));
+
+    // 링킹에 성공한 프로그램은 다음 실행을 위해 리플렉션 메타데이터와 함께 바이너리 캐시에 저장
+    if (cache && !request.cacheKey.empty())
+    {
+      cache->store(request.cacheKey, request.shader->ID.get(), request.shader->getReflection().serialize());
+    }
+    request.stage = ShaderFuture::Request::STAGE_READY;
+  }
+  else
+  {
+    request.program.reset();
+    request.stage = ShaderFuture::Request::STAGE_FAILED;
+  }
+
+  // 더 이상 필요없는 쉐이더 소스코드 메모리 반납
+  std::string().swap(request.vertexCode);
+  std::string().swap(request.fragmentCode);
+}
@@ -0,0 +1,157 @@
+#include "shader/shader_pipeline.hpp"
+#include "shader/shader.hpp"
+
+#include <sstream>  // 문자열 스트림
+#include <iostream> // 콘솔 입출력을 위한 헤더
+#include <vector>   // std::vector
+
+// #version 330 쉐이더에서도 분리형 쉐이더 오브젝트를 사용할 수 있도록 #version 바로 다음에 삽입할 지시문
+static const char *SEPARATE_SHADER_OBJECTS_EXTENSION = "#extension GL_ARB_separate_shader_objects : enable\n";
+
+/**
+ * 분리형 프로그램의 버텍스 스테이지에서 재선언해야 하는 내장 출력 블록.
+ *
+ * GLSL 1.50 이상에서 분리형 프로그램으로 링킹되는 스테이지는 사용할 내장 변수 블록(gl_PerVertex)을 직접 재선언해야 하며,
+ * 엄격한 드라이버는 재선언이 없으면 파이프라인 검증에 실패하거나 스테이지 사이의 인터페이스를 정의되지 않은 것으로 취급함.
+ * (버텍스 쉐이더들은 gl_Position 만 사용하므로 gl_Position 만 선언함)
+ */
+static const char *SEPARATE_VERTEX_PER_VERTEX_BLOCK = "out gl_PerVertex { vec4 gl_Position; };\n";
+
+/** ShaderStage 구현부 */
+
+// 쉐이더 스테이지 타입
+GLenum ShaderStage::getType() const
+{
+  return type;
+}
+
+// 링킹 시점에 조회한 리플렉션 메타데이터
+const ShaderReflection &ShaderStage::getReflection() const
+{
+  return metadata;
+}
+
+// 유니폼 변수 location 조회
+GLint ShaderStage::getUniformLocation(const std::string &name) const
+{
+  const ShaderUniform *uniform = metadata.findUniform(name);
+  if (!uniform)
+    uniform = metadata.findUniform(name + "[0]");
+  if (uniform)
+    return uniform->location;
+
+  if (name.find('[') != std::string::npos)
+    return glGetUniformLocation(ID.get(), name.c_str());
+  return -1;
+}
+
+/** ShaderPipelineCache 구현부 */
+
+// ShaderPipelineCache 클래스 생성자
+ShaderPipelineCache::ShaderPipelineCache()
+    : supported(GLAD_GL_VERSION_4_1 != 0)
+{
+}
+
+// 현재 컨텍스트에서 분리형 쉐이더 오브젝트를 사용할 수 있는지 여부
+bool ShaderPipelineCache::isSupported() const
+{
+  return supported;
+}
+
+// 쉐이더 스테이지 반환
+const ShaderStage *ShaderPipelineCache::getStage(GLenum type, const std::string &path, const std::string &defines)
+{
+  if (!supported)
+    return nullptr;
+
+  std::ostringstream key;
+  key << type << ":" << path << ":" << defines;
+  std::map<std::string, std::unique_ptr<ShaderStage>>::iterator it = stages.find(key.str());
+  if (it != stages.end())
+  {
+    // 컴파일에 실패했던 스테이지는 nullptr 로 캐싱되어 있으므로 매번 다시 컴파일하지 않음
+    return it->second.get();
+  }
+
+  std::unique_ptr<ShaderStage> &slot = stages[key.str()];
+
+  // 쉐이더 코드를 읽고 #include 를 펼친 뒤, 확장 지시문 및 #define 블록 삽입
+  std::string preamble = SEPARATE_SHADER_OBJECTS_EXTENSION;
+  if (type == GL_VERTEX_SHADER)
+    preamble += SEPARATE_VERTEX_PER_VERTEX_BLOCK;
+  std::string code = Shader::loadShaderSource(path.c_str(), preamble + defines);
+  if (code.empty())
+    return nullptr;
+
+  // 컴파일과 링킹을 한 번에 처리 (쉐이더 객체는 드라이버 내부에서 생성 후 곧바로 삭제됨)
+  const char *shaderCode = code.c_str();
+  std::unique_ptr<ShaderStage> stage(new ShaderStage());
+  stage->type = type;
+  stage->ID.reset(glCreateShaderProgramv(type, 1, &shaderCode));
+  if (!stage->ID || !Shader::checkCompileErrors(stage->ID.get(), "PROGRAM"))
+  {
+    std::cout << "ERROR::SHADER_PIPELINE::STAGE_FAILED: " << path << std::endl;
+    return nullptr;
+  }
+
+  stage->metadata = ShaderReflection::reflect(stage->ID.get());
+  Shader::bindUniformBlocks(stage->ID.get(), stage->metadata, path);
+
+  slot = std::move(stage);
+  return slot.get();
+}
+
+// 두 스테이지를 조합한 프로그램 파이프라인 객체 반환
+GLuint ShaderPipelineCache::getPipeline(const ShaderStage *vertex, const ShaderStage *fragment)
+{
+  if (!supported || !vertex || !fragment)
+    return 0;
+
+  std::pair<GLuint, GLuint> key(vertex->ID.get(), fragment->ID.get());
+  std::map<std::pair<GLuint, GLuint>, ProgramPipelineHandle>::iterator it = pipelines.find(key);
+  if (it != pipelines.end())
+    return it->second.get();
+
+  // 스테이지 조합은 링킹 없이 파이프라인 객체에 프로그램을 연결하기만 하면 됨
+  ProgramPipelineHandle pipeline = ProgramPipelineHandle::generate();
+  glUseProgramStages(pipeline.get(), GL_VERTEX_SHADER_BIT, vertex->ID.get());
+  glUseProgramStages(pipeline.get(), GL_FRAGMENT_SHADER_BIT, fragment->ID.get());
+
+  // 스테이지 사이의 입출력 변수 불일치 등을 생성 시점에 한 번만 확인
+  glValidateProgramPipeline(pipeline.get());
+  GLint valid = 0;
+  glGetProgramPipelineiv(pipeline.get(), GL_VALIDATE_STATUS, &valid);
+  if (!valid)
+  {
+    GLint length = 0;
+    glGetProgramPipelineiv(pipeline.get(), GL_INFO_LOG_LENGTH, &length);
+    std::vector<GLchar> infoLog(length > 0 ? length : 1, '\0');
+    glGetProgramPipelineInfoLog(pipeline.get(), (GLsizei)infoLog.size(), NULL, infoLog.data());
+    std::cout << "ERROR::SHADER_PIPELINE::VALIDATION_FAILED\n"
+              << infoLog.data() << "\n -- --------------------------------------------------- -- " << std::endl;
+  }
+
+  GLuint name = pipeline.get();
+  pipelines[key] = std::move(pipeline);
+  return name;
+}
+
+// 두 스테이지를 조합한 프로그램 파이프라인 바인딩
+void ShaderPipelineCache::bind(const ShaderStage *vertex, const ShaderStage *fragment)
+{
+  // 일반 프로그램이 바인딩되어 있으면 파이프라인보다 우선 적용되므로 먼저 해제
+  glUseProgram(0);
+  glBindProgramPipeline(getPipeline(vertex, fragment));
+}
+
+// 캐시된 스테이지 및 파이프라인 개수
+size_t ShaderPipelineCache::stageCount() const
+{
+  return stages.size();
+}
+
+size_t ShaderPipelineCache::pipelineCount() const
+{
+  return pipelines.size();
+}
@@ -0,0 +1,626 @@
+#include "shader/shader_preprocessor.hpp"
+#include "util/hash.hpp"
+#include "asset/asset_pack.hpp"
+
+#include <sstream>  // 문자열 스트림
+#include <iostream> // 콘솔 입출력을 위한 헤더
+#include <regex>    // 에러 로그의 파일번호 패턴 매칭
+#include <cstdlib>  // std::atoi
+#include <cctype>   // std::isalnum, std::isspace
+
+// 경로에서 디렉토리 부분만 추출 ('dir/' 형태, 디렉토리가 없으면 빈 문자열)
+static std::string directoryOf(const std::string &path)
+{
+  size_t slash = path.find_last_of("/\\");
+  return slash == std::string::npos ? std::string() : path.substr(0, slash + 1);
+}
+
+// 전처리기 지시문이라면 '#' 뒤의 지시문 이름과 나머지 부분을 분리 (지시문이 아니라면 false)
+static bool parseDirective(const std::string &line, std::string &directive, std::string &rest)
+{
+  size_t pos = line.find_first_not_of(" \t");
+  if (pos == std::string::npos || line[pos] != '#')
+    return false;
+
+  pos = line.find_first_not_of(" \t", pos + 1);
+  if (pos == std::string::npos)
+    return false;
+
+  size_t end = line.find_first_of(" \t", pos);
+  directive = line.substr(pos, end == std::string::npos ? std::string::npos : end - pos);
+  rest = end == std::string::npos ? std::string() : line.substr(end);
+  return true;
+}
+
+// #include "name" 에서 따옴표 안의 name 추출
+static bool parseIncludeName(const std::string &rest, std::string &name)
+{
+  size_t open = rest.find('"');
+  if (open == std::string::npos)
+    return false;
+  size_t close = rest.find('"', open + 1);
+  if (close == std::string::npos)
+    return false;
+  name = rest.substr(open + 1, close - open - 1);
+  return true;
+}
+
+// 문자열을 라인 단위로 분리 (\r\n 도 처리)
+static std::vector<std::string> splitLines(const std::string &code)
+{
+  std::vector<std::string> lines;
+  size_t start = 0;
+  while (start < code.size())
+  {
+    size_t end = code.find('\n', start);
+    if (end == std::string::npos)
+      end = code.size();
+    size_t length = end - start;
+    if (length > 0 && code[start + length - 1] == '\r')
+      length--;
+    lines.push_back(code.substr(start, length));
+    start = end + 1;
+  }
+  return lines;
+}
+
+// #line 지시문 생성
+static std::string lineDirective(size_t line, int fileId)
+{
+  std::ostringstream stream;
+  stream << "#line " << line << " " << fileId << "\n";
+  return stream.str();
+}
+
+// 주석과 줄 이어붙이기(\ + 줄바꿈)를 공백으로 치환 (C 전처리기와 같은 규칙, 문자열 리터럴이 없는 GLSL 이므로 따옴표는 고려하지 않음)
+static std::string stripComments(const std::string &code)
+{
+  std::string out;
+  out.reserve(code.size());
+  size_t i = 0;
+  while (i < code.size())
+  {
+    if (code.compare(i, 2, "//") == 0)
+    {
+      // 줄 끝까지 무시 (줄바꿈은 남겨둠)
+      while (i < code.size() && code[i] != '\n')
+        i++;
+      out += ' ';
+    }
+    else if (code.compare(i, 2, "/*") == 0)
+    {
+      size_t end = code.find("*/", i + 2);
+      i = end == std::string::npos ? code.size() : end + 2;
+      out += ' ';
+    }
+    else if (code[i] == '\\' && (code.compare(i + 1, 1, "\n") == 0 || code.compare(i + 1, 2, "\r\n") == 0))
+    {
+      i += code[i + 1] == '\r' ? 3 : 2;
+      out += ' ';
+    }
+    else
+    {
+      out += code[i++];
+    }
+  }
+  return out;
+}
+
+// 식별자나 숫자를 이루는 문자인지 여부
+static bool isWordChar(char c)
+{
+  return std::isalnum((unsigned char)c) || c == '_';
+}
+
+// 두 문자를 공백 없이 붙이면 다른 토큰이 되는지 여부 ('a b' -> 'ab', '- -' -> '--' 등)
+static bool needsSpace(char left, char right)
+{
+  static const std::string OPERATORS = "+-*/%<>=!&|^";
+  if (isWordChar(left) && isWordChar(right))
+    return true;
+  return OPERATORS.find(left) != std::string::npos && OPERATORS.find(right) != std::string::npos;
+}
+
+// 연속된 공백을 하나로 줄이고 앞뒤 공백 제거
+static std::string collapseSpaces(const std::string &line)
+{
+  std::string out;
+  bool space = false;
+  for (size_t i = 0; i < line.size(); i++)
+  {
+    if (std::isspace((unsigned char)line[i]))
+    {
+      space = !out.empty();
+      continue;
+    }
+    if (space)
+      out += ' ';
+    out += line[i];
+    space = false;
+  }
+  return out;
+}
+
+// 프로세스 전역에서 공유하는 인스턴스
+ShaderPreprocessor &ShaderPreprocessor::shared()
+{
+  static ShaderPreprocessor instance;
+  return instance;
+}
+
+ShaderPreprocessor::ShaderPreprocessor()
+{
+}
+
+// 진행 중인 prefetch 가 있다면 끝날 때까지 대기
+ShaderPreprocessor::~ShaderPreprocessor()
+{
+  waitPrefetch();
+}
+
+// #include 검색 경로 추가
+void ShaderPreprocessor::addSearchPath(const std::string &path)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+
+  std::string normalized = normalizePath(path);
+  if (!normalized.empty() && normalized[normalized.size() - 1] != '/')
+    normalized += '/';
+  searchPaths.push_back(normalized);
+}
+
+// 쉐이더 파일을 읽어서 #include 를 모두 펼친 코드 반환 (실패 시 빈 문자열)
+std::string ShaderPreprocessor::process(const std::string &path)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+
+  std::vector<std::string> stack;
+  std::string out;
+  uint64_t hash = 0;
+  if (!expand(normalizePath(path), stack, true, out, hash))
+    return std::string();
+  return out;
+}
+
+// paths 의 쉐이더 파일들과 그 파일들이 포함하는 파일들을 I/O 스레드에서 미리 읽어둠
+void ShaderPreprocessor::prefetch(const std::vector<std::string> &paths)
+{
+  // 이전 prefetch 가 아직 진행 중이라면 끝난 뒤에 새로 시작 (I/O 스레드는 하나만 사용)
+  waitPrefetch();
+  prefetcher = std::thread(&ShaderPreprocessor::runPrefetch, this, paths);
+}
+
+// 진행 중인 prefetch 가 끝날 때까지 대기
+void ShaderPreprocessor::waitPrefetch()
+{
+  if (prefetcher.joinable())
+  {
+    prefetcher.join();
+  }
+}
+
+// path 가 직간접적으로 포함하는 모든 파일 경로 (path 자신 포함)
+std::vector<std::string> ShaderPreprocessor::dependencies(const std::string &path)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+
+  std::set<std::string> visited;
+  std::vector<std::string> out;
+  collect(normalizePath(path), visited, out);
+  return out;
+}
+
+// 파일이 수정되었을 때 해당 파일의 캐시를 무효화
+void ShaderPreprocessor::invalidate(const std::string &path)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+
+  /**
+   * 원본 코드만 다시 읽도록 표시하고, 파일 번호는 그대로 유지함.
+   *
+   * 펼쳐진 결과 캐시는 내용 해시를 키로 사용하므로, 지우지 않으면 핫 리로드로 수정할 때마다 이전 결과가 계속 쌓임.
+   * 이 파일을 펼친 결과는 여기서 지우고, 이 파일을 포함하는 파일들의 이전 결과는 다시 펼칠 때 키가 바뀌면서 지워짐.
+   */
+  std::map<std::string, File>::iterator it = files.find(normalizePath(path));
+  if (it != files.end())
+  {
+    File &file = it->second;
+    file.loaded = false;
+    for (int root = 0; root < 2; root++)
+    {
+      if (file.expanded[root])
+        expansions.erase(file.expansionKeys[root]);
+      file.expanded[root] = false;
+    }
+  }
+}
+
+// 드라이버의 컴파일 에러 로그에 포함된 '파일번호:라인' 을 '파일경로:라인' 으로 변환
+std::string ShaderPreprocessor::annotateLog(const std::string &log)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+
+  /**
+   * 드라이버마다 에러 위치 표기 방식이 다르지만, 대부분 '파일번호' 다음에 ':' 또는 '(' 와 '라인' 이 옴.
+   *
+   * NVIDIA : 3(12) : error C0000: ...
+   * Mesa   : 3:12(5): error: ...
+   * AMD    : ERROR: 3:12: ...
+   *
+   * 각 라인에서 처음 나타나는 위치 표기만 변환함.
+   */
+  static const std::regex location("\\b(\\d+)([:(])(\\d+)");
+
+  std::vector<std::string> lines = splitLines(log);
+  std::string out;
+  for (size_t i = 0; i < lines.size(); i++)
+  {
+    std::smatch match;
+    if (std::regex_search(lines[i], match, location))
+    {
+      int fileId = std::atoi(match[1].str().c_str());
+      if (fileId >= 0 && fileId < (int)fileNames.size())
+      {
+        out += match.prefix().str() + fileNames[fileId] + match[2].str() + match[3].str() + match.suffix().str() + "\n";
+        continue;
+      }
+    }
+    out += lines[i] + "\n";
+  }
+  return out;
+}
+
+// 전처리된 코드의 #version 바로 다음 줄에 #define 블록 삽입
+std::string ShaderPreprocessor::injectDefines(const std::string &code, const std::string &defines)
+{
+  if (defines.empty())
+    return code;
+
+  /**
+   * process() 결과에는 #version 바로 다음 줄에 '#line <다음 라인> <파일번호>' 가 들어있으므로,
+   * 그 사이에 #define 들을 끼워넣으면 원래 파일의 라인 번호가 그대로 유지됨.
+   */
+  size_t start = 0;
+  while (start < code.size())
+  {
+    size_t end = code.find('\n', start);
+    if (end == std::string::npos)
+      end = code.size();
+
+    std::string directive, rest;
+    if (parseDirective(code.substr(start, end - start), directive, rest) && directive == "version")
+    {
+      size_t insertAt = end < code.size() ? end + 1 : end;
+      std::string prefix = code.substr(0, insertAt);
+      if (end == code.size())
+        prefix += '\n';
+      return prefix + defines + code.substr(insertAt);
+    }
+    start = end + 1;
+  }
+
+  // #version 이 없다면 맨 앞에 삽입
+  return defines + code;
+}
+
+// 주석, 불필요한 공백 및 #line 지시문을 제거한 코드 반환
+std::string ShaderPreprocessor::minify(const std::string &code)
+{
+  /**
+   * 전처리기 지시문은 한 줄에 하나씩 있어야 하므로 각자의 줄에 그대로 두고 (공백만 정리),
+   * 지시문 사이의 일반 코드들은 토큰 사이에 꼭 필요한 공백만 남겨서 한 줄로 이어붙임.
+   *
+   * #define 의 경우 'FOO(x)' 와 'FOO (x)' 의 의미가 다르므로, 지시문 안의 공백은 없애지 않고 하나로만 줄임.
+   */
+  std::vector<std::string> lines = splitLines(stripComments(code));
+  std::string out;
+  std::string run; // 아직 출력하지 않은 일반 코드
+  for (size_t i = 0; i < lines.size(); i++)
+  {
+    std::string directive, rest;
+    if (parseDirective(lines[i], directive, rest))
+    {
+      // 원본 파일 기준의 #line 은 minify 후에는 의미가 없으므로 제거
+      if (directive == "line")
+        continue;
+      if (!run.empty())
+      {
+        out += run + "\n";
+        run.clear();
+      }
+      out += collapseSpaces(lines[i]) + "\n";
+      continue;
+    }
+
+    bool space = !run.empty(); // 줄바꿈도 토큰 사이의 공백으로 취급
+    for (size_t j = 0; j < lines[i].size(); j++)
+    {
+      char c = lines[i][j];
+      if (std::isspace((unsigned char)c))
+      {
+        space = true;
+        continue;
+      }
+      if (space && !run.empty() && needsSpace(run[run.size() - 1], c))
+        run += ' ';
+      run += c;
+      space = false;
+    }
+  }
+  if (!run.empty())
+    out += run + "\n";
+  return out;
+}
+
+// 경로의 './' 와 'dir/../' 를 정리하여 같은 파일이 항상 같은 경로 문자열을 갖도록 함
+std::string ShaderPreprocessor::normalizePath(const std::string &path)
+{
+  std::vector<std::string> parts;
+  bool absolute = !path.empty() && (path[0] == '/' || path[0] == '\\');
+
+  size_t start = 0;
+  while (start <= path.size())
+  {
+    size_t end = path.find_first_of("/\\", start);
+    if (end == std::string::npos)
+      end = path.size();
+    std::string part = path.substr(start, end - start);
+    start = end + 1;
+
+    if (part.empty() || part == ".")
+      continue;
+    if (part == ".." && !parts.empty() && parts.back() != "..")
+    {
+      parts.pop_back();
+      continue;
+    }
+    parts.push_back(part);
+  }
+
+  std::string out = absolute ? "/" : "";
+  for (size_t i = 0; i < parts.size(); i++)
+  {
+    if (i > 0)
+      out += '/';
+    out += parts[i];
+  }
+  return out;
+}
+
+// 파일 캐시 정보 조회 (없으면 파일을 읽고 #include 지시문을 분석하여 생성)
+ShaderPreprocessor::File *ShaderPreprocessor::load(const std::string &path)
+{
+  File &file = entry(path);
+  if (file.loaded)
+    return &file;
+
+  // prefetch 되지 않은 파일이라면 여기서 직접 읽음
+  if (!readAsset(path, file.code))
+  {
+    std::cout << "ERROR::SHADER::FILE_NOT_SUCCESSFULLY_READ: " << path << std::endl;
+    return nullptr;
+  }
+  parse(file, path);
+  return &file;
+}
+
+// 파일 캐시 항목 조회
+ShaderPreprocessor::File &ShaderPreprocessor::entry(const std::string &path)
+{
+  std::map<std::string, File>::iterator it = files.find(path);
+  if (it == files.end())
+  {
+    // 처음 보는 파일이라면 새로운 파일 번호 발급
+    File file;
+    file.id = (int)fileNames.size();
+    file.loaded = false;
+    file.expanded[0] = file.expanded[1] = false;
+    file.expansionKeys[0] = file.expansionKeys[1] = 0;
+    file.contentHash = 0;
+    fileNames.push_back(path);
+    it = files.insert(std::make_pair(path, file)).first;
+  }
+  return it->second;
+}
+
+// 읽어들인 원본 코드의 해시 계산 및 #include 지시문 분석 후 loaded 로 표시
+void ShaderPreprocessor::parse(File &file, const std::string &path)
+{
+  file.contentHash = fnv1a64(file.code);
+
+  // #include 지시문을 미리 분석하여 의존성 그래프의 간선으로 기록
+  file.includes.clear();
+  std::vector<std::string> lines = splitLines(file.code);
+  for (size_t i = 0; i < lines.size(); i++)
+  {
+    std::string directive, rest, name;
+    if (!parseDirective(lines[i], directive, rest) || directive != "include")
+      continue;
+
+    if (!parseIncludeName(rest, name))
+    {
+      std::cout << "ERROR::SHADER::INVALID_INCLUDE: " << path << ":" << (i + 1) << std::endl;
+      file.includes.push_back(std::string());
+      continue;
+    }
+    file.includes.push_back(resolve(path, name));
+  }
+
+  file.loaded = true;
+}
+
+// I/O 스레드에서 실행할 prefetch 루프
+void ShaderPreprocessor::runPrefetch(std::vector<std::string> paths)
+{
+  std::set<std::string> visited;
+  while (!paths.empty())
+  {
+    std::string path = normalizePath(paths.back());
+    paths.pop_back();
+    if (path.empty() || !visited.insert(path).second)
+      continue;
+
+    // 이미 읽어둔 파일이라면 포함하는 파일들만 이어서 확인
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      std::map<std::string, File>::iterator it = files.find(path);
+      if (it != files.end() && it->second.loaded)
+      {
+        paths.insert(paths.end(), it->second.includes.begin(), it->second.includes.end());
+        continue;
+      }
+    }
+
+    // 디스크 I/O 는 잠금 없이 진행 (그동안 GL 스레드는 다른 파일을 계속 처리할 수 있음)
+    std::string code;
+    if (!readAsset(path, code))
+      continue;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    File &file = entry(path);
+    if (!file.loaded)
+    {
+      // 그 사이에 GL 스레드가 직접 읽지 않았을 때에만 캐시에 반영
+      file.code.swap(code);
+      parse(file, path);
+    }
+    paths.insert(paths.end(), file.includes.begin(), file.includes.end());
+  }
+}
+
+// #include 로 지정된 파일의 실제 경로 탐색
+std::string ShaderPreprocessor::resolve(const std::string &includer, const std::string &name) const
+{
+  // 1. 포함하는 파일과 같은 디렉토리
+  std::string candidate = normalizePath(directoryOf(includer) + name);
+  if (assetExists(candidate))
+    return candidate;
+
+  // 2. 등록된 검색 경로들
+  for (size_t i = 0; i < searchPaths.size(); i++)
+  {
+    candidate = normalizePath(searchPaths[i] + name);
+    if (assetExists(candidate))
+      return candidate;
+  }
+
+  std::cout << "ERROR::SHADER::INCLUDE_NOT_FOUND: \"" << name << "\" included from " << includer << std::endl;
+  return std::string();
+}
+
+// #include 를 재귀적으로 펼침
+bool ShaderPreprocessor::expand(const std::string &path, std::vector<std::string> &stack, bool isRoot, std::string &out, uint64_t &hash)
+{
+  // 순환 포함 검사
+  for (size_t i = 0; i < stack.size(); i++)
+  {
+    if (stack[i] == path)
+    {
+      std::cout << "ERROR::SHADER::CIRCULAR_INCLUDE: " << path << std::endl;
+      return false;
+    }
+  }
+
+  File *file = load(path);
+  if (!file)
+    return false;
+
+  // 포함된 파일들을 먼저 펼치고, 그 결과의 해시를 현재 파일의 해시와 엮어서 캐시 키를 만듦
+  stack.push_back(path);
+  std::vector<std::string> children(file->includes.size());
+  uint64_t key = fnv1a64(&file->contentHash, sizeof(file->contentHash));
+  key = fnv1a64(&file->id, sizeof(file->id), key);
+  key = fnv1a64(&isRoot, sizeof(isRoot), key);
+  for (size_t i = 0; i < file->includes.size(); i++)
+  {
+    uint64_t childHash = 0;
+    if (file->includes[i].empty() || !expand(file->includes[i], stack, false, children[i], childHash))
+    {
+      stack.pop_back();
+      return false;
+    }
+    key = fnv1a64(&childHash, sizeof(childHash), key);
+  }
+  stack.pop_back();
+  hash = key;
+
+  // 같은 내용으로 이미 펼쳐둔 결과가 있다면 재사용
+  std::map<uint64_t, std::string>::const_iterator cached = expansions.find(key);
+  if (cached != expansions.end())
+  {
+    out = cached->second;
+    return true;
+  }
+
+  /**
+   * #line <라인> <파일번호> 지시문 삽입 규칙
+   *
+   * - 포함된 파일은 첫 줄에 '#line 1 <파일번호>' 를 삽입
+   * - #include 를 펼친 직후에는 원래 파일의 다음 라인 번호로 되돌아가는 #line 을 삽입
+   * - 최상위 파일은 #version 이 반드시 가장 먼저 나와야 하므로, #version 바로 다음 줄에 #line 을 삽입
+   */
+  std::string result;
+  if (!isRoot)
+  {
+    result += lineDirective(1, file->id);
+  }
+
+  std::vector<std::string> lines = splitLines(file->code);
+  bool versionSeen = false;
+  size_t includeIndex = 0;
+  for (size_t i = 0; i < lines.size(); i++)
+  {
+    std::string directive, rest;
+    if (parseDirective(lines[i], directive, rest))
+    {
+      if (directive == "include")
+      {
+        result += children[includeIndex++];
+        result += lineDirective(i + 2, file->id);
+        continue;
+      }
+      if (isRoot && directive == "version" && !versionSeen)
+      {
+        result += lines[i] + "\n";
+        result += lineDirective(i + 2, file->id);
+        versionSeen = true;
+        continue;
+      }
+    }
+    result += lines[i] + "\n";
+  }
+
+  if (isRoot && !versionSeen)
+  {
+    result = lineDirective(1, file->id) + result;
+  }
+
+  // 파일마다 (포함된 파일, 최상위 파일로서) 가장 최근에 펼친 결과 하나씩만 남겨둠
+  if (file->expanded[isRoot] && file->expansionKeys[isRoot] != key)
+  {
+    expansions.erase(file->expansionKeys[isRoot]);
+  }
+  file->expanded[isRoot] = true;
+  file->expansionKeys[isRoot] = key;
+  expansions[key] = result;
+  out = result;
+  return true;
+}
+
+// 의존성 그래프를 따라 path 가 포함하는 파일들을 수집
+void ShaderPreprocessor::collect(const std::string &path, std::set<std::string> &visited, std::vector<std::string> &out)
+{
+  if (path.empty() || !visited.insert(path).second)
+    return;
+
+  out.push_back(path);
+
+  File *file = load(path);
+  if (!file)
+    return;
+
+  for (size_t i = 0; i < file->includes.size(); i++)
+  {
+    collect(file->includes[i], visited, out);
+  }
+}
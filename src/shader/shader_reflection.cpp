@@ -0,0 +1,325 @@
+#include "shader/shader_reflection.hpp"
+
+#include <algorithm> // std::sort, std::lower_bound
+#include <sstream>   // 문자열 스트림
+#include <iostream>  // 콘솔 입출력을 위한 헤더
+#include <set>       // std::set
+
+// 직렬화 형식 버전 (형식이 바뀌면 올려서 기존 캐시가 무시되도록 함)
+static const int REFLECTION_FORMAT_VERSION = 1;
+
+// 이름순 정렬 및 이진 탐색에 사용할 비교 함수
+template <typename T>
+static bool lessByName(const T &a, const T &b)
+{
+  return a.name < b.name;
+}
+
+template <typename T>
+static const T *findByName(const std::vector<T> &items, const std::string &name)
+{
+  T key;
+  key.name = name;
+  typename std::vector<T>::const_iterator it = std::lower_bound(items.begin(), items.end(), key, lessByName<T>);
+  if (it == items.end() || it->name != name)
+    return nullptr;
+  return &*it;
+}
+
+// 입력 변수 타입이 차지하는 location 개수(columns) 와 location 하나당 성분 개수(components) 조회
+// (mat4 는 vec4 4개, 즉 4개의 연속된 location 을 차지함. double 타입 등 지원하지 않는 타입이면 false 반환)
+static bool attributeShape(GLenum type, GLint &components, GLint &columns, bool &integer)
+{
+  columns = 1;
+  integer = false;
+  switch (type)
+  {
+  case GL_FLOAT: components = 1; return true;
+  case GL_FLOAT_VEC2: components = 2; return true;
+  case GL_FLOAT_VEC3: components = 3; return true;
+  case GL_FLOAT_VEC4: components = 4; return true;
+  case GL_FLOAT_MAT2: components = 2; columns = 2; return true;
+  case GL_FLOAT_MAT3: components = 3; columns = 3; return true;
+  case GL_FLOAT_MAT4: components = 4; columns = 4; return true;
+  case GL_FLOAT_MAT2x3: components = 3; columns = 2; return true;
+  case GL_FLOAT_MAT2x4: components = 4; columns = 2; return true;
+  case GL_FLOAT_MAT3x2: components = 2; columns = 3; return true;
+  case GL_FLOAT_MAT3x4: components = 4; columns = 3; return true;
+  case GL_FLOAT_MAT4x2: components = 2; columns = 4; return true;
+  case GL_FLOAT_MAT4x3: components = 3; columns = 4; return true;
+  default: break;
+  }
+
+  integer = true;
+  switch (type)
+  {
+  case GL_INT: case GL_UNSIGNED_INT: components = 1; return true;
+  case GL_INT_VEC2: case GL_UNSIGNED_INT_VEC2: components = 2; return true;
+  case GL_INT_VEC3: case GL_UNSIGNED_INT_VEC3: components = 3; return true;
+  case GL_INT_VEC4: case GL_UNSIGNED_INT_VEC4: components = 4; return true;
+  default: return false;
+  }
+}
+
+// 빈 메타데이터
+ShaderReflection::ShaderReflection()
+{
+}
+
+// 링킹이 완료된 program 에서 메타데이터 조회
+ShaderReflection ShaderReflection::reflect(GLuint program)
+{
+  ShaderReflection reflection;
+  GLint count = 0;
+  GLint maxLength = 0;
+  std::vector<char> name;
+
+  // 입력 변수
+  glGetProgramiv(program, GL_ACTIVE_ATTRIBUTES, &count);
+  glGetProgramiv(program, GL_ACTIVE_ATTRIBUTE_MAX_LENGTH, &maxLength);
+  name.resize(maxLength > 0 ? maxLength : 1);
+  for (GLint i = 0; i < count; i++)
+  {
+    ShaderAttribute attribute;
+    GLsizei length = 0;
+    glGetActiveAttrib(program, (GLuint)i, (GLsizei)name.size(), &length, &attribute.size, &attribute.type, name.data());
+    attribute.name.assign(name.data(), length);
+    attribute.location = glGetAttribLocation(program, attribute.name.c_str());
+    reflection.attributes.push_back(attribute);
+  }
+
+  // 유니폼 변수 (블록 번호와 블록 내 오프셋은 모든 유니폼에 대해 한 번에 조회)
+  count = 0;
+  maxLength = 0;
+  glGetProgramiv(program, GL_ACTIVE_UNIFORMS, &count);
+  glGetProgramiv(program, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxLength);
+  name.resize(maxLength > 0 ? maxLength : 1);
+  if (count > 0)
+  {
+    std::vector<GLuint> indices(count);
+    std::vector<GLint> blockIndices(count);
+    std::vector<GLint> blockOffsets(count);
+    for (GLint i = 0; i < count; i++)
+      indices[i] = (GLuint)i;
+    glGetActiveUniformsiv(program, count, indices.data(), GL_UNIFORM_BLOCK_INDEX, blockIndices.data());
+    glGetActiveUniformsiv(program, count, indices.data(), GL_UNIFORM_OFFSET, blockOffsets.data());
+
+    for (GLint i = 0; i < count; i++)
+    {
+      ShaderUniform uniform;
+      GLsizei length = 0;
+      glGetActiveUniform(program, (GLuint)i, (GLsizei)name.size(), &length, &uniform.size, &uniform.type, name.data());
+      uniform.name.assign(name.data(), length);
+      uniform.blockIndex = blockIndices[i];
+      uniform.blockOffset = blockOffsets[i];
+      uniform.location = uniform.blockIndex < 0 ? glGetUniformLocation(program, uniform.name.c_str()) : -1;
+      reflection.uniforms.push_back(uniform);
+    }
+  }
+
+  // 유니폼 블록
+  count = 0;
+  maxLength = 0;
+  glGetProgramiv(program, GL_ACTIVE_UNIFORM_BLOCKS, &count);
+  glGetProgramiv(program, GL_ACTIVE_UNIFORM_BLOCK_MAX_NAME_LENGTH, &maxLength);
+  name.resize(maxLength > 0 ? maxLength : 1);
+  for (GLint i = 0; i < count; i++)
+  {
+    ShaderUniformBlock block;
+    GLsizei length = 0;
+    glGetActiveUniformBlockName(program, (GLuint)i, (GLsizei)name.size(), &length, name.data());
+    block.name.assign(name.data(), length);
+    block.index = (GLuint)i;
+    block.dataSize = 0;
+    glGetActiveUniformBlockiv(program, (GLuint)i, GL_UNIFORM_BLOCK_DATA_SIZE, &block.dataSize);
+    reflection.uniformBlocks.push_back(block);
+  }
+
+  reflection.sort();
+  return reflection;
+}
+
+// serialize() 로 만든 문자열에서 메타데이터 복원
+bool ShaderReflection::deserialize(const std::string &data, ShaderReflection &reflection)
+{
+  std::istringstream in(data);
+  std::string tag;
+  int version = 0;
+  size_t count = 0;
+  ShaderReflection result;
+
+  if (!(in >> tag >> version) || tag != "REFLECTION" || version != REFLECTION_FORMAT_VERSION)
+    return false;
+
+  if (!(in >> tag >> count) || tag != "ATTRIBUTES")
+    return false;
+  result.attributes.resize(count);
+  for (size_t i = 0; i < count; i++)
+  {
+    ShaderAttribute &a = result.attributes[i];
+    if (!(in >> a.name >> a.location >> a.type >> a.size))
+      return false;
+  }
+
+  if (!(in >> tag >> count) || tag != "UNIFORMS")
+    return false;
+  result.uniforms.resize(count);
+  for (size_t i = 0; i < count; i++)
+  {
+    ShaderUniform &u = result.uniforms[i];
+    if (!(in >> u.name >> u.location >> u.type >> u.size >> u.blockIndex >> u.blockOffset))
+      return false;
+  }
+
+  if (!(in >> tag >> count) || tag != "BLOCKS")
+    return false;
+  result.uniformBlocks.resize(count);
+  for (size_t i = 0; i < count; i++)
+  {
+    ShaderUniformBlock &b = result.uniformBlocks[i];
+    if (!(in >> b.name >> b.index >> b.dataSize))
+      return false;
+  }
+
+  // 직접 편집된 캐시 파일일 수도 있으므로 정렬 상태를 다시 보장
+  result.sort();
+  reflection = result;
+  return true;
+}
+
+// 메타데이터를 텍스트 형태로 변환 (GLSL 식별자에는 공백이 없으므로 공백으로 구분)
+std::string ShaderReflection::serialize() const
+{
+  std::ostringstream out;
+  out << "REFLECTION " << REFLECTION_FORMAT_VERSION << "\n";
+
+  out << "ATTRIBUTES " << attributes.size() << "\n";
+  for (size_t i = 0; i < attributes.size(); i++)
+  {
+    const ShaderAttribute &a = attributes[i];
+    out << a.name << " " << a.location << " " << a.type << " " << a.size << "\n";
+  }
+
+  out << "UNIFORMS " << uniforms.size() << "\n";
+  for (size_t i = 0; i < uniforms.size(); i++)
+  {
+    const ShaderUniform &u = uniforms[i];
+    out << u.name << " " << u.location << " " << u.type << " " << u.size << " " << u.blockIndex << " " << u.blockOffset << "\n";
+  }
+
+  out << "BLOCKS " << uniformBlocks.size() << "\n";
+  for (size_t i = 0; i < uniformBlocks.size(); i++)
+  {
+    const ShaderUniformBlock &b = uniformBlocks[i];
+    out << b.name << " " << b.index << " " << b.dataSize << "\n";
+  }
+  return out.str();
+}
+
+// 이름으로 조회
+const ShaderAttribute *ShaderReflection::findAttribute(const std::string &name) const
+{
+  return findByName(attributes, name);
+}
+
+const ShaderUniform *ShaderReflection::findUniform(const std::string &name) const
+{
+  return findByName(uniforms, name);
+}
+
+const ShaderUniformBlock *ShaderReflection::findUniformBlock(const std::string &name) const
+{
+  return findByName(uniformBlocks, name);
+}
+
+// 전체 목록
+const std::vector<ShaderAttribute> &ShaderReflection::getAttributes() const
+{
+  return attributes;
+}
+
+const std::vector<ShaderUniform> &ShaderReflection::getUniforms() const
+{
+  return uniforms;
+}
+
+const std::vector<ShaderUniformBlock> &ShaderReflection::getUniformBlocks() const
+{
+  return uniformBlocks;
+}
+
+// 버텍스 쉐이더의 입력 변수들이 layout 과 일치하는지 확인
+bool ShaderReflection::validate(const VertexLayout &layout, const std::string &label) const
+{
+  bool valid = true;
+  std::set<GLuint> consumed; // 쉐이더가 실제로 읽는 location 들
+
+  for (size_t i = 0; i < attributes.size(); i++)
+  {
+    const ShaderAttribute &attribute = attributes[i];
+
+    // gl_VertexID 같은 내장 변수는 VAO 와 무관함
+    GLint components = 0, columns = 0;
+    bool integer = false;
+    if (attribute.location < 0 || !attributeShape(attribute.type, components, columns, integer))
+      continue;
+
+    // 행렬 및 배열 입력 변수는 연속된 여러 개의 location 을 차지하므로 모두 확인
+    for (GLint slot = 0; slot < columns * attribute.size; slot++)
+    {
+      GLuint location = (GLuint)(attribute.location + slot);
+      consumed.insert(location);
+
+      const VertexAttribute *vertexAttribute = layout.find(location);
+      if (!vertexAttribute)
+      {
+        std::cout << "ERROR::SHADER::VERTEX_ATTRIBUTE_MISSING: " << label << ": " << attribute.name
+                  << " (location " << location << ")" << std::endl;
+        valid = false;
+        continue;
+      }
+
+      /**
+       * 레이아웃의 성분 수가 쉐이더 입력보다 적은 것은 정상임. (빠진 성분은 GL 이 (0, 0, 0, 1) 로 채워줌)
+       * 예를 들어 vec3 위치 데이터를 vec4 입력으로 읽으면 w 는 1 이 되므로 흔히 사용하는 방식이고,
+       * 쉐이더가 읽을 수 있는 것보다 많은 성분을 넘기는 경우만 레이아웃이 잘못된 것으로 봄.
+       */
+      if (vertexAttribute->components > components)
+      {
+        std::cout << "ERROR::SHADER::VERTEX_ATTRIBUTE_COMPONENT_MISMATCH: " << label << ": " << attribute.name
+                  << " (location " << location << ") expects at most " << components << " components, layout provides "
+                  << vertexAttribute->components << std::endl;
+        valid = false;
+      }
+
+      if (vertexAttribute->isInteger() != integer)
+      {
+        std::cout << "ERROR::SHADER::VERTEX_ATTRIBUTE_TYPE_MISMATCH: " << label << ": " << attribute.name
+                  << " (location " << location << ") expects " << (integer ? "integer" : "float")
+                  << " input" << std::endl;
+        valid = false;
+      }
+    }
+  }
+
+  // 쉐이더가 읽지 않는 속성은 에러는 아니지만, 정점 데이터 대역폭을 낭비하므로 알려줌
+  const std::vector<VertexAttribute> &vertexAttributes = layout.getAttributes();
+  for (size_t i = 0; i < vertexAttributes.size(); i++)
+  {
+    if (consumed.count(vertexAttributes[i].location) == 0)
+    {
+      std::cout << "WARNING::SHADER::VERTEX_ATTRIBUTE_UNUSED: " << label << ": location "
+                << vertexAttributes[i].location << std::endl;
+    }
+  }
+
+  return valid;
+}
+
+// 각 목록을 이름순으로 정렬
+void ShaderReflection::sort()
+{
+  std::sort(attributes.begin(), attributes.end(), lessByName<ShaderAttribute>);
+  std::sort(uniforms.begin(), uniforms.end(), lessByName<ShaderUniform>);
+  std::sort(uniformBlocks.begin(), uniformBlocks.end(), lessByName<ShaderUniformBlock>);
+}
@@ -0,0 +1,131 @@
+#include "shader/shader_stats.hpp"
+
+#include <iostream>  // 콘솔 입출력을 위한 헤더
+#include <iomanip>   // std::setw, std::setprecision
+#include <algorithm> // std::sort, std::max
+
+// "#define A\n#define B 1\n" 처럼 여러 줄로 된 #define 블록을 "A, B 1" 처럼 한 줄로 요약
+static std::string summarizeDefines(const std::string &defines)
+{
+  static const std::string DIRECTIVE = "#define ";
+  std::string summary;
+  size_t start = 0;
+  while (start < defines.size())
+  {
+    size_t end = defines.find('\n', start);
+    if (end == std::string::npos)
+      end = defines.size();
+
+    std::string line = defines.substr(start, end - start);
+    if (line.compare(0, DIRECTIVE.size(), DIRECTIVE) == 0)
+      line = line.substr(DIRECTIVE.size());
+    if (!line.empty())
+    {
+      if (!summary.empty())
+        summary += ", ";
+      summary += line;
+    }
+    start = end + 1;
+  }
+  return summary;
+}
+
+// 컴파일 비용이 큰 순서대로 정렬하기 위한 비교 함수
+static bool compareCompileCost(const ShaderTiming *a, const ShaderTiming *b)
+{
+  return a->compileMs() > b->compileMs();
+}
+
+/** ShaderTiming 구현부 */
+
+ShaderTiming::ShaderTiming()
+    : sourceBytes(0), cached(false), readMs(0.0), vertexMs(0.0), fragmentMs(0.0), linkMs(0.0), completionMs(-1.0)
+{
+}
+
+// 컴파일 비용 (호출 시간의 합과 완료까지 걸린 시간 중 큰 값)
+double ShaderTiming::compileMs() const
+{
+  return std::max(vertexMs + fragmentMs + linkMs, completionMs);
+}
+
+/** ShaderStats 구현부 */
+
+// 프로세스 전역에서 공유하는 인스턴스
+ShaderStats &ShaderStats::shared()
+{
+  static ShaderStats instance;
+  return instance;
+}
+
+// 쉐이더 프로그램 하나의 측정 결과 기록
+void ShaderStats::record(const ShaderTiming &timing)
+{
+  timings.push_back(timing);
+}
+
+// 지금까지 기록된 측정 결과
+const std::vector<ShaderTiming> &ShaderStats::getTimings() const
+{
+  return timings;
+}
+
+// 컴파일 비용이 큰 순서대로 maxRows 개(0 이면 전부)의 측정 결과를 콘솔에 출력
+void ShaderStats::report(size_t maxRows) const
+{
+  std::vector<const ShaderTiming *> sorted;
+  double totalRead = 0.0;
+  double totalCompile = 0.0;
+  size_t cacheHits = 0;
+  for (size_t i = 0; i < timings.size(); i++)
+  {
+    sorted.push_back(&timings[i]);
+    totalRead += timings[i].readMs;
+    totalCompile += timings[i].compileMs();
+    if (timings[i].cached)
+      cacheHits++;
+  }
+  std::sort(sorted.begin(), sorted.end(), compareCompileCost);
+
+  size_t rows = (maxRows == 0 || maxRows > sorted.size()) ? sorted.size() : maxRows;
+
+  // 출력 형식을 바꾸므로 기존 형식을 저장해두었다가 복원
+  std::ios::fmtflags flags = std::cout.flags();
+  std::streamsize precision = std::cout.precision();
+
+  std::cout << "SHADER::STATS: " << timings.size() << " programs (" << cacheHits << " from binary cache), "
+            << std::fixed << std::setprecision(2) << "read " << totalRead << " ms, compile " << totalCompile << " ms\n"
+            << "  compile ms |  read |  vert |  frag |  link |  done | bytes  | program\n";
+  for (size_t i = 0; i < rows; i++)
+  {
+    const ShaderTiming &timing = *sorted[i];
+    std::cout << "  " << std::setw(10) << timing.compileMs()
+              << " | " << std::setw(5) << timing.readMs
+              << " | " << std::setw(5) << timing.vertexMs
+              << " | " << std::setw(5) << timing.fragmentMs
+              << " | " << std::setw(5) << timing.linkMs
+              << " | ";
+    if (timing.completionMs >= 0.0)
+      std::cout << std::setw(5) << timing.completionMs;
+    else
+      std::cout << "    -";
+    std::cout << " | " << std::setw(6) << timing.sourceBytes
+              << " | " << timing.vertexPath << " + " << timing.fragmentPath;
+
+    std::string defines = summarizeDefines(timing.defines);
+    if (!defines.empty())
+      std::cout << " [" << defines << "]";
+    if (timing.cached)
+      std::cout << " (cached)";
+    std::cout << "\n";
+  }
+  std::cout << std::flush;
+  std::cout.flags(flags);
+  std::cout.precision(precision);
+}
+
+// 기록된 측정 결과 모두 삭제
+void ShaderStats::clear()
+{
+  timings.clear();
+}
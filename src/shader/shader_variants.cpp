@@ -0,0 +1,64 @@
+#include "shader/shader_variants.hpp"
+
+#include <iostream> // 콘솔 입출력을 위한 헤더
+
+// ShaderVariants 클래스 생성자
+ShaderVariants::ShaderVariants(ShaderLibrary &library, const std::string &vertexPath, const std::string &fragmentPath,
+                               const std::vector<std::string> &defineNames, size_t maxVariants)
+    : library(library), vertexPath(vertexPath), fragmentPath(fragmentPath), defineNames(defineNames),
+      maxVariants(maxVariants > 0 ? maxVariants : 1)
+{
+  // 비트마스크는 unsigned int 이므로 최대 32개의 define 만 표현할 수 있음
+  if (this->defineNames.size() > sizeof(unsigned int) * 8)
+  {
+    std::cout << "ERROR::SHADER_VARIANTS::TOO_MANY_DEFINES: " << this->defineNames.size() << std::endl;
+    this->defineNames.resize(sizeof(unsigned int) * 8);
+  }
+}
+
+// mask 에 해당하는 쉐이더 변형 반환 (처음 요청된 변형이라면 이때 컴파일을 요청함)
+ShaderFuture ShaderVariants::get(unsigned int mask)
+{
+  std::map<unsigned int, Variant>::iterator it = variants.find(mask);
+  if (it != variants.end())
+  {
+    // 캐시 적중 : LRU 목록의 맨 앞으로 이동 (splice 는 노드만 옮기므로 iterator 가 그대로 유효함)
+    lru.splice(lru.begin(), lru, it->second.lruPos);
+    return it->second.future;
+  }
+
+  // 캐시가 가득 찼다면 가장 오랫동안 요청되지 않은 변형 제거
+  while (variants.size() >= maxVariants && !lru.empty())
+  {
+    variants.erase(lru.back());
+    lru.pop_back();
+  }
+
+  // 처음 요청된 변형이므로 컴파일 요청
+  Variant variant;
+  variant.future = library.submit(vertexPath, fragmentPath, makeDefines(mask));
+  lru.push_front(mask);
+  variant.lruPos = lru.begin();
+  variants[mask] = variant;
+  return variant.future;
+}
+
+// 현재 캐시된 변형 개수
+size_t ShaderVariants::size() const
+{
+  return variants.size();
+}
+
+// mask 에 해당하는 #define 블록 생성
+std::string ShaderVariants::makeDefines(unsigned int mask) const
+{
+  std::string defines;
+  for (size_t i = 0; i < defineNames.size(); i++)
+  {
+    if (mask & (1u << i))
+    {
+      defines += "#define " + defineNames[i] + " 1\n";
+    }
+  }
+  return defines;
+}
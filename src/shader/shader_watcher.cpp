@@ -0,0 +1,265 @@
+#include "shader/shader_watcher.hpp"
+#include "shader/shader.hpp"
+#include "shader/shader_preprocessor.hpp"
+
+#include <iostream> // 콘솔 입출력을 위한 헤더
+
+#ifdef __linux__
+#include <sys/inotify.h> // inotify_init1, inotify_add_watch
+#include <poll.h>        // poll
+#include <unistd.h>      // read, write, close, pipe
+#include <fcntl.h>       // O_CLOEXEC
+#include <cerrno>        // errno
+#endif
+
+// 파일 경로를 '디렉토리 경로 + /' 와 파일명으로 분리 (디렉토리가 없으면 빈 문자열)
+static std::string directoryPrefix(const std::string &path)
+{
+  size_t slash = path.find_last_of("/\\");
+  return slash == std::string::npos ? std::string() : path.substr(0, slash + 1);
+}
+
+// ShaderWatcher 클래스 생성자 (감시 스레드 시작)
+ShaderWatcher::ShaderWatcher()
+    : inotifyFd(-1), hasChanges(false)
+{
+  wakeFd[0] = wakeFd[1] = -1;
+
+#ifdef __linux__
+  inotifyFd = inotify_init1(IN_CLOEXEC);
+  if (inotifyFd < 0)
+  {
+    std::cout << "ERROR::SHADER_WATCHER::INOTIFY_INIT_FAILED" << std::endl;
+    return;
+  }
+
+  if (pipe2(wakeFd, O_CLOEXEC) != 0)
+  {
+    std::cout << "ERROR::SHADER_WATCHER::PIPE_CREATION_FAILED" << std::endl;
+    close(inotifyFd);
+    inotifyFd = -1;
+    return;
+  }
+
+  thread = std::thread(&ShaderWatcher::run, this);
+#endif
+}
+
+// ShaderWatcher 클래스 소멸자 (감시 스레드 종료)
+ShaderWatcher::~ShaderWatcher()
+{
+#ifdef __linux__
+  if (thread.joinable())
+  {
+    // 파이프에 1바이트를 써서 poll() 에서 대기중인 감시 스레드를 깨움
+    char wake = 1;
+    if (write(wakeFd[1], &wake, 1) < 0)
+    {
+      std::cout << "ERROR::SHADER_WATCHER::WAKE_FAILED" << std::endl;
+    }
+    thread.join();
+  }
+
+  if (inotifyFd >= 0)
+    close(inotifyFd);
+  if (wakeFd[0] >= 0)
+    close(wakeFd[0]);
+  if (wakeFd[1] >= 0)
+    close(wakeFd[1]);
+#endif
+
+  // 아직 감시 중인 Shader 객체들이 해제된 ShaderWatcher 에 접근하지 않도록 연결 해제
+  for (std::map<Shader *, Sources>::iterator it = shaders.begin(); it != shaders.end(); ++it)
+  {
+    it->first->watcher = nullptr;
+  }
+}
+
+// 현재 플랫폼에서 파일 감시를 지원하는지 여부
+bool ShaderWatcher::isSupported() const
+{
+  return inotifyFd >= 0;
+}
+
+// 프레임 경계에서 호출하여, 수정된 쉐이더들의 재컴파일 요청 및 완료된 프로그램 교체
+bool ShaderWatcher::poll()
+{
+  // 빠른 경로 : 수정된 파일도 없고 진행중인 재컴파일도 없다면 곧바로 반환
+  if (!hasChanges.load(std::memory_order_acquire) && reloading.empty())
+    return false;
+
+  // 감시 스레드에서 읽어둔 새로운 쉐이더 코드로 재컴파일 시작
+  if (hasChanges.exchange(false, std::memory_order_acquire))
+  {
+    std::map<Shader *, Code> work;
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      work.swap(changed);
+    }
+
+    for (std::map<Shader *, Code>::iterator it = work.begin(); it != work.end(); ++it)
+    {
+      it->first->beginReload(it->second.vertexCode, it->second.fragmentCode);
+      reloading.insert(it->first);
+    }
+  }
+
+  // 재컴파일이 끝난 Shader 객체들의 프로그램 교체
+  bool swapped = false;
+  for (std::set<Shader *>::iterator it = reloading.begin(); it != reloading.end();)
+  {
+    bool replaced = false;
+    if ((*it)->finishReload(replaced))
+    {
+      swapped = swapped || replaced;
+      reloading.erase(it++);
+    }
+    else
+    {
+      ++it;
+    }
+  }
+  return swapped;
+}
+
+// Shader 객체의 소스 파일 경로들을 감시 대상으로 등록
+void ShaderWatcher::add(Shader *shader, const std::string &vertexPath, const std::string &fragmentPath, const std::string &defines)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+
+  Sources &sources = shaders[shader];
+  sources.vertexPath = vertexPath;
+  sources.fragmentPath = fragmentPath;
+  sources.defines = defines;
+  watchDependencies(sources);
+}
+
+// Sources 의 의존 파일 목록을 갱신하고, 해당 파일들이 있는 디렉토리를 감시 대상으로 추가
+void ShaderWatcher::watchDependencies(Sources &sources)
+{
+  // 버텍스 / 프래그먼트 쉐이더가 #include 로 포함하는 파일들이 수정되어도 재컴파일해야 함
+  std::vector<std::string> vertexFiles = ShaderPreprocessor::shared().dependencies(sources.vertexPath);
+  std::vector<std::string> fragmentFiles = ShaderPreprocessor::shared().dependencies(sources.fragmentPath);
+  sources.files.clear();
+  sources.files.insert(vertexFiles.begin(), vertexFiles.end());
+  sources.files.insert(fragmentFiles.begin(), fragmentFiles.end());
+
+#ifdef __linux__
+  if (inotifyFd < 0)
+    return;
+
+  // 의존 파일들이 들어있는 디렉토리들을 감시 대상으로 추가 (같은 디렉토리는 같은 watch descriptor 를 반환함)
+  for (std::set<std::string>::const_iterator it = sources.files.begin(); it != sources.files.end(); ++it)
+  {
+    std::string prefix = directoryPrefix(*it);
+    std::string directory = prefix.empty() ? std::string(".") : prefix;
+    int wd = inotify_add_watch(inotifyFd, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO);
+    if (wd < 0)
+    {
+      std::cout << "ERROR::SHADER_WATCHER::WATCH_FAILED: " << directory << std::endl;
+      continue;
+    }
+    directories[wd] = prefix;
+  }
+#endif
+}
+
+// Shader 객체를 감시 대상에서 제거
+void ShaderWatcher::remove(Shader *shader)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  shaders.erase(shader);
+  changed.erase(shader);
+  reloading.erase(shader);
+}
+
+// 감시 스레드에서 실행할 루프
+void ShaderWatcher::run()
+{
+#ifdef __linux__
+  // inotify_event 구조체는 가변 길이이므로, 정렬을 맞춘 버퍼에 여러 개의 이벤트를 한꺼번에 읽어들임
+  alignas(struct inotify_event) char buffer[4096];
+
+  while (true)
+  {
+    // 파일 변경 이벤트 또는 종료 요청이 들어올 때까지 블로킹 (이 동안 CPU 를 전혀 사용하지 않음)
+    struct pollfd fds[2];
+    fds[0].fd = inotifyFd;
+    fds[0].events = POLLIN;
+    fds[0].revents = 0;
+    fds[1].fd = wakeFd[0];
+    fds[1].events = POLLIN;
+    fds[1].revents = 0;
+
+    if (::poll(fds, 2, -1) < 0)
+    {
+      if (errno == EINTR)
+        continue;
+      break;
+    }
+
+    // 종료 요청
+    if (fds[1].revents & POLLIN)
+      break;
+
+    ssize_t length = read(inotifyFd, buffer, sizeof(buffer));
+    if (length <= 0)
+      continue;
+
+    for (char *ptr = buffer; ptr < buffer + length;)
+    {
+      const struct inotify_event *event = reinterpret_cast<const struct inotify_event *>(ptr);
+      ptr += sizeof(struct inotify_event) + event->len;
+
+      if (event->len == 0)
+        continue;
+
+      std::string prefix;
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        std::map<int, std::string>::const_iterator it = directories.find(event->wd);
+        if (it == directories.end())
+          continue;
+        prefix = it->second;
+      }
+
+      onFileChanged(prefix + event->name);
+    }
+  }
+#endif
+}
+
+// 감시 스레드에서 파일 변경이 감지되었을 때, 해당 파일을 사용하는 Shader 객체들의 소스코드를 다시 읽어둠
+void ShaderWatcher::onFileChanged(const std::string &path)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+
+  // 전처리기 캐시에 남아있는 이전 파일 내용을 무효화
+  ShaderPreprocessor::shared().invalidate(path);
+
+  bool found = false;
+  for (std::map<Shader *, Sources>::iterator it = shaders.begin(); it != shaders.end(); ++it)
+  {
+    if (it->second.files.find(path) == it->second.files.end())
+      continue;
+
+    // 파일 읽기 및 #include 전처리는 감시 스레드에서 미리 처리해두고, 메인 스레드에서는 컴파일만 요청하도록 함
+    Code code;
+    // (쉐이더 변형이라면 등록할 때 복사해둔 #define 블록을 다시 삽입함. Shader 객체는 메인 스레드에서 이동될 수 있으므로 멤버를 직접 읽지 않음)
+    code.vertexCode = Shader::loadShaderSource(it->second.vertexPath.c_str(), it->second.defines);
+    code.fragmentCode = Shader::loadShaderSource(it->second.fragmentPath.c_str(), it->second.defines);
+    if (code.vertexCode.empty() || code.fragmentCode.empty())
+      continue;
+
+    // 수정된 파일에서 #include 가 추가되거나 제거되었을 수 있으므로 의존 파일 목록 갱신
+    watchDependencies(it->second);
+
+    changed[it->first] = code;
+    found = true;
+  }
+
+  if (found)
+  {
+    hasChanges.store(true, std::memory_order_release);
+  }
+}
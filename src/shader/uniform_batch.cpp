@@ -0,0 +1,187 @@
+#include "shader/uniform_batch.hpp"
+#include "shader/shader.hpp"
+
+#include <cstring> // std::memcpy, std::memcmp
+
+// UniformBatch 클래스 생성자
+UniformBatch::UniformBatch()
+    : program(0)
+{
+}
+
+// 값 설정
+void UniformBatch::setInt(const std::string &name, int value)
+{
+  stage(name, KIND_INT, &value, 1, sizeof(int));
+}
+
+void UniformBatch::setFloat(const std::string &name, float value)
+{
+  stage(name, KIND_FLOAT, &value, 1, sizeof(float));
+}
+
+void UniformBatch::setVec2(const std::string &name, const glm::vec2 &value)
+{
+  stage(name, KIND_VEC2, &value[0], 1, sizeof(glm::vec2));
+}
+
+void UniformBatch::setVec3(const std::string &name, const glm::vec3 &value)
+{
+  stage(name, KIND_VEC3, &value[0], 1, sizeof(glm::vec3));
+}
+
+void UniformBatch::setVec4(const std::string &name, const glm::vec4 &value)
+{
+  stage(name, KIND_VEC4, &value[0], 1, sizeof(glm::vec4));
+}
+
+void UniformBatch::setMat3(const std::string &name, const glm::mat3 &mat)
+{
+  stage(name, KIND_MAT3, &mat[0][0], 1, sizeof(glm::mat3));
+}
+
+void UniformBatch::setMat4(const std::string &name, const glm::mat4 &mat)
+{
+  stage(name, KIND_MAT4, &mat[0][0], 1, sizeof(glm::mat4));
+}
+
+// 배열 값 설정
+void UniformBatch::setIntArray(const std::string &name, const int *values, GLsizei count)
+{
+  stage(name, KIND_INT, values, count, sizeof(int));
+}
+
+void UniformBatch::setFloatArray(const std::string &name, const float *values, GLsizei count)
+{
+  stage(name, KIND_FLOAT, values, count, sizeof(float));
+}
+
+void UniformBatch::setVec4Array(const std::string &name, const glm::vec4 *values, GLsizei count)
+{
+  stage(name, KIND_VEC4, values, count, sizeof(glm::vec4));
+}
+
+void UniformBatch::setMat4Array(const std::string &name, const glm::mat4 *mats, GLsizei count)
+{
+  stage(name, KIND_MAT4, mats, count, sizeof(glm::mat4));
+}
+
+// 바뀐 값들을 shader 에 전송
+size_t UniformBatch::flush(const Shader &shader)
+{
+  // 다른 쉐이더 프로그램이라면 location 을 다시 조회하고, 이전 프로그램에 전송했던 값은 무효이므로 모두 다시 전송
+  if (shader.ID.get() != program)
+  {
+    program = shader.ID.get();
+    dirtySlots.clear();
+    for (size_t i = 0; i < slots.size(); i++)
+    {
+      slots[i].location = shader.getUniformLocation(slots[i].name);
+      slots[i].resolved = true;
+      slots[i].uploaded = false;
+      slots[i].dirty = true;
+      dirtySlots.push_back(i);
+    }
+  }
+
+  // dirty 로 표시된 값들만 한 번에 전송
+  size_t uploadedCount = 0;
+  for (size_t i = 0; i < dirtySlots.size(); i++)
+  {
+    Slot &slot = slots[dirtySlots[i]];
+    if (!slot.resolved)
+    {
+      slot.location = shader.getUniformLocation(slot.name);
+      slot.resolved = true;
+    }
+    if (slot.location >= 0)
+    {
+      upload(slot);
+      uploadedCount++;
+    }
+    std::memcpy(&shadow[slot.offset], &values[slot.offset], slot.size);
+    slot.uploaded = true;
+    slot.dirty = false;
+  }
+  dirtySlots.clear();
+  return uploadedCount;
+}
+
+// 값을 내부 버퍼에 복사하고, 마지막으로 전송한 값과 다르면 dirty 로 표시
+void UniformBatch::stage(const std::string &name, Kind kind, const void *data, GLsizei count, size_t elementSize)
+{
+  size_t size = elementSize * (size_t)count;
+
+  std::map<std::string, size_t>::iterator it = slotIndices.find(name);
+  if (it == slotIndices.end())
+  {
+    // 처음 설정되는 유니폼이라면 버퍼 끝에 공간을 만들어 둠 (location 은 전송 직전에 조회)
+    Slot slot;
+    slot.name = name;
+    slot.kind = kind;
+    slot.location = -1;
+    slot.resolved = false;
+    slot.count = count;
+    slot.offset = values.size();
+    slot.size = size;
+    slot.uploaded = false;
+    slot.dirty = false;
+    values.resize(values.size() + size);
+    shadow.resize(values.size());
+
+    it = slotIndices.insert(std::make_pair(name, slots.size())).first;
+    slots.push_back(slot);
+  }
+
+  Slot &slot = slots[it->second];
+  if (slot.size != size || slot.kind != kind)
+  {
+    // 배열 크기가 바뀌었다면 버퍼 끝에 새로운 공간을 할당 (이전 공간은 버려둠)
+    slot.kind = kind;
+    slot.count = count;
+    slot.offset = values.size();
+    slot.size = size;
+    slot.uploaded = false;
+    values.resize(values.size() + size);
+    shadow.resize(values.size());
+  }
+
+  std::memcpy(&values[slot.offset], data, size);
+
+  // 마지막으로 전송한 값과 같다면 전송할 필요 없음
+  if (slot.dirty || (slot.uploaded && std::memcmp(&values[slot.offset], &shadow[slot.offset], size) == 0))
+    return;
+
+  slot.dirty = true;
+  dirtySlots.push_back(it->second);
+}
+
+// Slot 하나를 현재 바인딩된 쉐이더 프로그램에 전송
+void UniformBatch::upload(const Slot &slot) const
+{
+  const GLfloat *floats = reinterpret_cast<const GLfloat *>(&values[slot.offset]);
+  switch (slot.kind)
+  {
+  case KIND_INT:
+    glUniform1iv(slot.location, slot.count, reinterpret_cast<const GLint *>(&values[slot.offset]));
+    break;
+  case KIND_FLOAT:
+    glUniform1fv(slot.location, slot.count, floats);
+    break;
+  case KIND_VEC2:
+    glUniform2fv(slot.location, slot.count, floats);
+    break;
+  case KIND_VEC3:
+    glUniform3fv(slot.location, slot.count, floats);
+    break;
+  case KIND_VEC4:
+    glUniform4fv(slot.location, slot.count, floats);
+    break;
+  case KIND_MAT3:
+    glUniformMatrix3fv(slot.location, slot.count, GL_FALSE, floats);
+    break;
+  case KIND_MAT4:
+    glUniformMatrix4fv(slot.location, slot.count, GL_FALSE, floats);
+    break;
+  }
+}
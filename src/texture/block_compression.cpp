@@ -0,0 +1,458 @@
+#include "texture/block_compression.hpp"
+
+#include <cmath>   // std::sqrt, std::fabs
+#include <cstring> // std::memset, std::memcpy
+#include <thread>  // std::thread
+#include <vector>  // std::vector
+
+// BC7 의 4 비트 인덱스 보간 가중치 (64 분율)
+static const int BC7_WEIGHTS4[16] = {0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+
+static int clampInt(int value, int low, int high)
+{
+  return value < low ? low : (value > high ? high : value);
+}
+
+static float clampFloat(float value, float low, float high)
+{
+  return value < low ? low : (value > high ? high : value);
+}
+
+// 블록의 16 개 픽셀에서 channels 개의 채널만 사용하여 엔드포인트 후보 두 쌍 계산
+// (candidates[0] : 주성분 축의 양 끝, candidates[1] : 채널별 최솟값 / 최댓값으로 만든 바운딩 박스의 양 끝)
+static void findEndpoints(const uint8_t rgba[64], int channels, float lo[2][4], float hi[2][4])
+{
+  float mean[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+  float minimum[4] = {255.0f, 255.0f, 255.0f, 255.0f};
+  float maximum[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+  for (int i = 0; i < 16; i++)
+  {
+    for (int c = 0; c < channels; c++)
+    {
+      float value = rgba[i * 4 + c];
+      mean[c] += value;
+      minimum[c] = value < minimum[c] ? value : minimum[c];
+      maximum[c] = value > maximum[c] ? value : maximum[c];
+    }
+  }
+  for (int c = 0; c < channels; c++)
+  {
+    mean[c] /= 16.0f;
+  }
+
+  // 공분산 행렬
+  float covariance[4][4];
+  std::memset(covariance, 0, sizeof(covariance));
+  for (int i = 0; i < 16; i++)
+  {
+    float d[4];
+    for (int c = 0; c < channels; c++)
+      d[c] = rgba[i * 4 + c] - mean[c];
+    for (int a = 0; a < channels; a++)
+      for (int b = 0; b < channels; b++)
+        covariance[a][b] += d[a] * d[b];
+  }
+
+  // 거듭제곱법(power iteration)으로 분산이 가장 큰 방향(주성분 축) 계산
+  float axis[4] = {1.0f, 1.0f, 1.0f, 1.0f};
+  for (int iteration = 0; iteration < 8; iteration++)
+  {
+    float next[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+    float largest = 0.0f;
+    for (int a = 0; a < channels; a++)
+    {
+      for (int b = 0; b < channels; b++)
+        next[a] += covariance[a][b] * axis[b];
+      largest = std::fabs(next[a]) > largest ? std::fabs(next[a]) : largest;
+    }
+    if (largest < 1e-6f)
+      break;
+    for (int c = 0; c < channels; c++)
+      axis[c] = next[c] / largest;
+  }
+  float length = 0.0f;
+  for (int c = 0; c < channels; c++)
+    length += axis[c] * axis[c];
+  length = std::sqrt(length);
+
+  // 픽셀들을 주성분 축에 투영했을 때의 양 끝
+  float minT = 0.0f;
+  float maxT = 0.0f;
+  if (length > 1e-6f)
+  {
+    for (int c = 0; c < channels; c++)
+      axis[c] /= length;
+    minT = 1e30f;
+    maxT = -1e30f;
+    for (int i = 0; i < 16; i++)
+    {
+      float t = 0.0f;
+      for (int c = 0; c < channels; c++)
+        t += (rgba[i * 4 + c] - mean[c]) * axis[c];
+      minT = t < minT ? t : minT;
+      maxT = t > maxT ? t : maxT;
+    }
+  }
+
+  for (int c = 0; c < channels; c++)
+  {
+    lo[0][c] = clampFloat(mean[c] + minT * axis[c], 0.0f, 255.0f);
+    hi[0][c] = clampFloat(mean[c] + maxT * axis[c], 0.0f, 255.0f);
+    lo[1][c] = minimum[c];
+    hi[1][c] = maximum[c];
+  }
+}
+
+// 두 색상 사이의 채널별 제곱 오차 합
+static int squaredError(const uint8_t *pixel, const int *color, int channels)
+{
+  int error = 0;
+  for (int c = 0; c < channels; c++)
+  {
+    int d = (int)pixel[c] - color[c];
+    error += d * d;
+  }
+  return error;
+}
+
+// 비트 단위로 블록 데이터를 채워넣는 헬퍼 (LSB 부터 채움)
+struct BitWriter
+{
+  uint8_t *out;
+  int position;
+
+  explicit BitWriter(uint8_t *out) : out(out), position(0) {}
+
+  void write(uint32_t value, int bits)
+  {
+    for (int b = 0; b < bits; b++)
+    {
+      if ((value >> b) & 1u)
+        out[position >> 3] |= (uint8_t)(1u << (position & 7));
+      position++;
+    }
+  }
+};
+
+/** BC1 */
+
+// 0 ~ 255 범위의 RGB 를 RGB565 로 양자화
+static uint16_t packRGB565(const float color[4])
+{
+  int r = clampInt((int)(color[0] * 31.0f / 255.0f + 0.5f), 0, 31);
+  int g = clampInt((int)(color[1] * 63.0f / 255.0f + 0.5f), 0, 63);
+  int b = clampInt((int)(color[2] * 31.0f / 255.0f + 0.5f), 0, 31);
+  return (uint16_t)((r << 11) | (g << 5) | b);
+}
+
+// RGB565 를 0 ~ 255 범위의 RGB 로 복원 (GPU 와 같은 비트 복제 방식)
+static void unpackRGB565(uint16_t packed, int out[3])
+{
+  int r = (packed >> 11) & 31;
+  int g = (packed >> 5) & 63;
+  int b = packed & 31;
+  out[0] = (r << 3) | (r >> 2);
+  out[1] = (g << 2) | (g >> 4);
+  out[2] = (b << 3) | (b >> 2);
+}
+
+// 두 엔드포인트로 BC1 색상 블록을 만들고 제곱 오차 합 반환
+static int encodeBC1Endpoints(const uint8_t rgba[64], uint16_t color0, uint16_t color1, uint8_t out[8])
+{
+  // 4 색상 모드를 사용하려면 color0 > color1 이어야 함
+  if (color0 < color1)
+  {
+    uint16_t temp = color0;
+    color0 = color1;
+    color1 = temp;
+  }
+
+  int palette[4][3];
+  unpackRGB565(color0, palette[0]);
+  unpackRGB565(color1, palette[1]);
+  for (int c = 0; c < 3; c++)
+  {
+    palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+    palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+  }
+
+  // 두 엔드포인트가 같다면 모든 픽셀이 color0 을 사용 (3 색상 모드가 되지만 인덱스 0 은 동일함)
+  int paletteSize = color0 == color1 ? 1 : 4;
+
+  uint32_t indices = 0;
+  int totalError = 0;
+  for (int i = 0; i < 16; i++)
+  {
+    int best = 0;
+    int bestError = squaredError(&rgba[i * 4], palette[0], 3);
+    for (int k = 1; k < paletteSize; k++)
+    {
+      int error = squaredError(&rgba[i * 4], palette[k], 3);
+      if (error < bestError)
+      {
+        best = k;
+        bestError = error;
+      }
+    }
+    indices |= (uint32_t)best << (2 * i);
+    totalError += bestError;
+  }
+
+  out[0] = (uint8_t)(color0 & 0xFF);
+  out[1] = (uint8_t)(color0 >> 8);
+  out[2] = (uint8_t)(color1 & 0xFF);
+  out[3] = (uint8_t)(color1 >> 8);
+  for (int b = 0; b < 4; b++)
+    out[4 + b] = (uint8_t)(indices >> (8 * b));
+  return totalError;
+}
+
+void encodeBC1Block(const uint8_t rgba[64], uint8_t out[8])
+{
+  float lo[2][4], hi[2][4];
+  findEndpoints(rgba, 3, lo, hi);
+
+  // 두 엔드포인트 후보 중 오차가 작은 쪽을 사용
+  uint8_t candidate[8];
+  int bestError = encodeBC1Endpoints(rgba, packRGB565(hi[0]), packRGB565(lo[0]), out);
+  int error = encodeBC1Endpoints(rgba, packRGB565(hi[1]), packRGB565(lo[1]), candidate);
+  if (error < bestError)
+    std::memcpy(out, candidate, 8);
+}
+
+/** BC3 */
+
+// BC3 의 알파 블록 (8 단계 보간 모드만 사용)
+static void encodeAlphaBlock(const uint8_t rgba[64], uint8_t out[8])
+{
+  int minimum = 255;
+  int maximum = 0;
+  for (int i = 0; i < 16; i++)
+  {
+    int alpha = rgba[i * 4 + 3];
+    minimum = alpha < minimum ? alpha : minimum;
+    maximum = alpha > maximum ? alpha : maximum;
+  }
+
+  std::memset(out, 0, 8);
+  out[0] = (uint8_t)maximum;
+  out[1] = (uint8_t)minimum;
+  if (maximum == minimum)
+    return; // 모든 인덱스가 0 (alpha0) 이면 됨
+
+  // alpha0 > alpha1 이면 두 값 사이를 7 등분한 8 단계 팔레트를 사용함
+  int palette[8];
+  palette[0] = maximum;
+  palette[1] = minimum;
+  for (int k = 1; k <= 6; k++)
+    palette[k + 1] = ((7 - k) * maximum + k * minimum) / 7;
+
+  uint64_t indices = 0;
+  for (int i = 0; i < 16; i++)
+  {
+    int alpha = rgba[i * 4 + 3];
+    int best = 0;
+    int bestError = 256;
+    for (int k = 0; k < 8; k++)
+    {
+      int error = alpha > palette[k] ? alpha - palette[k] : palette[k] - alpha;
+      if (error < bestError)
+      {
+        best = k;
+        bestError = error;
+      }
+    }
+    indices |= (uint64_t)best << (3 * i);
+  }
+  for (int b = 0; b < 6; b++)
+    out[2 + b] = (uint8_t)(indices >> (8 * b));
+}
+
+void encodeBC3Block(const uint8_t rgba[64], uint8_t out[16])
+{
+  encodeAlphaBlock(rgba, out);
+  encodeBC1Block(rgba, out + 8);
+}
+
+/** BC7 (mode 6) */
+
+// 0 ~ 255 범위의 RGBA 엔드포인트를 7 비트 + 공유 p 비트로 양자화 (복원 오차가 작은 p 비트 선택)
+static void quantizeBC7Endpoint(const float color[4], int quantized[4], int &pBit)
+{
+  int bestError = -1;
+  for (int p = 0; p < 2; p++)
+  {
+    int candidate[4];
+    int error = 0;
+    for (int c = 0; c < 4; c++)
+    {
+      candidate[c] = clampInt((int)((color[c] - p) / 2.0f + 0.5f), 0, 127);
+      int restored = (candidate[c] << 1) | p;
+      int d = restored - (int)(color[c] + 0.5f);
+      error += d * d;
+    }
+    if (bestError < 0 || error < bestError)
+    {
+      bestError = error;
+      pBit = p;
+      std::memcpy(quantized, candidate, sizeof(candidate));
+    }
+  }
+}
+
+// 두 엔드포인트로 BC7 mode 6 블록을 만들고 제곱 오차 합 반환
+static int encodeBC7Endpoints(const uint8_t rgba[64], const float lo[4], const float hi[4], uint8_t out[16])
+{
+  int q0[4], q1[4], p0 = 0, p1 = 0;
+  quantizeBC7Endpoint(lo, q0, p0);
+  quantizeBC7Endpoint(hi, q1, p1);
+
+  int endpoint0[4], endpoint1[4];
+  for (int c = 0; c < 4; c++)
+  {
+    endpoint0[c] = (q0[c] << 1) | p0;
+    endpoint1[c] = (q1[c] << 1) | p1;
+  }
+
+  int palette[16][4];
+  for (int k = 0; k < 16; k++)
+    for (int c = 0; c < 4; c++)
+      palette[k][c] = ((64 - BC7_WEIGHTS4[k]) * endpoint0[c] + BC7_WEIGHTS4[k] * endpoint1[c] + 32) >> 6;
+
+  int indices[16];
+  int totalError = 0;
+  for (int i = 0; i < 16; i++)
+  {
+    int best = 0;
+    int bestError = squaredError(&rgba[i * 4], palette[0], 4);
+    for (int k = 1; k < 16; k++)
+    {
+      int error = squaredError(&rgba[i * 4], palette[k], 4);
+      if (error < bestError)
+      {
+        best = k;
+        bestError = error;
+      }
+    }
+    indices[i] = best;
+    totalError += bestError;
+  }
+
+  // 첫 번째 픽셀(anchor)의 인덱스는 최상위 비트를 0 으로 생략하므로, 8 이상이면 엔드포인트를 뒤집음
+  if (indices[0] >= 8)
+  {
+    for (int c = 0; c < 4; c++)
+    {
+      int temp = q0[c];
+      q0[c] = q1[c];
+      q1[c] = temp;
+    }
+    int temp = p0;
+    p0 = p1;
+    p1 = temp;
+    for (int i = 0; i < 16; i++)
+      indices[i] = 15 - indices[i];
+  }
+
+  // mode 6 : 모드 비트(0000001) + RGBA 엔드포인트 7 비트씩 + p 비트 2 개 + 인덱스 4 비트씩 (anchor 는 3 비트)
+  std::memset(out, 0, 16);
+  BitWriter writer(out);
+  writer.write(1u << 6, 7);
+  for (int c = 0; c < 4; c++)
+  {
+    writer.write((uint32_t)q0[c], 7);
+    writer.write((uint32_t)q1[c], 7);
+  }
+  writer.write((uint32_t)p0, 1);
+  writer.write((uint32_t)p1, 1);
+  writer.write((uint32_t)indices[0], 3);
+  for (int i = 1; i < 16; i++)
+    writer.write((uint32_t)indices[i], 4);
+  return totalError;
+}
+
+void encodeBC7Block(const uint8_t rgba[64], uint8_t out[16])
+{
+  float lo[2][4], hi[2][4];
+  findEndpoints(rgba, 4, lo, hi);
+
+  uint8_t candidate[16];
+  int bestError = encodeBC7Endpoints(rgba, lo[0], hi[0], out);
+  int error = encodeBC7Endpoints(rgba, lo[1], hi[1], candidate);
+  if (error < bestError)
+    std::memcpy(out, candidate, 16);
+}
+
+/** 이미지 전체 압축 */
+
+// 블록 행 [firstRow, lastRow) 압축
+static void compressRows(BlockFormat format, const uint8_t *rgba, int width, int height, uint8_t *out, int firstRow, int lastRow)
+{
+  int blocksX = (width + 3) / 4;
+  size_t bytes = blockBytes(format);
+  uint8_t block[64];
+  for (int by = firstRow; by < lastRow; by++)
+  {
+    for (int bx = 0; bx < blocksX; bx++)
+    {
+      // 이미지 가장자리를 벗어난 픽셀은 가장자리 픽셀을 복제해서 채움
+      for (int y = 0; y < 4; y++)
+      {
+        int sy = by * 4 + y < height ? by * 4 + y : height - 1;
+        for (int x = 0; x < 4; x++)
+        {
+          int sx = bx * 4 + x < width ? bx * 4 + x : width - 1;
+          std::memcpy(&block[(y * 4 + x) * 4], &rgba[((size_t)sy * width + sx) * 4], 4);
+        }
+      }
+
+      uint8_t *target = out + ((size_t)by * blocksX + bx) * bytes;
+      switch (format)
+      {
+      case BLOCK_FORMAT_BC1:
+        encodeBC1Block(block, target);
+        break;
+      case BLOCK_FORMAT_BC3:
+        encodeBC3Block(block, target);
+        break;
+      case BLOCK_FORMAT_BC7:
+        encodeBC7Block(block, target);
+        break;
+      }
+    }
+  }
+}
+
+// RGBA8 이미지 전체를 압축하여 out 에 덧붙임
+void compressImage(BlockFormat format, const uint8_t *rgba, int width, int height, std::string &out, unsigned int threadCount)
+{
+  // 빈 이미지는 압축할 블록이 없으므로 아무것도 덧붙이지 않음 (블록 행이 0 개라면 스레드 수도 0 이 되어 나눗셈이 불가능함)
+  if (width <= 0 || height <= 0)
+    return;
+
+  size_t offset = out.size();
+  out.resize(offset + compressedSize(format, width, height));
+  uint8_t *target = reinterpret_cast<uint8_t *>(&out[offset]);
+
+  int blocksY = (height + 3) / 4;
+  if (threadCount == 0)
+    threadCount = std::thread::hardware_concurrency();
+  if (threadCount == 0)
+    threadCount = 1;
+  if ((int)threadCount > blocksY)
+    threadCount = (unsigned int)blocksY;
+
+  // 블록 행들을 스레드 개수만큼 연속된 구간으로 나눠서 처리 (블록끼리는 서로 독립적이므로 동기화가 필요 없음)
+  std::vector<std::thread> workers;
+  int rowsPerThread = (blocksY + threadCount - 1) / threadCount;
+  for (unsigned int t = 1; t < threadCount; t++)
+  {
+    int firstRow = t * rowsPerThread;
+    int lastRow = firstRow + rowsPerThread < blocksY ? firstRow + rowsPerThread : blocksY;
+    if (firstRow < lastRow)
+      workers.push_back(std::thread(compressRows, format, rgba, width, height, target, firstRow, lastRow));
+  }
+  compressRows(format, rgba, width, height, target, 0, rowsPerThread < blocksY ? rowsPerThread : blocksY);
+  for (size_t i = 0; i < workers.size(); i++)
+    workers[i].join();
+}
@@ -0,0 +1,249 @@
+#include "texture/dds.hpp"
+#include "util/file_io.hpp"
+
+#include <cstdint> // uint32_t
+#include <cstring> // std::memcmp
+#include <fstream> // 파일 입출력을 위한 헤더
+
+// DDS 파일 구조의 크기 (바이트)
+static const size_t DDS_MAGIC_SIZE = 4;   // "DDS "
+static const size_t DDS_HEADER_SIZE = 124; // DDS_HEADER
+static const size_t DDS_DX10_SIZE = 20;   // DDS_HEADER_DXT10
+
+// DDS_HEADER 안의 필드 위치 (매직 넘버 이후 기준)
+static const size_t OFFSET_FLAGS = 4;
+static const size_t OFFSET_HEIGHT = 8;
+static const size_t OFFSET_WIDTH = 12;
+static const size_t OFFSET_PITCH = 16;
+static const size_t OFFSET_MIP_COUNT = 24;
+static const size_t OFFSET_PIXEL_FORMAT = 72; // DDS_PIXELFORMAT
+static const size_t OFFSET_CAPS = 104;
+
+// DDS_HEADER::dwFlags (CAPS | HEIGHT | WIDTH | PIXELFORMAT | MIPMAPCOUNT | LINEARSIZE)
+static const uint32_t DDSD_DEFAULT = 0x1 | 0x2 | 0x4 | 0x1000 | 0x20000 | 0x80000;
+// DDS_HEADER::dwCaps (TEXTURE | COMPLEX | MIPMAP)
+static const uint32_t DDSCAPS_DEFAULT = 0x1000 | 0x8 | 0x400000;
+// DDS_PIXELFORMAT::dwFlags
+static const uint32_t DDPF_FOURCC = 0x4;
+
+// DX10 확장 헤더의 리소스 차원
+static const uint32_t D3D10_RESOURCE_DIMENSION_TEXTURE2D = 3;
+
+// 4 개의 문자로 만든 FourCC 코드
+static uint32_t makeFourCC(char a, char b, char c, char d)
+{
+  return (uint32_t)(uint8_t)a | ((uint32_t)(uint8_t)b << 8) | ((uint32_t)(uint8_t)c << 16) | ((uint32_t)(uint8_t)d << 24);
+}
+
+// DXGI_FORMAT 값 (선형 / sRGB 순서)
+static uint32_t dxgiFormat(BlockFormat format, bool srgb)
+{
+  switch (format)
+  {
+  case BLOCK_FORMAT_BC1:
+    return srgb ? 72 : 71;
+  case BLOCK_FORMAT_BC3:
+    return srgb ? 78 : 77;
+  default:
+    return srgb ? 99 : 98;
+  }
+}
+
+// DXGI_FORMAT 값을 BlockFormat 으로 변환 (지원하지 않는 포맷이면 false 반환)
+static bool fromDxgiFormat(uint32_t value, BlockFormat &format, bool &srgb)
+{
+  switch (value)
+  {
+  case 71:
+  case 72:
+    format = BLOCK_FORMAT_BC1;
+    srgb = value == 72;
+    return true;
+  case 77:
+  case 78:
+    format = BLOCK_FORMAT_BC3;
+    srgb = value == 78;
+    return true;
+  case 98:
+  case 99:
+    format = BLOCK_FORMAT_BC7;
+    srgb = value == 99;
+    return true;
+  default:
+    return false;
+  }
+}
+
+// 리틀 엔디안 32 비트 정수 읽기 / 쓰기 (DDS 는 항상 리틀 엔디안)
+static uint32_t readUint32(const char *file, size_t offset)
+{
+  const uint8_t *p = reinterpret_cast<const uint8_t *>(file) + offset;
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static void writeUint32(std::string &file, size_t offset, uint32_t value)
+{
+  for (int b = 0; b < 4; b++)
+    file[offset + b] = (char)(uint8_t)(value >> (8 * b));
+}
+
+// 헤더를 해석하여 out 의 크기, 포맷, 레벨 목록을 채우고 블록 데이터의 시작 위치를 dataOffset 에 저장
+// (size 는 file 에 읽어둔 바이트 수, fileSize 는 파일 전체 크기. 헤더만 읽어둔 경우 size 가 더 작음)
+static bool parseHeader(const char *file, size_t size, size_t fileSize, DdsImage &out, size_t &dataOffset)
+{
+  if (size < DDS_MAGIC_SIZE + DDS_HEADER_SIZE || std::memcmp(file, "DDS ", DDS_MAGIC_SIZE) != 0)
+    return false;
+
+  const size_t header = DDS_MAGIC_SIZE;
+  if (readUint32(file, header) != DDS_HEADER_SIZE)
+    return false;
+
+  out.height = (int)readUint32(file, header + OFFSET_HEIGHT);
+  out.width = (int)readUint32(file, header + OFFSET_WIDTH);
+  int levelCount = (int)readUint32(file, header + OFFSET_MIP_COUNT);
+  if (levelCount == 0)
+    levelCount = 1; // DDSD_MIPMAPCOUNT 가 없는 파일은 0 으로 저장되어 있음
+  if (out.width <= 0 || out.height <= 0 || levelCount > 32)
+    return false;
+
+  // 픽셀 포맷 (FourCC 가 'DX10' 이라면 확장 헤더의 DXGI_FORMAT 으로 판단)
+  dataOffset = header + DDS_HEADER_SIZE;
+  uint32_t pixelFlags = readUint32(file, header + OFFSET_PIXEL_FORMAT + 4);
+  uint32_t fourCC = readUint32(file, header + OFFSET_PIXEL_FORMAT + 8);
+  if (!(pixelFlags & DDPF_FOURCC))
+    return false; // 압축되지 않은 DDS 는 지원하지 않음
+
+  out.srgb = false;
+  if (fourCC == makeFourCC('D', 'X', 'T', '1'))
+    out.format = BLOCK_FORMAT_BC1;
+  else if (fourCC == makeFourCC('D', 'X', 'T', '5'))
+    out.format = BLOCK_FORMAT_BC3;
+  else if (fourCC == makeFourCC('D', 'X', '1', '0'))
+  {
+    if (size < dataOffset + DDS_DX10_SIZE)
+      return false;
+    if (!fromDxgiFormat(readUint32(file, dataOffset), out.format, out.srgb))
+      return false;
+    dataOffset += DDS_DX10_SIZE;
+  }
+  else
+    return false;
+
+  // 레벨마다 크기를 계산하면서 파일이 잘리지 않았는지 확인
+  out.levels.clear();
+  size_t offset = 0;
+  int levelWidth = out.width;
+  int levelHeight = out.height;
+  for (int level = 0; level < levelCount; level++)
+  {
+    DdsLevel entry;
+    entry.width = levelWidth;
+    entry.height = levelHeight;
+    entry.offset = offset;
+    entry.size = compressedSize(out.format, levelWidth, levelHeight);
+    out.levels.push_back(entry);
+
+    offset += entry.size;
+    levelWidth = levelWidth > 1 ? levelWidth / 2 : 1;
+    levelHeight = levelHeight > 1 ? levelHeight / 2 : 1;
+  }
+  return fileSize >= dataOffset + offset;
+}
+
+// 메모리에 읽어둔 DDS 파일 해석
+bool parseDds(const std::string &file, DdsImage &out)
+{
+  size_t dataOffset;
+  if (!parseHeader(file.data(), file.size(), file.size(), out, dataOffset))
+    return false;
+
+  out.data.assign(file, dataOffset, out.byteCount());
+  out.view = nullptr;
+  return true;
+}
+
+// 메모리에 있는 DDS 파일을 복사 없이 해석
+bool parseDdsView(const char *file, size_t size, DdsImage &out)
+{
+  size_t dataOffset;
+  if (!parseHeader(file, size, size, out, dataOffset))
+    return false;
+
+  out.data.clear();
+  out.view = file + dataOffset;
+  return true;
+}
+
+// DDS 파일의 헤더만 읽기
+bool readDdsHeader(const std::string &path, DdsImage &out, size_t &dataOffset)
+{
+  std::ifstream file(path.c_str(), std::ios::binary | std::ios::ate);
+  if (!file)
+    return false;
+
+  // 헤더는 DX10 확장 헤더까지 합쳐도 148 바이트이므로, 그만큼만 읽고 레벨 크기는 파일 전체 크기로 검증
+  size_t fileSize = (size_t)file.tellg();
+  char header[DDS_MAGIC_SIZE + DDS_HEADER_SIZE + DDS_DX10_SIZE];
+  size_t headerSize = fileSize < sizeof(header) ? fileSize : sizeof(header);
+  file.seekg(0);
+  if (!file.read(header, (std::streamsize)headerSize))
+    return false;
+
+  if (!parseHeader(header, headerSize, fileSize, out, dataOffset))
+    return false;
+
+  out.data.clear();
+  out.view = nullptr;
+  return true;
+}
+
+// DDS 파일 읽기
+bool readDds(const std::string &path, DdsImage &out)
+{
+  std::string file;
+  return readWholeFile(path, file) && parseDds(file, out);
+}
+
+// DDS 파일 저장
+bool writeDds(const std::string &path, const DdsImage &image)
+{
+  if (image.levels.empty())
+    return false;
+
+  // 선형 BC1, BC3 는 옛 헤더만으로 표현할 수 있음
+  bool legacy = !image.srgb && image.format != BLOCK_FORMAT_BC7;
+
+  std::string header(DDS_MAGIC_SIZE + DDS_HEADER_SIZE + (legacy ? 0 : DDS_DX10_SIZE), '\0');
+  header.replace(0, DDS_MAGIC_SIZE, "DDS ");
+
+  const size_t base = DDS_MAGIC_SIZE;
+  writeUint32(header, base, (uint32_t)DDS_HEADER_SIZE);
+  writeUint32(header, base + OFFSET_FLAGS, DDSD_DEFAULT);
+  writeUint32(header, base + OFFSET_HEIGHT, (uint32_t)image.height);
+  writeUint32(header, base + OFFSET_WIDTH, (uint32_t)image.width);
+  writeUint32(header, base + OFFSET_PITCH, (uint32_t)image.levels[0].size);
+  writeUint32(header, base + OFFSET_MIP_COUNT, (uint32_t)image.levels.size());
+  writeUint32(header, base + OFFSET_PIXEL_FORMAT, 32); // DDS_PIXELFORMAT::dwSize
+  writeUint32(header, base + OFFSET_PIXEL_FORMAT + 4, DDPF_FOURCC);
+  writeUint32(header, base + OFFSET_CAPS, DDSCAPS_DEFAULT);
+
+  if (legacy)
+  {
+    uint32_t fourCC = image.format == BLOCK_FORMAT_BC1 ? makeFourCC('D', 'X', 'T', '1') : makeFourCC('D', 'X', 'T', '5');
+    writeUint32(header, base + OFFSET_PIXEL_FORMAT + 8, fourCC);
+  }
+  else
+  {
+    writeUint32(header, base + OFFSET_PIXEL_FORMAT + 8, makeFourCC('D', 'X', '1', '0'));
+
+    const size_t dx10 = DDS_MAGIC_SIZE + DDS_HEADER_SIZE;
+    writeUint32(header, dx10, dxgiFormat(image.format, image.srgb));
+    writeUint32(header, dx10 + 4, D3D10_RESOURCE_DIMENSION_TEXTURE2D);
+    writeUint32(header, dx10 + 12, 1); // arraySize
+  }
+
+  std::ofstream file(path.c_str(), std::ios::binary);
+  file.write(header.data(), (std::streamsize)header.size());
+  file.write(image.bytes(), (std::streamsize)image.byteCount());
+  return file.good();
+}
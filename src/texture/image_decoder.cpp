@@ -0,0 +1,153 @@
+#include "texture/image_decoder.hpp"
+#include "texture/pixel_convert.hpp"
+#include "texture/png_decoder.hpp"
+#ifdef USE_TURBOJPEG
+#include "texture/jpeg_decoder.hpp"
+#endif
+
+#include <stb_image.h> // 대체 백엔드 (구현부는 main.cpp 에서 STB_IMAGE_IMPLEMENTATION 으로 포함됨)
+#include <cstdlib>     // std::malloc, std::free
+#include <climits>     // INT_MAX
+
+// DecodedImage::pixels 메모리 반납
+void freeImagePixels(void *pixels)
+{
+  std::free(pixels);
+}
+
+/*
+  stb_image 백엔드
+
+  PNG, JPEG, BMP, TGA, PSD, GIF, HDR, PIC, PNM 등을 모두 디코딩할 수 있지만 스칼라 코드로 한 픽셀씩 처리함.
+  다른 백엔드가 맡지 않은 포맷이나, 지원하지 않는 변형을 대신 디코딩함.
+*/
+class StbImageDecoder : public ImageDecoder
+{
+public:
+  const char *name() const
+  {
+    return "stb_image";
+  }
+
+  bool accepts(const uint8_t *, size_t) const
+  {
+    return true;
+  }
+
+  bool info(const uint8_t *data, size_t size, int &width, int &height, int &channels, int &bitsPerChannel) const
+  {
+    if (size > (size_t)INT_MAX || !stbi_info_from_memory(data, (int)size, &width, &height, &channels))
+      return false;
+    bitsPerChannel = stbi_is_16_bit_from_memory(data, (int)size) ? 16 : 8;
+    return true;
+  }
+
+  bool decode(const uint8_t *data, size_t size, int desiredChannels, DecodedImage &out) const
+  {
+    if (size > (size_t)INT_MAX)
+      return false;
+
+    int channels;
+    if (desiredChannels == 4 && stbi_info_from_memory(data, (int)size, &out.width, &out.height, &channels) && channels == 3 &&
+        !stbi_is_16_bit_from_memory(data, (int)size))
+    {
+      // 8 비트 RGB -> RGBA 확장은 stb_image 의 스칼라 변환 대신 SIMD 커널로 처리 (stb_image 도 변환할 때 새 버퍼를 할당함)
+      void *rgb = stbi_load_from_memory(data, (int)size, &out.width, &out.height, &channels, 3);
+      if (!rgb)
+        return false;
+      out.pixels = std::malloc((size_t)out.width * out.height * 4);
+      if (out.pixels)
+        expandRgbToRgba(static_cast<const uint8_t *>(rgb), static_cast<uint8_t *>(out.pixels), (size_t)out.width * out.height);
+      stbi_image_free(rgb);
+      out.bitsPerChannel = 8;
+    }
+    else if (stbi_is_16_bit_from_memory(data, (int)size))
+    {
+      out.pixels = stbi_load_16_from_memory(data, (int)size, &out.width, &out.height, &channels, desiredChannels);
+      out.bitsPerChannel = 16;
+    }
+    else
+    {
+      out.pixels = stbi_load_from_memory(data, (int)size, &out.width, &out.height, &channels, desiredChannels);
+      out.bitsPerChannel = 8;
+    }
+    out.channels = desiredChannels != 0 ? desiredChannels : channels;
+    return out.pixels != nullptr;
+  }
+};
+
+/** ImageDecoders 구현부 */
+
+// 앱 전체에서 공유하는 ImageDecoders 객체
+ImageDecoders &ImageDecoders::shared()
+{
+  static ImageDecoders decoders;
+  return decoders;
+}
+
+// ImageDecoders 클래스 생성자 (기본 백엔드 등록)
+ImageDecoders::ImageDecoders()
+    : stbDecoder(new StbImageDecoder())
+{
+  add(std::unique_ptr<ImageDecoder>(new PngDecoder()));
+#ifdef USE_TURBOJPEG
+  add(std::unique_ptr<ImageDecoder>(new JpegDecoder()));
+#endif
+}
+
+ImageDecoders::~ImageDecoders()
+{
+}
+
+// 백엔드 추가
+void ImageDecoders::add(std::unique_ptr<ImageDecoder> decoder)
+{
+  decoders.push_back(std::move(decoder));
+}
+
+// 파일 시그니처에 맞는 백엔드
+const ImageDecoder &ImageDecoders::find(const uint8_t *data, size_t size) const
+{
+  for (size_t i = 0; i < decoders.size(); i++)
+  {
+    if (decoders[i]->accepts(data, size))
+      return *decoders[i];
+  }
+  return *stbDecoder;
+}
+
+// 헤더만 해석
+bool ImageDecoders::info(const uint8_t *data, size_t size, int &width, int &height, int &channels, int &bitsPerChannel) const
+{
+  const ImageDecoder &decoder = find(data, size);
+  if (decoder.info(data, size, width, height, channels, bitsPerChannel))
+    return true;
+  return &decoder != stbDecoder.get() && stbDecoder->info(data, size, width, height, channels, bitsPerChannel);
+}
+
+// 디코딩
+bool ImageDecoders::decode(const uint8_t *data, size_t size, int desiredChannels, DecodedImage &out) const
+{
+  const ImageDecoder &decoder = find(data, size);
+  if (decoder.decode(data, size, desiredChannels, out))
+    return true;
+  return &decoder != stbDecoder.get() && stbDecoder->decode(data, size, desiredChannels, out);
+}
+
+// 등록된 백엔드 개수
+size_t ImageDecoders::count() const
+{
+  return decoders.size();
+}
+
+// 등록된 백엔드
+const ImageDecoder &ImageDecoders::get(size_t index) const
+{
+  return *decoders[index];
+}
+
+// stb_image 백엔드
+const ImageDecoder &ImageDecoders::fallback() const
+{
+  return *stbDecoder;
+}
@@ -0,0 +1,101 @@
+#include "texture/jpeg_decoder.hpp"
+
+#include <turbojpeg.h> // libjpeg-turbo 의 TurboJPEG API
+#include <cstdlib>     // std::malloc, std::free
+
+/**
+ * TurboJPEG 핸들은 스레드 간에 공유할 수 없으므로, 워커 스레드마다 하나씩 만들어두고 재사용함.
+ * (핸들 생성 비용이 작은 이미지의 디코딩 시간보다 클 수 있음)
+ */
+static tjhandle threadHandle()
+{
+  static thread_local struct Handle
+  {
+    tjhandle value;
+    Handle() : value(tjInitDecompress()) {}
+    ~Handle()
+    {
+      if (value)
+        tjDestroy(value);
+    }
+  } handle;
+  return handle.value;
+}
+
+// 헤더 해석 (채널 수는 흑백이라면 1, 그 외에는 3. CMYK 는 지원하지 않음)
+static bool readHeader(tjhandle handle, const uint8_t *data, size_t size, int &width, int &height, int &channels)
+{
+  int subsampling, colorspace;
+  if (!handle || tjDecompressHeader3(handle, data, (unsigned long)size, &width, &height, &subsampling, &colorspace) != 0)
+    return false;
+  if (colorspace == TJCS_CMYK || colorspace == TJCS_YCCK)
+    return false;
+
+  channels = colorspace == TJCS_GRAY ? 1 : 3;
+  return true;
+}
+
+/** JpegDecoder 구현부 */
+
+const char *JpegDecoder::name() const
+{
+  return "jpeg (libjpeg-turbo)";
+}
+
+// 파일 시그니처 확인 (SOI 마커 다음에 다른 마커가 이어짐)
+bool JpegDecoder::accepts(const uint8_t *data, size_t size) const
+{
+  return size >= 3 && data[0] == 0xFF && data[1] == 0xD8 && data[2] == 0xFF;
+}
+
+// 헤더만 해석
+bool JpegDecoder::info(const uint8_t *data, size_t size, int &width, int &height, int &channels, int &bitsPerChannel) const
+{
+  if (!readHeader(threadHandle(), data, size, width, height, channels))
+    return false;
+  bitsPerChannel = 8;
+  return true;
+}
+
+// 디코딩
+bool JpegDecoder::decode(const uint8_t *data, size_t size, int desiredChannels, DecodedImage &out) const
+{
+  tjhandle handle = threadHandle();
+  int width, height, channels;
+  if (!readHeader(handle, data, size, width, height, channels))
+    return false;
+
+  // 요청한 채널 수에 맞는 픽셀 포맷으로 곧바로 디코딩 (4 채널은 알파를 255 로 채움)
+  int outChannels = desiredChannels != 0 ? desiredChannels : channels;
+  int pixelFormat;
+  switch (outChannels)
+  {
+  case 1:
+    pixelFormat = TJPF_GRAY;
+    break;
+  case 3:
+    pixelFormat = TJPF_RGB;
+    break;
+  case 4:
+    pixelFormat = TJPF_RGBA;
+    break;
+  default:
+    return false;
+  }
+
+  uint8_t *pixels = static_cast<uint8_t *>(std::malloc((size_t)width * height * outChannels));
+  if (!pixels)
+    return false;
+  if (tjDecompress2(handle, data, (unsigned long)size, pixels, width, 0, height, pixelFormat, 0) != 0)
+  {
+    std::free(pixels);
+    return false;
+  }
+
+  out.width = width;
+  out.height = height;
+  out.channels = outChannels;
+  out.bitsPerChannel = 8;
+  out.pixels = pixels;
+  return true;
+}
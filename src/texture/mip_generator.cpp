@@ -0,0 +1,403 @@
+#include "texture/mip_generator.hpp"
+
+#include <algorithm> // std::fill
+#include <cmath>     // std::pow, std::sin, std::sqrt, std::floor, std::ceil
+#include <cstring>   // std::strcmp
+#include <thread>    // std::thread
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MIP_USE_SSE 1
+#include <immintrin.h> // SSE, AVX2, FMA 내장 함수
+#if defined(__GNUC__) || defined(__clang__)
+#define MIP_USE_AVX2 1
+#define MIP_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#elif defined(_MSC_VER)
+#define MIP_USE_AVX2 1
+#define MIP_TARGET_AVX2
+#include <intrin.h> // __cpuid, __cpuidex
+#endif
+#endif
+
+static const float PI = 3.14159265358979f;
+
+// Kaiser, Lanczos 필터가 참조하는 범위 (축소된 레벨의 픽셀 단위 반지름)
+static const float WINDOW_RADIUS = 3.0f;
+// Kaiser 창의 모양 (클수록 링잉이 줄어들고 흐려짐)
+static const float KAISER_ALPHA = 4.0f;
+
+// 한 스레드가 맡을 최소 픽셀 수 (작은 레벨은 스레드를 만드는 비용이 더 큼)
+static const size_t PIXELS_PER_THREAD = 16384;
+
+/** 색 공간 변환 */
+
+// 선형 값을 sRGB 로 인코딩할 때 사용하는 변환표의 크기 (0 ~ 1 을 4096 단계로 양자화)
+static const int LINEAR_TABLE_SIZE = 4096;
+
+// sRGB <-> 선형 변환표 (여러 워커 스레드에서 동시에 처음 호출되어도 한 번만 초기화됨)
+struct SrgbTables
+{
+  float toLinear[256];
+  uint8_t toSrgb[LINEAR_TABLE_SIZE];
+
+  SrgbTables()
+  {
+    for (int i = 0; i < 256; i++)
+    {
+      float value = i / 255.0f;
+      toLinear[i] = value <= 0.04045f ? value / 12.92f : std::pow((value + 0.055f) / 1.055f, 2.4f);
+    }
+    for (int i = 0; i < LINEAR_TABLE_SIZE; i++)
+    {
+      float value = i / (float)(LINEAR_TABLE_SIZE - 1);
+      float encoded = value <= 0.0031308f ? value * 12.92f : 1.055f * std::pow(value, 1.0f / 2.4f) - 0.055f;
+      toSrgb[i] = (uint8_t)(encoded * 255.0f + 0.5f);
+    }
+  }
+};
+
+static const SrgbTables &srgbTables()
+{
+  static const SrgbTables tables;
+  return tables;
+}
+
+static float clamp01(float value)
+{
+  return value < 0.0f ? 0.0f : (value > 1.0f ? 1.0f : value);
+}
+
+/** 필터 커널 */
+
+static float sinc(float x)
+{
+  if (std::fabs(x) < 1e-5f)
+    return 1.0f;
+  return std::sin(PI * x) / (PI * x);
+}
+
+// 0 차 변형 베셀 함수 (Kaiser 창 계산에 사용. 급수 전개)
+static float besselI0(float x)
+{
+  float sum = 1.0f;
+  float term = 1.0f;
+  float half = x * 0.5f;
+  for (int k = 1; k < 32; k++)
+  {
+    term *= (half / k) * (half / k);
+    sum += term;
+    if (term < sum * 1e-7f)
+      break;
+  }
+  return sum;
+}
+
+// 축소된 레벨의 픽셀 단위 거리 x 에서의 필터 가중치
+static float windowWeight(MipFilter filter, float x)
+{
+  float ax = std::fabs(x);
+  if (ax >= WINDOW_RADIUS)
+    return 0.0f;
+  if (filter == MIP_FILTER_LANCZOS)
+    return sinc(x) * sinc(x / WINDOW_RADIUS);
+
+  float ratio = ax / WINDOW_RADIUS;
+  return sinc(x) * besselI0(KAISER_ALPHA * std::sqrt(1.0f - ratio * ratio)) / besselI0(KAISER_ALPHA);
+}
+
+// 출력 픽셀마다 참조할 원본 픽셀 인덱스와 가중치 목록
+struct FilterTaps
+{
+  std::vector<int> first;    // 출력 픽셀 x 의 탭 시작 위치 (index, weight 배열 기준)
+  std::vector<int> count;    // 출력 픽셀 x 의 탭 개수
+  std::vector<int> index;    // 원본 픽셀 인덱스 (가장자리는 clamp 됨)
+  std::vector<float> weight; // 합이 1 이 되도록 정규화된 가중치
+};
+
+// srcSize 개의 픽셀을 dstSize 개로 줄이는 1 차원 필터 탭 계산
+static void buildTaps(MipFilter filter, int srcSize, int dstSize, FilterTaps &taps)
+{
+  float scale = (float)srcSize / (float)dstSize;
+  for (int x = 0; x < dstSize; x++)
+  {
+    taps.first.push_back((int)taps.index.size());
+    float total = 0.0f;
+
+    if (filter == MIP_FILTER_BOX)
+    {
+      // 출력 픽셀이 덮는 원본 구간 [low, high) 와 각 원본 픽셀이 겹치는 길이를 가중치로 사용
+      float low = x * scale;
+      float high = (x + 1) * scale;
+      for (int i = (int)std::floor(low); i < (int)std::ceil(high); i++)
+      {
+        float overlap = (high < i + 1 ? high : i + 1) - (low > i ? low : i);
+        if (overlap <= 0.0f)
+          continue;
+        taps.index.push_back(i < srcSize ? i : srcSize - 1);
+        taps.weight.push_back(overlap);
+        total += overlap;
+      }
+    }
+    else
+    {
+      // 출력 픽셀의 중심을 원본 픽셀 좌표로 옮긴 뒤, 반지름 안의 원본 픽셀들에 커널을 적용
+      float center = (x + 0.5f) * scale - 0.5f;
+      float support = WINDOW_RADIUS * scale;
+      for (int i = (int)std::ceil(center - support); i <= (int)std::floor(center + support); i++)
+      {
+        float w = windowWeight(filter, (i - center) / scale);
+        if (w == 0.0f)
+          continue;
+        taps.index.push_back(i < 0 ? 0 : (i >= srcSize ? srcSize - 1 : i));
+        taps.weight.push_back(w);
+        total += w;
+      }
+    }
+
+    int first = taps.first.back();
+    for (size_t t = (size_t)first; t < taps.weight.size(); t++)
+      taps.weight[t] /= total;
+    taps.count.push_back((int)taps.index.size() - first);
+  }
+}
+
+/** 행 단위 누적 (dst[i] += src[i] * weight) */
+
+static void accumulateRowScalar(float *dst, const float *src, float weight, size_t count)
+{
+  for (size_t i = 0; i < count; i++)
+    dst[i] += src[i] * weight;
+}
+
+#ifdef MIP_USE_SSE
+static void accumulateRowSSE(float *dst, const float *src, float weight, size_t count)
+{
+  __m128 w = _mm_set1_ps(weight);
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8)
+  {
+    __m128 a = _mm_add_ps(_mm_loadu_ps(dst + i), _mm_mul_ps(_mm_loadu_ps(src + i), w));
+    __m128 b = _mm_add_ps(_mm_loadu_ps(dst + i + 4), _mm_mul_ps(_mm_loadu_ps(src + i + 4), w));
+    _mm_storeu_ps(dst + i, a);
+    _mm_storeu_ps(dst + i + 4, b);
+  }
+  accumulateRowScalar(dst + i, src + i, weight, count - i);
+}
+#endif
+
+#ifdef MIP_USE_AVX2
+MIP_TARGET_AVX2 static void accumulateRowAVX2(float *dst, const float *src, float weight, size_t count)
+{
+  __m256 w = _mm256_set1_ps(weight);
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8)
+  {
+    _mm256_storeu_ps(dst + i, _mm256_fmadd_ps(_mm256_loadu_ps(src + i), w, _mm256_loadu_ps(dst + i)));
+  }
+  accumulateRowScalar(dst + i, src + i, weight, count - i);
+}
+
+// 실행 중인 CPU 가 AVX2 와 FMA 를 지원하는지 여부 (운영체제가 YMM 레지스터를 저장해주는지도 확인)
+static bool cpuSupportsAVX2()
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+  int info[4];
+  __cpuid(info, 1);
+  bool fma = (info[2] & (1 << 12)) != 0;
+  bool osxsave = (info[2] & (1 << 27)) != 0;
+  if (!fma || !osxsave || (_xgetbv(0) & 0x6) != 0x6)
+    return false;
+  __cpuidex(info, 7, 0);
+  return (info[1] & (1 << 5)) != 0;
+#else
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#endif
+}
+#endif
+
+typedef void (*AccumulateRowFunction)(float *, const float *, float, size_t);
+
+// 실행 중인 CPU 에서 사용할 수 있는 가장 넓은 누적 함수 선택
+static AccumulateRowFunction chooseAccumulateRow()
+{
+#ifdef MIP_USE_AVX2
+  if (cpuSupportsAVX2())
+    return accumulateRowAVX2;
+#endif
+#ifdef MIP_USE_SSE
+  return accumulateRowSSE;
+#else
+  return accumulateRowScalar;
+#endif
+}
+
+/** 밉맵 생성 */
+
+// [0, count) 범위를 threadCount 개의 연속된 구간으로 나눠서 병렬로 처리
+template <typename Function>
+static void parallelFor(int count, unsigned int threadCount, Function function)
+{
+  if ((int)threadCount > count)
+    threadCount = count > 0 ? (unsigned int)count : 1;
+
+  std::vector<std::thread> workers;
+  int perThread = (count + (int)threadCount - 1) / (int)threadCount;
+  for (unsigned int t = 1; t < threadCount; t++)
+  {
+    int begin = (int)t * perThread;
+    int end = begin + perThread < count ? begin + perThread : count;
+    if (begin < end)
+      workers.push_back(std::thread(function, begin, end));
+  }
+  function(0, perThread < count ? perThread : count);
+  for (size_t i = 0; i < workers.size(); i++)
+    workers[i].join();
+}
+
+// 픽셀 수에 비해 너무 많은 스레드를 쓰지 않도록 제한
+static unsigned int threadsFor(size_t pixels, unsigned int threadCount)
+{
+  size_t useful = pixels / PIXELS_PER_THREAD;
+  if (useful < 1)
+    useful = 1;
+  return useful < threadCount ? (unsigned int)useful : threadCount;
+}
+
+// 필터 이름을 MipFilter 로 변환
+bool parseMipFilter(const char *name, MipFilter &out)
+{
+  if (std::strcmp(name, "box") == 0)
+    out = MIP_FILTER_BOX;
+  else if (std::strcmp(name, "kaiser") == 0)
+    out = MIP_FILTER_KAISER;
+  else if (std::strcmp(name, "lanczos") == 0)
+    out = MIP_FILTER_LANCZOS;
+  else
+    return false;
+  return true;
+}
+
+// 8 비트 이미지의 밉맵 체인 생성
+void generateMipmaps(const uint8_t *pixels, int width, int height, int channels, bool srgb, MipFilter filter,
+                     std::vector<MipLevel> &out, unsigned int threadCount)
+{
+  out.clear();
+  if (width <= 0 || height <= 0 || channels < 1 || channels > 4 || (width == 1 && height == 1))
+    return;
+
+  if (threadCount == 0)
+    threadCount = std::thread::hardware_concurrency();
+  if (threadCount == 0)
+    threadCount = 1;
+
+  // 변환표와 누적 함수는 스레드를 만들기 전에 준비해둠
+  const float *toLinear = srgbTables().toLinear;
+  const uint8_t *toSrgb = srgbTables().toSrgb;
+  static const AccumulateRowFunction accumulateRow = chooseAccumulateRow();
+
+  // sRGB 는 색상(RGB) 채널에만 적용되고, 알파나 1, 2 채널 데이터는 항상 선형임
+  int gammaChannels = srgb && channels >= 3 ? 3 : 0;
+
+  /**
+   * 모든 채널 수를 픽셀당 float 4 개(선형 값)로 펼쳐서 처리함.
+   *
+   * 채널 수와 상관없이 같은 코드로 SIMD 레지스터를 가득 채울 수 있고,
+   * 8 비트로 반올림되는 오차가 레벨마다 누적되지 않음.
+   * 원본(레벨 0)은 크기가 가장 크므로 통째로 변환해두지 않고, 가로 방향 축소 직전에 한 행씩 변환함.
+   */
+  std::vector<float> current;
+  int levelWidth = width;
+  int levelHeight = height;
+  std::vector<float> horizontal;
+  std::vector<float> next;
+  while (levelWidth > 1 || levelHeight > 1)
+  {
+    int nextWidth = levelWidth > 1 ? levelWidth / 2 : 1;
+    int nextHeight = levelHeight > 1 ? levelHeight / 2 : 1;
+    bool fromSource = out.empty();
+
+    FilterTaps columns, rows;
+    buildTaps(filter, levelWidth, nextWidth, columns);
+    buildTaps(filter, levelHeight, nextHeight, rows);
+
+    // 가로 방향 축소 (levelWidth x levelHeight -> nextWidth x levelHeight). 픽셀 하나(float 4 개)씩 누적
+    horizontal.resize((size_t)nextWidth * levelHeight * 4);
+    parallelFor(levelHeight, threadsFor((size_t)levelWidth * levelHeight, threadCount), [&](int begin, int end) {
+      std::vector<float> converted(fromSource ? (size_t)levelWidth * 4 : 0, 0.0f);
+      for (int y = begin; y < end; y++)
+      {
+        const float *sourceRow;
+        if (fromSource)
+        {
+          const uint8_t *source = pixels + (size_t)y * width * channels;
+          for (int x = 0; x < width; x++)
+            for (int c = 0; c < channels; c++)
+              converted[x * 4 + c] = c < gammaChannels ? toLinear[source[x * channels + c]] : source[x * channels + c] / 255.0f;
+          sourceRow = &converted[0];
+        }
+        else
+        {
+          sourceRow = &current[(size_t)y * levelWidth * 4];
+        }
+
+        float *targetRow = &horizontal[(size_t)y * nextWidth * 4];
+        for (int x = 0; x < nextWidth; x++)
+        {
+          int first = columns.first[x];
+#ifdef MIP_USE_SSE
+          __m128 sum = _mm_setzero_ps();
+          for (int t = first; t < first + columns.count[x]; t++)
+            sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(sourceRow + columns.index[t] * 4), _mm_set1_ps(columns.weight[t])));
+          _mm_storeu_ps(targetRow + x * 4, sum);
+#else
+          float sum[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+          for (int t = first; t < first + columns.count[x]; t++)
+            for (int c = 0; c < 4; c++)
+              sum[c] += sourceRow[columns.index[t] * 4 + c] * columns.weight[t];
+          for (int c = 0; c < 4; c++)
+            targetRow[x * 4 + c] = sum[c];
+#endif
+        }
+      }
+    });
+
+    // 세로 방향 축소 (nextWidth x levelHeight -> nextWidth x nextHeight). 행 전체를 한 번에 누적
+    next.resize((size_t)nextWidth * nextHeight * 4);
+    size_t rowFloats = (size_t)nextWidth * 4;
+    parallelFor(nextHeight, threadsFor((size_t)nextWidth * levelHeight, threadCount), [&](int begin, int end) {
+      for (int y = begin; y < end; y++)
+      {
+        float *targetRow = &next[y * rowFloats];
+        std::fill(targetRow, targetRow + rowFloats, 0.0f);
+        for (int t = rows.first[y]; t < rows.first[y] + rows.count[y]; t++)
+          accumulateRow(targetRow, &horizontal[rows.index[t] * rowFloats], rows.weight[t], rowFloats);
+      }
+    });
+
+    // 원본과 같은 채널 수의 8 비트 픽셀로 인코딩 (Kaiser, Lanczos 의 음수 가중치로 범위를 벗어난 값은 잘라냄)
+    out.push_back(MipLevel());
+    MipLevel &level = out.back();
+    level.width = nextWidth;
+    level.height = nextHeight;
+    level.pixels.resize((size_t)nextWidth * nextHeight * channels);
+    parallelFor(nextHeight, threadsFor((size_t)nextWidth * nextHeight, threadCount), [&](int begin, int end) {
+      for (int y = begin; y < end; y++)
+      {
+        for (int x = 0; x < nextWidth; x++)
+        {
+          const float *source = &next[((size_t)y * nextWidth + x) * 4];
+          uint8_t *target = &level.pixels[((size_t)y * nextWidth + x) * channels];
+          for (int c = 0; c < channels; c++)
+          {
+            float value = clamp01(source[c]);
+            target[c] = c < gammaChannels ? toSrgb[(int)(value * (LINEAR_TABLE_SIZE - 1) + 0.5f)] : (uint8_t)(value * 255.0f + 0.5f);
+          }
+        }
+      }
+    });
+
+    current.swap(next);
+    levelWidth = nextWidth;
+    levelHeight = nextHeight;
+  }
+}
@@ -0,0 +1,310 @@
+#include "texture/pixel_cache.hpp"
+#include "util/hash.hpp"
+
+#include <algorithm> // std::sort
+#include <cstdio>    // std::remove
+#include <cstring>   // std::memcpy, std::memcmp
+#include <ctime>     // std::time
+#include <fstream>   // 파일 입출력을 위한 헤더
+#include <iostream>  // 콘솔 입출력을 위한 헤더
+#include <sstream>   // 임시 파일 이름 생성
+
+#ifdef _WIN32
+#include <process.h> // _getpid
+#else
+#include <unistd.h> // getpid
+#endif
+
+// 캐시 파일 헤더에 기록할 매직 넘버 및 파일 포맷 버전
+static const char PIXEL_CACHE_MAGIC[8] = {'P', 'X', 'C', 'A', 'C', 'H', 'E', '1'};
+static const uint32_t PIXEL_CACHE_FILE_VERSION = 1;
+
+// 밉맵 레벨을 저장할 위치의 정렬 단위 (캐시 라인 크기. SIMD 로 읽거나 픽셀 언팩 버퍼로 복사할 때 유리함)
+static const size_t PIXEL_CACHE_ALIGNMENT = 64;
+
+// 이 시간(초)보다 오래된 임시 파일은 쓰다가 종료된 프로세스가 남긴 것으로 보고 삭제함
+static const int64_t STALE_TEMP_SECONDS = 10 * 60;
+
+static const char *CACHE_EXTENSION = ".pix";
+static const char *TEMP_EXTENSION = ".tmp";
+
+// 캐시 파일 헤더 (같은 기기에서만 읽으므로 바이트 순서는 기기의 것을 그대로 사용함)
+struct PixelCacheHeader
+{
+  char magic[8];
+  uint32_t version;
+  uint32_t pathLength; // 헤더 바로 뒤에 기록된 원본 파일 경로의 길이 (해시 충돌 확인용)
+  uint64_t settings;
+  uint64_t sourceSize;
+  int64_t sourceModified;
+  int32_t width;
+  int32_t height;
+  int32_t channels;
+  int32_t bitsPerChannel;
+  uint32_t levelCount;
+  uint32_t reserved;
+  uint64_t totalSize; // 캐시 파일 전체 크기 (쓰다가 잘린 파일 확인용)
+};
+
+// 캐시 디렉토리를 훑을 때 찾은 캐시 파일 하나
+struct CacheFile
+{
+  int64_t lastUse; // 마지막으로 사용된 시각 (캐시 파일의 수정 시각)
+  uint64_t size;
+  std::string path;
+
+  bool operator<(const CacheFile &other) const
+  {
+    return lastUse < other.lastUse;
+  }
+};
+
+static size_t alignUp(size_t value)
+{
+  return (value + PIXEL_CACHE_ALIGNMENT - 1) & ~(PIXEL_CACHE_ALIGNMENT - 1);
+}
+
+static bool endsWith(const std::string &name, const char *suffix)
+{
+  size_t length = std::strlen(suffix);
+  return name.size() >= length && name.compare(name.size() - length, length, suffix) == 0;
+}
+
+/**
+ * 헤더와 원본 경로 뒤에 밉맵 레벨들이 놓이는 위치 계산.
+ *
+ * 레벨 크기는 헤더의 값으로 다시 계산할 수 있으므로 오프셋 표를 따로 저장하지 않음.
+ * 전체 파일 크기를 반환함.
+ */
+static size_t computeLayout(int width, int height, int channels, int bitsPerChannel, size_t levelCount, size_t pathLength,
+                            std::vector<size_t> &offsets, std::vector<size_t> &sizes)
+{
+  offsets.clear();
+  sizes.clear();
+  size_t offset = alignUp(sizeof(PixelCacheHeader) + pathLength);
+  for (size_t level = 0; level < levelCount; level++)
+  {
+    size_t size = (size_t)PixelCache::levelDimension(width, (int)level) * PixelCache::levelDimension(height, (int)level) * channels *
+                  (bitsPerChannel / 8);
+    offsets.push_back(offset);
+    sizes.push_back(size);
+    offset = alignUp(offset + size);
+  }
+  return offset;
+}
+
+// PixelCache 클래스 생성자
+PixelCache::PixelCache(const std::string &directory, unsigned long long maxBytes)
+    : directory(directory), maxBytes(maxBytes), hits(0), misses(0), stores(0), evictions(0), hitBytes(0), storedBytes(0), tempCounter(0)
+{
+  if (!makeDirectory(directory))
+  {
+    std::cout << "ERROR::PIXEL_CACHE::DIRECTORY_NOT_CREATED: " << directory << std::endl;
+  }
+}
+
+// 원본 파일 경로와 로더 설정으로 캐시 키 생성
+bool PixelCache::makeKey(const std::string &path, uint64_t settings, PixelCacheKey &out) const
+{
+  if (!fileStamp(path, out.source))
+    return false;
+
+  out.path = path;
+  out.settings = settings;
+
+  // 원본의 크기와 수정 시각은 파일 이름에 넣지 않으므로, 원본이 바뀌면 같은 캐시 파일을 덮어쓰게 됨 (오래된 항목이 쌓이지 않음)
+  uint64_t hash = fnv1a64(path);
+  hash = fnv1a64(&settings, sizeof(settings), hash);
+  out.file = directory + "/" + hashToHex(hash) + CACHE_EXTENSION;
+  return true;
+}
+
+// 캐시된 픽셀 데이터를 매핑
+bool PixelCache::lookup(const PixelCacheKey &key, PixelCacheEntry &out)
+{
+  std::shared_ptr<MappedFile> file = std::make_shared<MappedFile>();
+  PixelCacheHeader header;
+  if (!file->open(key.file) || file->size() < sizeof(header))
+  {
+    misses++;
+    return false;
+  }
+
+  // 원본 파일이 바뀌었거나, 해시가 충돌했거나, 쓰다가 잘린 파일이라면 미스 (다음 store() 가 덮어씀)
+  std::memcpy(&header, file->data(), sizeof(header));
+  bool valid = std::memcmp(header.magic, PIXEL_CACHE_MAGIC, sizeof(header.magic)) == 0 && header.version == PIXEL_CACHE_FILE_VERSION &&
+               header.settings == key.settings && header.sourceSize == key.source.size &&
+               header.sourceModified == key.source.modified && header.pathLength == key.path.size() &&
+               header.totalSize == file->size() && file->size() >= sizeof(header) + header.pathLength &&
+               std::memcmp(file->data() + sizeof(header), key.path.data(), key.path.size()) == 0 && header.width > 0 &&
+               header.height > 0 && header.channels >= 1 && header.channels <= 4 &&
+               (header.bitsPerChannel == 8 || header.bitsPerChannel == 16) && header.levelCount >= 1 && header.levelCount <= 32;
+
+  std::vector<size_t> offsets, sizes;
+  if (!valid || computeLayout(header.width, header.height, header.channels, header.bitsPerChannel, header.levelCount, header.pathLength,
+                              offsets, sizes) != file->size())
+  {
+    misses++;
+    return false;
+  }
+
+  out.file = file;
+  out.width = header.width;
+  out.height = header.height;
+  out.channels = header.channels;
+  out.bitsPerChannel = header.bitsPerChannel;
+  out.levels.clear();
+  for (size_t i = 0; i < offsets.size(); i++)
+  {
+    out.levels.push_back(file->data() + offsets[i]);
+  }
+
+  // 수정 시각을 LRU 정렬 기준으로 사용하므로, 적중할 때마다 갱신함
+  touchFile(key.file);
+
+  hits++;
+  hitBytes += file->size();
+  return true;
+}
+
+// 픽셀 데이터를 캐시에 저장
+bool PixelCache::store(const PixelCacheKey &key, int width, int height, int channels, int bitsPerChannel,
+                       const std::vector<const void *> &levels)
+{
+  if (levels.empty())
+    return false;
+
+  PixelCacheHeader header;
+  std::memset(&header, 0, sizeof(header));
+  std::memcpy(header.magic, PIXEL_CACHE_MAGIC, sizeof(header.magic));
+  header.version = PIXEL_CACHE_FILE_VERSION;
+  header.pathLength = (uint32_t)key.path.size();
+  header.settings = key.settings;
+  header.sourceSize = key.source.size;
+  header.sourceModified = key.source.modified;
+  header.width = width;
+  header.height = height;
+  header.channels = channels;
+  header.bitsPerChannel = bitsPerChannel;
+  header.levelCount = (uint32_t)levels.size();
+
+  std::vector<size_t> offsets, sizes;
+  header.totalSize = computeLayout(width, height, channels, bitsPerChannel, levels.size(), key.path.size(), offsets, sizes);
+
+  // 캐시 전체보다 큰 항목은 저장하자마자 삭제될 것이므로 저장하지 않음
+  if (header.totalSize > maxBytes)
+    return false;
+
+  /**
+   * 다른 프로세스나 워커 스레드가 같은 파일을 동시에 읽거나 쓸 수 있으므로,
+   * 프로세스 ID 와 번호를 붙인 임시 파일에 다 쓴 뒤 rename 으로 한 번에 교체함.
+   * (읽는 쪽은 이전 파일이나 완성된 새 파일 중 하나만 보게 되고, 이미 매핑된 이전 파일은 매핑을 해제할 때까지 유효함)
+   */
+#ifdef _WIN32
+  int pid = _getpid();
+#else
+  int pid = (int)getpid();
+#endif
+  std::ostringstream tempName;
+  tempName << key.file << "." << pid << "." << tempCounter++ << TEMP_EXTENSION;
+  std::string tempPath = tempName.str();
+
+  {
+    std::ofstream file(tempPath.c_str(), std::ios::binary | std::ios::trunc);
+    const char padding[PIXEL_CACHE_ALIGNMENT] = {0};
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    file.write(key.path.data(), key.path.size());
+    size_t written = sizeof(header) + key.path.size();
+    for (size_t i = 0; i < levels.size() && file; i++)
+    {
+      file.write(padding, offsets[i] - written);
+      file.write(static_cast<const char *>(levels[i]), sizes[i]);
+      written = offsets[i] + sizes[i];
+    }
+    file.write(padding, header.totalSize - written);
+    if (!file)
+    {
+      std::cout << "ERROR::PIXEL_CACHE::FILE_NOT_SUCCESSFULLY_WRITTEN: " << tempPath << std::endl;
+      file.close();
+      std::remove(tempPath.c_str());
+      return false;
+    }
+  }
+
+  // Windows 에서는 다른 프로세스가 매핑 중인 파일을 교체할 수 없으므로 실패할 수 있음 (캐시를 쓰지 않을 뿐임)
+  if (!replaceFile(tempPath, key.file))
+  {
+    std::remove(tempPath.c_str());
+    return false;
+  }
+
+  stores++;
+  storedBytes += header.totalSize;
+  evict();
+  return true;
+}
+
+// 적중률 및 저장, 삭제 통계 출력
+void PixelCache::report() const
+{
+  std::cout << "PIXEL_CACHE::STATS: " << hits << " hits (" << hitBytes / (1024.0 * 1024.0) << " MB mapped), " << misses << " misses, "
+            << stores << " stored (" << storedBytes / (1024.0 * 1024.0) << " MB), " << evictions << " evicted" << std::endl;
+}
+
+// width x height 에서 시작하는 밉맵 체인의 level 번째 레벨 크기
+int PixelCache::levelDimension(int size, int level)
+{
+  size >>= level;
+  return size > 1 ? size : 1;
+}
+
+// 캐시 디렉토리 크기가 maxBytes 이하가 될 때까지 오래된 파일부터 삭제
+void PixelCache::evict()
+{
+  std::lock_guard<std::mutex> lock(evictMutex);
+
+  std::vector<std::string> names;
+  if (!listFiles(directory, names))
+    return;
+
+  // 다른 프로세스가 만든 파일도 함께 셈 (인덱스 파일 없이 디렉토리를 직접 훑으므로 프로세스 사이에 공유할 상태가 없음)
+  std::vector<CacheFile> files;
+  unsigned long long totalBytes = 0;
+  int64_t now = (int64_t)std::time(nullptr);
+  for (size_t i = 0; i < names.size(); i++)
+  {
+    CacheFile file;
+    file.path = directory + "/" + names[i];
+    FileStamp stamp;
+    if (!fileStamp(file.path, stamp))
+      continue;
+
+    if (endsWith(names[i], TEMP_EXTENSION))
+    {
+      if (now - stamp.modified > STALE_TEMP_SECONDS)
+        std::remove(file.path.c_str());
+      continue;
+    }
+    if (!endsWith(names[i], CACHE_EXTENSION))
+      continue;
+
+    file.lastUse = stamp.modified;
+    file.size = stamp.size;
+    files.push_back(file);
+    totalBytes += stamp.size;
+  }
+  if (totalBytes <= maxBytes)
+    return;
+
+  // 수정 시각이 오래된(가장 오랫동안 사용되지 않은) 파일부터 삭제
+  std::sort(files.begin(), files.end());
+  for (size_t i = 0; i < files.size() && totalBytes > maxBytes; i++)
+  {
+    // 다른 프로세스가 먼저 지웠거나, Windows 에서 매핑 중인 파일이라면 실패하므로 그때는 크기를 빼지 않음
+    if (std::remove(files[i].path.c_str()) == 0)
+    {
+      totalBytes -= files[i].size;
+      evictions++;
+    }
+  }
+}
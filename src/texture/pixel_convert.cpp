@@ -0,0 +1,585 @@
+#include "texture/pixel_convert.hpp"
+
+#include <cmath> // std::pow
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define PIXEL_USE_SSE2 1
+#include <immintrin.h> // SSE2, SSSE3, AVX2 내장 함수
+#if defined(__GNUC__) || defined(__clang__)
+#define PIXEL_USE_SSSE3 1
+#define PIXEL_USE_AVX2 1
+#define PIXEL_TARGET_SSSE3 __attribute__((target("ssse3")))
+#define PIXEL_TARGET_AVX2 __attribute__((target("avx2")))
+#elif defined(_MSC_VER)
+#define PIXEL_USE_SSSE3 1
+#define PIXEL_USE_AVX2 1
+#define PIXEL_TARGET_SSSE3
+#define PIXEL_TARGET_AVX2
+#include <intrin.h> // __cpuid, __cpuidex
+#endif
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define PIXEL_USE_NEON 1
+#include <arm_neon.h> // NEON 내장 함수
+#endif
+
+/** 스칼라 커널 (SIMD 커널이 처리하고 남은 픽셀도 처리함) */
+
+static void expandRgbToRgbaScalar(const uint8_t *src, uint8_t *dst, size_t pixelCount)
+{
+  for (size_t i = 0; i < pixelCount; i++, src += 3, dst += 4)
+  {
+    dst[0] = src[0];
+    dst[1] = src[1];
+    dst[2] = src[2];
+    dst[3] = 255;
+  }
+}
+
+static void swizzleRgbaBgraScalar(const uint8_t *src, uint8_t *dst, size_t pixelCount)
+{
+  for (size_t i = 0; i < pixelCount; i++, src += 4, dst += 4)
+  {
+    uint8_t r = src[0];
+    uint8_t b = src[2];
+    dst[0] = b;
+    dst[1] = src[1];
+    dst[2] = r;
+    dst[3] = src[3];
+  }
+}
+
+// 반올림된 x * a / 255 (나눗셈 없이 계산. 0 ~ 255 의 모든 조합에서 정확함)
+static inline uint8_t multiplyAlpha(unsigned int x, unsigned int a)
+{
+  unsigned int t = x * a + 128;
+  return (uint8_t)((t + (t >> 8)) >> 8);
+}
+
+static void premultiplyAlphaScalar(uint8_t *pixels, size_t pixelCount)
+{
+  for (size_t i = 0; i < pixelCount; i++, pixels += 4)
+  {
+    unsigned int a = pixels[3];
+    pixels[0] = multiplyAlpha(pixels[0], a);
+    pixels[1] = multiplyAlpha(pixels[1], a);
+    pixels[2] = multiplyAlpha(pixels[2], a);
+  }
+}
+
+// 반올림된 v * 255 / 65535 (0 ~ 65535 의 모든 값에서 정확함)
+static void convert16To8Scalar(const uint16_t *src, uint8_t *dst, size_t valueCount)
+{
+  for (size_t i = 0; i < valueCount; i++)
+  {
+    dst[i] = (uint8_t)(((uint32_t)src[i] * 255 + 32895) >> 16);
+  }
+}
+
+/** SSE2 커널 */
+
+#ifdef PIXEL_USE_SSE2
+// 32 비트 정수 안에서 바이트 0 과 2 를 교환 (pshufb 없이 시프트와 마스크로 처리)
+static void swizzleRgbaBgraSSE2(const uint8_t *src, uint8_t *dst, size_t pixelCount)
+{
+  const __m128i keep = _mm_set1_epi32((int)0xFF00FF00);
+  const __m128i low = _mm_set1_epi32(0x000000FF);
+  size_t i = 0;
+  for (; i + 4 <= pixelCount; i += 4)
+  {
+    __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i * 4));
+    __m128i swapped = _mm_or_si128(_mm_and_si128(value, keep),
+                                   _mm_or_si128(_mm_and_si128(_mm_srli_epi32(value, 16), low), _mm_slli_epi32(_mm_and_si128(value, low), 16)));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i * 4), swapped);
+  }
+  swizzleRgbaBgraScalar(src + i * 4, dst + i * 4, pixelCount - i);
+}
+
+// 16 비트 값들에 대해 반올림된 x * a / 255
+static inline __m128i multiplyAlpha16(__m128i x, __m128i a)
+{
+  __m128i t = _mm_add_epi16(_mm_mullo_epi16(x, a), _mm_set1_epi16(128));
+  return _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+}
+
+// 16 비트로 넓힌 RGBA 픽셀 2 개의 알파를 RGB 자리에 복제하고, 알파 자리는 255 로 채움 (알파 자신은 255 를 곱해서 그대로 유지)
+static inline __m128i broadcastAlpha16(__m128i pixels)
+{
+  __m128i alpha = _mm_shufflehi_epi16(_mm_shufflelo_epi16(pixels, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+  const __m128i alphaLanes = _mm_set_epi16(-1, 0, 0, 0, -1, 0, 0, 0);
+  return _mm_or_si128(_mm_andnot_si128(alphaLanes, alpha), _mm_and_si128(alphaLanes, _mm_set1_epi16(255)));
+}
+
+static void premultiplyAlphaSSE2(uint8_t *pixels, size_t pixelCount)
+{
+  const __m128i zero = _mm_setzero_si128();
+  size_t i = 0;
+  for (; i + 4 <= pixelCount; i += 4)
+  {
+    __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i *>(pixels + i * 4));
+    __m128i lo = _mm_unpacklo_epi8(value, zero);
+    __m128i hi = _mm_unpackhi_epi8(value, zero);
+    lo = multiplyAlpha16(lo, broadcastAlpha16(lo));
+    hi = multiplyAlpha16(hi, broadcastAlpha16(hi));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(pixels + i * 4), _mm_packus_epi16(lo, hi));
+  }
+  premultiplyAlphaScalar(pixels + i * 4, pixelCount - i);
+}
+
+// 32 비트 정수 4 개에 대해 반올림된 v * 255 / 65535 (v * 255 = (v << 8) - v)
+static inline __m128i convert16To8x4(__m128i v)
+{
+  __m128i t = _mm_add_epi32(_mm_sub_epi32(_mm_slli_epi32(v, 8), v), _mm_set1_epi32(32895));
+  return _mm_srli_epi32(t, 16);
+}
+
+static void convert16To8SSE2(const uint16_t *src, uint8_t *dst, size_t valueCount)
+{
+  const __m128i zero = _mm_setzero_si128();
+  size_t i = 0;
+  for (; i + 16 <= valueCount; i += 16)
+  {
+    __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+    __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i + 8));
+    __m128i a16 = _mm_packs_epi32(convert16To8x4(_mm_unpacklo_epi16(a, zero)), convert16To8x4(_mm_unpackhi_epi16(a, zero)));
+    __m128i b16 = _mm_packs_epi32(convert16To8x4(_mm_unpacklo_epi16(b, zero)), convert16To8x4(_mm_unpackhi_epi16(b, zero)));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), _mm_packus_epi16(a16, b16));
+  }
+  convert16To8Scalar(src + i, dst + i, valueCount - i);
+}
+#endif
+
+/** SSSE3 커널 */
+
+#ifdef PIXEL_USE_SSSE3
+// 4 픽셀(12 바이트)을 pshufb 로 16 바이트에 펼친 뒤 알파를 채움
+PIXEL_TARGET_SSSE3 static void expandRgbToRgbaSSSE3(const uint8_t *src, uint8_t *dst, size_t pixelCount)
+{
+  const __m128i shuffle = _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+  const __m128i alpha = _mm_set1_epi32((int)0xFF000000);
+  size_t i = 0;
+
+  // 16 바이트를 읽어서 12 바이트만 사용하므로, 끝에서 버퍼를 넘어 읽지 않도록 2 픽셀의 여유를 둠
+  for (; i + 6 <= pixelCount; i += 4)
+  {
+    __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i * 3));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i * 4), _mm_or_si128(_mm_shuffle_epi8(value, shuffle), alpha));
+  }
+  expandRgbToRgbaScalar(src + i * 3, dst + i * 4, pixelCount - i);
+}
+
+PIXEL_TARGET_SSSE3 static void swizzleRgbaBgraSSSE3(const uint8_t *src, uint8_t *dst, size_t pixelCount)
+{
+  const __m128i shuffle = _mm_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+  size_t i = 0;
+  for (; i + 4 <= pixelCount; i += 4)
+  {
+    __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i * 4));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i * 4), _mm_shuffle_epi8(value, shuffle));
+  }
+  swizzleRgbaBgraScalar(src + i * 4, dst + i * 4, pixelCount - i);
+}
+#endif
+
+/** AVX2 커널 */
+
+#ifdef PIXEL_USE_AVX2
+// 8 픽셀(24 바이트)을 128 비트 레인 두 개에 12 바이트씩 나눠 읽은 뒤 레인마다 pshufb (vpshufb 는 레인을 넘나들지 못함)
+PIXEL_TARGET_AVX2 static void expandRgbToRgbaAVX2(const uint8_t *src, uint8_t *dst, size_t pixelCount)
+{
+  const __m256i shuffle = _mm256_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1, 0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9,
+                                           10, 11, -1);
+  const __m256i alpha = _mm256_set1_epi32((int)0xFF000000);
+  size_t i = 0;
+
+  // 두 번째 레인은 12 바이트 뒤에서 16 바이트를 읽으므로, 끝에서 버퍼를 넘어 읽지 않도록 2 픽셀의 여유를 둠
+  for (; i + 10 <= pixelCount; i += 8)
+  {
+    const uint8_t *p = src + i * 3;
+    __m256i value = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p))),
+                                            _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + 12)), 1);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i * 4), _mm256_or_si256(_mm256_shuffle_epi8(value, shuffle), alpha));
+  }
+  expandRgbToRgbaScalar(src + i * 3, dst + i * 4, pixelCount - i);
+}
+
+PIXEL_TARGET_AVX2 static void swizzleRgbaBgraAVX2(const uint8_t *src, uint8_t *dst, size_t pixelCount)
+{
+  const __m256i shuffle = _mm256_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15, 2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14,
+                                           13, 12, 15);
+  size_t i = 0;
+  for (; i + 8 <= pixelCount; i += 8)
+  {
+    __m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i * 4));
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i * 4), _mm256_shuffle_epi8(value, shuffle));
+  }
+  swizzleRgbaBgraScalar(src + i * 4, dst + i * 4, pixelCount - i);
+}
+
+// 알파를 RGB 자리에 복제하는 것도 vpshufb 한 번으로 처리 (16 비트로 넓히면서 곧바로 배치)
+PIXEL_TARGET_AVX2 static void premultiplyAlphaAVX2(uint8_t *pixels, size_t pixelCount)
+{
+  const __m256i alphaShuffle = _mm256_setr_epi8(3, -1, 3, -1, 3, -1, -1, -1, 7, -1, 7, -1, 7, -1, -1, -1, 3, -1, 3, -1, 3, -1, -1, -1, 7,
+                                                -1, 7, -1, 7, -1, -1, -1);
+  const __m256i alphaLanes = _mm256_setr_epi16(0, 0, 0, 255, 0, 0, 0, 255, 0, 0, 0, 255, 0, 0, 0, 255);
+  const __m256i round = _mm256_set1_epi16(128);
+  size_t i = 0;
+  for (; i + 8 <= pixelCount; i += 8)
+  {
+    __m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(pixels + i * 4));
+
+    // 레인마다 앞쪽 2 픽셀 / 뒤쪽 2 픽셀을 16 비트로 넓힘
+    __m256i lo = _mm256_unpacklo_epi8(value, _mm256_setzero_si256());
+    __m256i hi = _mm256_unpackhi_epi8(value, _mm256_setzero_si256());
+    __m256i loAlpha = _mm256_or_si256(_mm256_shuffle_epi8(_mm256_shuffle_epi32(value, _MM_SHUFFLE(1, 0, 1, 0)), alphaShuffle), alphaLanes);
+    __m256i hiAlpha = _mm256_or_si256(_mm256_shuffle_epi8(_mm256_shuffle_epi32(value, _MM_SHUFFLE(3, 2, 3, 2)), alphaShuffle), alphaLanes);
+
+    __m256i t = _mm256_add_epi16(_mm256_mullo_epi16(lo, loAlpha), round);
+    lo = _mm256_srli_epi16(_mm256_add_epi16(t, _mm256_srli_epi16(t, 8)), 8);
+    t = _mm256_add_epi16(_mm256_mullo_epi16(hi, hiAlpha), round);
+    hi = _mm256_srli_epi16(_mm256_add_epi16(t, _mm256_srli_epi16(t, 8)), 8);
+
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(pixels + i * 4), _mm256_packus_epi16(lo, hi));
+  }
+  premultiplyAlphaScalar(pixels + i * 4, pixelCount - i);
+}
+
+PIXEL_TARGET_AVX2 static void convert16To8AVX2(const uint16_t *src, uint8_t *dst, size_t valueCount)
+{
+  const __m256i bias = _mm256_set1_epi32(32895);
+  size_t i = 0;
+  for (; i + 16 <= valueCount; i += 16)
+  {
+    __m256i a = _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i)));
+    __m256i b = _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i + 8)));
+    a = _mm256_srli_epi32(_mm256_add_epi32(_mm256_sub_epi32(_mm256_slli_epi32(a, 8), a), bias), 16);
+    b = _mm256_srli_epi32(_mm256_add_epi32(_mm256_sub_epi32(_mm256_slli_epi32(b, 8), b), bias), 16);
+
+    // packs 는 레인마다 처리되므로 결과의 64 비트 블록 순서를 바로잡은 뒤 8 비트로 줄임
+    __m256i packed = _mm256_permute4x64_epi64(_mm256_packs_epi32(a, b), _MM_SHUFFLE(3, 1, 2, 0));
+    __m128i bytes = _mm_packus_epi16(_mm256_castsi256_si128(packed), _mm256_extracti128_si256(packed, 1));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), bytes);
+  }
+  convert16To8Scalar(src + i, dst + i, valueCount - i);
+}
+#endif
+
+/** NEON 커널 */
+
+#ifdef PIXEL_USE_NEON
+static void expandRgbToRgbaNEON(const uint8_t *src, uint8_t *dst, size_t pixelCount)
+{
+  size_t i = 0;
+  for (; i + 16 <= pixelCount; i += 16)
+  {
+    uint8x16x3_t rgb = vld3q_u8(src + i * 3);
+    uint8x16x4_t rgba;
+    rgba.val[0] = rgb.val[0];
+    rgba.val[1] = rgb.val[1];
+    rgba.val[2] = rgb.val[2];
+    rgba.val[3] = vdupq_n_u8(255);
+    vst4q_u8(dst + i * 4, rgba);
+  }
+  expandRgbToRgbaScalar(src + i * 3, dst + i * 4, pixelCount - i);
+}
+
+static void swizzleRgbaBgraNEON(const uint8_t *src, uint8_t *dst, size_t pixelCount)
+{
+  size_t i = 0;
+  for (; i + 16 <= pixelCount; i += 16)
+  {
+    uint8x16x4_t value = vld4q_u8(src + i * 4);
+    uint8x16_t r = value.val[0];
+    value.val[0] = value.val[2];
+    value.val[2] = r;
+    vst4q_u8(dst + i * 4, value);
+  }
+  swizzleRgbaBgraScalar(src + i * 4, dst + i * 4, pixelCount - i);
+}
+
+// 8 개의 채널 값에 대해 반올림된 x * a / 255
+static inline uint8x8_t multiplyAlphaNEON(uint8x8_t x, uint8x8_t a)
+{
+  uint16x8_t t = vaddq_u16(vmull_u8(x, a), vdupq_n_u16(128));
+  return vshrn_n_u16(vaddq_u16(t, vshrq_n_u16(t, 8)), 8);
+}
+
+static void premultiplyAlphaNEON(uint8_t *pixels, size_t pixelCount)
+{
+  size_t i = 0;
+  for (; i + 8 <= pixelCount; i += 8)
+  {
+    uint8x8x4_t value = vld4_u8(pixels + i * 4);
+    value.val[0] = multiplyAlphaNEON(value.val[0], value.val[3]);
+    value.val[1] = multiplyAlphaNEON(value.val[1], value.val[3]);
+    value.val[2] = multiplyAlphaNEON(value.val[2], value.val[3]);
+    vst4_u8(pixels + i * 4, value);
+  }
+  premultiplyAlphaScalar(pixels + i * 4, pixelCount - i);
+}
+
+static void convert16To8NEON(const uint16_t *src, uint8_t *dst, size_t valueCount)
+{
+  const uint32x4_t bias = vdupq_n_u32(32895);
+  size_t i = 0;
+  for (; i + 8 <= valueCount; i += 8)
+  {
+    uint16x8_t value = vld1q_u16(src + i);
+    uint32x4_t lo = vaddq_u32(vmull_n_u16(vget_low_u16(value), 255), bias);
+    uint32x4_t hi = vaddq_u32(vmull_n_u16(vget_high_u16(value), 255), bias);
+    uint16x8_t narrowed = vcombine_u16(vshrn_n_u32(lo, 16), vshrn_n_u32(hi, 16));
+    vst1_u8(dst + i, vmovn_u16(narrowed));
+  }
+  convert16To8Scalar(src + i, dst + i, valueCount - i);
+}
+#endif
+
+/** 실행 시점 선택 */
+
+// 실행 중인 CPU 가 지원하는 명령어 집합인지 여부
+bool isPixelConvertLevelSupported(PixelConvertLevel level)
+{
+  switch (level)
+  {
+  case PIXEL_CONVERT_SCALAR:
+    return true;
+#ifdef PIXEL_USE_SSE2
+  case PIXEL_CONVERT_SSE2:
+    return true;
+#endif
+#ifdef PIXEL_USE_SSSE3
+  case PIXEL_CONVERT_SSSE3:
+#if defined(_MSC_VER) && !defined(__clang__)
+  {
+    int info[4];
+    __cpuid(info, 1);
+    return (info[2] & (1 << 9)) != 0;
+  }
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("ssse3");
+#endif
+#endif
+#ifdef PIXEL_USE_AVX2
+  case PIXEL_CONVERT_AVX2:
+#if defined(_MSC_VER) && !defined(__clang__)
+  {
+    // 운영체제가 YMM 레지스터를 저장해주는지도 확인
+    int info[4];
+    __cpuid(info, 1);
+    bool osxsave = (info[2] & (1 << 27)) != 0;
+    if (!osxsave || (_xgetbv(0) & 0x6) != 0x6)
+      return false;
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+  }
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+#endif
+#endif
+#ifdef PIXEL_USE_NEON
+  case PIXEL_CONVERT_NEON:
+    return true;
+#endif
+  default:
+    return false;
+  }
+}
+
+// 명령어 집합 하나에 해당하는 커널들
+struct PixelConvertKernels
+{
+  PixelConvertLevel level;
+  void (*expandRgbToRgba)(const uint8_t *, uint8_t *, size_t);
+  void (*swizzleRgbaBgra)(const uint8_t *, uint8_t *, size_t);
+  void (*premultiplyAlpha)(uint8_t *, size_t);
+  void (*convert16To8)(const uint16_t *, uint8_t *, size_t);
+};
+
+// level 의 커널들 (해당 명령어 집합에 없는 커널은 한 단계 아래의 커널로 채움)
+static PixelConvertKernels kernelsFor(PixelConvertLevel level)
+{
+  PixelConvertKernels kernels = {PIXEL_CONVERT_SCALAR, expandRgbToRgbaScalar, swizzleRgbaBgraScalar, premultiplyAlphaScalar,
+                                 convert16To8Scalar};
+  kernels.level = level;
+  switch (level)
+  {
+#ifdef PIXEL_USE_SSE2
+  case PIXEL_CONVERT_AVX2:
+#ifdef PIXEL_USE_AVX2
+    kernels.expandRgbToRgba = expandRgbToRgbaAVX2;
+    kernels.swizzleRgbaBgra = swizzleRgbaBgraAVX2;
+    kernels.premultiplyAlpha = premultiplyAlphaAVX2;
+    kernels.convert16To8 = convert16To8AVX2;
+    break;
+#endif
+  case PIXEL_CONVERT_SSSE3:
+#ifdef PIXEL_USE_SSSE3
+    kernels.expandRgbToRgba = expandRgbToRgbaSSSE3;
+    kernels.swizzleRgbaBgra = swizzleRgbaBgraSSSE3;
+    kernels.premultiplyAlpha = premultiplyAlphaSSE2;
+    kernels.convert16To8 = convert16To8SSE2;
+    break;
+#endif
+  case PIXEL_CONVERT_SSE2:
+    kernels.swizzleRgbaBgra = swizzleRgbaBgraSSE2;
+    kernels.premultiplyAlpha = premultiplyAlphaSSE2;
+    kernels.convert16To8 = convert16To8SSE2;
+    break;
+#endif
+#ifdef PIXEL_USE_NEON
+  case PIXEL_CONVERT_NEON:
+    kernels.expandRgbToRgba = expandRgbToRgbaNEON;
+    kernels.swizzleRgbaBgra = swizzleRgbaBgraNEON;
+    kernels.premultiplyAlpha = premultiplyAlphaNEON;
+    kernels.convert16To8 = convert16To8NEON;
+    break;
+#endif
+  default:
+    break;
+  }
+  return kernels;
+}
+
+// 실행 중인 CPU 에서 사용할 수 있는 가장 넓은 명령어 집합
+static PixelConvertLevel bestLevel()
+{
+  const PixelConvertLevel candidates[] = {PIXEL_CONVERT_AVX2, PIXEL_CONVERT_NEON, PIXEL_CONVERT_SSSE3, PIXEL_CONVERT_SSE2};
+  for (size_t i = 0; i < sizeof(candidates) / sizeof(candidates[0]); i++)
+  {
+    if (isPixelConvertLevelSupported(candidates[i]))
+      return candidates[i];
+  }
+  return PIXEL_CONVERT_SCALAR;
+}
+
+// 현재 사용 중인 커널들 (여러 워커 스레드에서 동시에 처음 호출되어도 한 번만 선택됨)
+static PixelConvertKernels &activeKernels()
+{
+  static PixelConvertKernels kernels = kernelsFor(bestLevel());
+  return kernels;
+}
+
+// 현재 사용 중인 명령어 집합
+PixelConvertLevel pixelConvertLevel()
+{
+  return activeKernels().level;
+}
+
+// 명령어 집합 이름
+const char *pixelConvertLevelName(PixelConvertLevel level)
+{
+  switch (level)
+  {
+  case PIXEL_CONVERT_SSE2:
+    return "SSE2";
+  case PIXEL_CONVERT_SSSE3:
+    return "SSSE3";
+  case PIXEL_CONVERT_AVX2:
+    return "AVX2";
+  case PIXEL_CONVERT_NEON:
+    return "NEON";
+  default:
+    return "scalar";
+  }
+}
+
+// 사용할 명령어 집합 변경
+bool setPixelConvertLevel(PixelConvertLevel level)
+{
+  if (!isPixelConvertLevelSupported(level))
+    return false;
+  activeKernels() = kernelsFor(level);
+  return true;
+}
+
+/** 변환 함수 */
+
+void expandRgbToRgba(const uint8_t *src, uint8_t *dst, size_t pixelCount)
+{
+  activeKernels().expandRgbToRgba(src, dst, pixelCount);
+}
+
+void swizzleRgbaBgra(const uint8_t *src, uint8_t *dst, size_t pixelCount)
+{
+  activeKernels().swizzleRgbaBgra(src, dst, pixelCount);
+}
+
+void premultiplyAlpha(uint8_t *pixels, size_t pixelCount)
+{
+  activeKernels().premultiplyAlpha(pixels, pixelCount);
+}
+
+void convert16To8(const uint16_t *src, uint8_t *dst, size_t valueCount)
+{
+  activeKernels().convert16To8(src, dst, valueCount);
+}
+
+/** sRGB <-> 선형 변환표 */
+
+// 8 비트 sRGB <-> 8 비트 선형 변환표 (여러 워커 스레드에서 동시에 처음 호출되어도 한 번만 초기화됨)
+struct SrgbTables8
+{
+  uint8_t toLinear[256];
+  uint8_t toSrgb[256];
+
+  SrgbTables8()
+  {
+    for (int i = 0; i < 256; i++)
+    {
+      float value = i / 255.0f;
+      float linear = value <= 0.04045f ? value / 12.92f : std::pow((value + 0.055f) / 1.055f, 2.4f);
+      float encoded = value <= 0.0031308f ? value * 12.92f : 1.055f * std::pow(value, 1.0f / 2.4f) - 0.055f;
+      toLinear[i] = (uint8_t)(linear * 255.0f + 0.5f);
+      toSrgb[i] = (uint8_t)(encoded * 255.0f + 0.5f);
+    }
+  }
+};
+
+static const SrgbTables8 &srgbTables8()
+{
+  static const SrgbTables8 tables;
+  return tables;
+}
+
+// 색상 채널만 표로 변환하고 알파는 그대로 복사 (표 조회끼리는 서로 의존하지 않으므로 4 개씩 펼쳐서 처리)
+static void applyTable(const uint8_t *table, const uint8_t *src, uint8_t *dst, size_t pixelCount, int channels)
+{
+  if (channels == 1 || channels == 3)
+  {
+    size_t count = pixelCount * channels;
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+      uint8_t a = table[src[i]];
+      uint8_t b = table[src[i + 1]];
+      uint8_t c = table[src[i + 2]];
+      uint8_t d = table[src[i + 3]];
+      dst[i] = a;
+      dst[i + 1] = b;
+      dst[i + 2] = c;
+      dst[i + 3] = d;
+    }
+    for (; i < count; i++)
+      dst[i] = table[src[i]];
+    return;
+  }
+
+  int colorChannels = channels - 1;
+  for (size_t i = 0; i < pixelCount; i++, src += channels, dst += channels)
+  {
+    for (int c = 0; c < colorChannels; c++)
+      dst[c] = table[src[c]];
+    dst[colorChannels] = src[colorChannels];
+  }
+}
+
+void convertSrgbToLinear(const uint8_t *src, uint8_t *dst, size_t pixelCount, int channels)
+{
+  applyTable(srgbTables8().toLinear, src, dst, pixelCount, channels);
+}
+
+void convertLinearToSrgb(const uint8_t *src, uint8_t *dst, size_t pixelCount, int channels)
+{
+  applyTable(srgbTables8().toSrgb, src, dst, pixelCount, channels);
+}
@@ -0,0 +1,389 @@
+#include "texture/texture.hpp"
+#include "gl/pixel_upload_ring.hpp"
+#include "texture/dds.hpp"
+
+#include <iostream> // 콘솔 입출력을 위한 헤더
+#include <cstdint>  // uint32_t
+#include <vector>   // std::vector
+
+// S3TC(GL_EXT_texture_compression_s3tc, GL_EXT_texture_sRGB) 는 확장이라 glad 헤더에 없으므로 직접 정의
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT1_EXT
+#define GL_COMPRESSED_RGBA_S3TC_DXT1_EXT 0x83F1
+#endif
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT5_EXT
+#define GL_COMPRESSED_RGBA_S3TC_DXT5_EXT 0x83F3
+#endif
+#ifndef GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT
+#define GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT 0x8C4D
+#endif
+#ifndef GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT
+#define GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT 0x8C4F
+#endif
+
+// 실행 중인 CPU 가 리틀 엔디안인지 여부
+static bool isLittleEndian()
+{
+  const uint32_t value = 1;
+  return *reinterpret_cast<const unsigned char *>(&value) == 1;
+}
+
+// 드라이버가 internalFormat 에 대해 선호하는 업로드 포맷 중, 픽셀 데이터를 변환하지 않고 쓸 수 있는 조합이 있다면 out 을 갱신
+// (out.format 이 이미 GL_BGRA 라면, 워커 스레드에서 채널 순서를 바꿔둔 픽셀임)
+static void applyPreferredUploadFormat(int channels, TextureFormat &out)
+{
+  // GL_ARB_internalformat_query2 (OpenGL 4.3 core) 가 필요함
+  if (!GLAD_GL_VERSION_4_3)
+    return;
+
+  GLint preferredFormat = 0;
+  GLint preferredType = 0;
+  glGetInternalformativ(GL_TEXTURE_2D, out.internalFormat, GL_TEXTURE_IMAGE_FORMAT, 1, &preferredFormat);
+  glGetInternalformativ(GL_TEXTURE_2D, out.internalFormat, GL_TEXTURE_IMAGE_TYPE, 1, &preferredType);
+  if ((GLenum)preferredFormat != out.format)
+    return; // 채널 순서가 다른 포맷은 픽셀 데이터를 변환해야 하므로 사용하지 않음
+
+  /**
+   * 8 비트 RGBA(BGRA) 픽셀을 리틀 엔디안에서 32 비트 정수 하나로 읽으면 GL_UNSIGNED_INT_8_8_8_8_REV 와 메모리 배치가 같으므로,
+   * 드라이버가 이 타입을 선호한다면 데이터 변환 없이 그대로 넘길 수 있음.
+   */
+  if ((GLenum)preferredType == out.type)
+    return;
+  if ((GLenum)preferredType == GL_UNSIGNED_INT_8_8_8_8_REV && out.type == GL_UNSIGNED_BYTE && channels == 4 && isLittleEndian())
+  {
+    out.type = GL_UNSIGNED_INT_8_8_8_8_REV;
+  }
+}
+
+// Texture 클래스 생성자
+Texture::Texture()
+    : width(0), height(0), levels(0)
+{
+  format.internalFormat = GL_NONE;
+  format.format = GL_NONE;
+  format.type = GL_NONE;
+}
+
+// 픽셀 데이터로 텍스쳐 생성
+bool Texture::create(int width, int height, int channels, int bitsPerChannel, const void *pixels, bool srgb, bool mipmaps,
+                     PixelUploadRing *ring)
+{
+  if (!allocate(width, height, channels, bitsPerChannel, srgb, mipmaps ? mipLevelCount(width, height) : 1))
+    return false;
+
+  uploadLevel(0, width, height, channels, bitsPerChannel, pixels, ring);
+
+  // 밉맵 레벨을 넘겨받지 않았으므로 드라이버에서 생성
+  if (levels > 1)
+  {
+    glGenerateMipmap(GL_TEXTURE_2D);
+  }
+
+  applyParameters(channels);
+  return true;
+}
+
+// CPU 에서 미리 만든 밉맵 레벨들과 함께 8 비트 텍스쳐 생성
+bool Texture::createWithMipmaps(int width, int height, int channels, const void *pixels, const std::vector<MipLevel> &mipmaps, bool srgb,
+                                PixelUploadRing *ring, bool bgra)
+{
+  std::vector<const void *> levels(1, pixels);
+  for (size_t i = 0; i < mipmaps.size(); i++)
+  {
+    levels.push_back(&mipmaps[i].pixels[0]);
+  }
+  return createFromLevels(width, height, channels, levels, srgb, ring, bgra);
+}
+
+// 레벨 0 부터의 8 비트 밉맵 레벨들로 텍스쳐 생성
+bool Texture::createFromLevels(int width, int height, int channels, const std::vector<const void *> &levels, bool srgb,
+                               PixelUploadRing *ring, bool bgra)
+{
+  if (levels.empty() || !allocate(width, height, channels, 8, srgb, (int)levels.size(), bgra && channels == 4))
+    return false;
+
+  // glGenerateMipmap() 대신 레벨마다 업로드 (generateMipmaps() 와 같이 1x1 까지 절반씩 줄어듬)
+  int levelWidth = width;
+  int levelHeight = height;
+  for (size_t i = 0; i < levels.size(); i++)
+  {
+    uploadLevel((int)i, levelWidth, levelHeight, channels, 8, levels[i], ring);
+    levelWidth = levelWidth > 1 ? levelWidth / 2 : 1;
+    levelHeight = levelHeight > 1 ? levelHeight / 2 : 1;
+  }
+
+  applyParameters(channels);
+  return true;
+}
+
+// 블록 압축된 DDS 이미지로 텍스쳐 생성
+bool Texture::createCompressed(const DdsImage &image)
+{
+  GLenum internalFormat = compressedFormat(image.format, image.srgb);
+  if (image.levels.empty() || !isCompressedFormatSupported(internalFormat))
+  {
+    std::cout << "ERROR::TEXTURE::UNSUPPORTED_COMPRESSED_FORMAT: 0x" << std::hex << internalFormat << std::dec << std::endl;
+    return false;
+  }
+
+  this->width = image.width;
+  this->height = image.height;
+  this->levels = (int)image.levels.size();
+  this->format.internalFormat = internalFormat;
+  this->format.format = GL_NONE; // 압축된 데이터는 드라이버가 변환 없이 그대로 복사함
+  this->format.type = GL_NONE;
+
+  ID = TextureHandle::generate();
+  glBindTexture(GL_TEXTURE_2D, ID.get());
+
+  /**
+   * 압축된 데이터는 블록 단위로 채워져 있으므로 GL_UNPACK_ALIGNMENT 의 영향을 받지 않음.
+   *
+   * 파일에 저장된 밉맵 레벨을 그대로 업로드하므로 glGenerateMipmap() 도 호출하지 않음.
+   * (압축 포맷에서의 밉맵 생성은 드라이버가 압축을 풀고 다시 압축해야 하므로 매우 느리거나 지원되지 않음)
+   */
+  if (GLAD_GL_VERSION_4_2)
+  {
+    glTexStorage2D(GL_TEXTURE_2D, levels, internalFormat, width, height);
+    for (int level = 0; level < levels; level++)
+    {
+      const DdsLevel &entry = image.levels[level];
+      glCompressedTexSubImage2D(GL_TEXTURE_2D, level, 0, 0, entry.width, entry.height, internalFormat, (GLsizei)entry.size,
+                                image.bytes() + entry.offset);
+    }
+  }
+  else
+  {
+    for (int level = 0; level < levels; level++)
+    {
+      const DdsLevel &entry = image.levels[level];
+      glCompressedTexImage2D(GL_TEXTURE_2D, level, internalFormat, entry.width, entry.height, 0, (GLsizei)entry.size,
+                             image.bytes() + entry.offset);
+    }
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, levels - 1);
+  }
+
+  // 블록 압축 포맷은 항상 RGBA 이므로 swizzle 은 필요 없음
+  applyParameters(4);
+  return true;
+}
+
+// 포맷을 선택하고 levelCount 개의 밉맵 레벨을 할당한 뒤 바인딩된 상태로 둠
+bool Texture::allocate(int width, int height, int channels, int bitsPerChannel, bool srgb, int levelCount, bool bgra)
+{
+  TextureFormat chosen;
+  if (width <= 0 || height <= 0 || !chooseFormat(channels, bitsPerChannel, srgb, chosen))
+  {
+    std::cout << "ERROR::TEXTURE::UNSUPPORTED_FORMAT: " << width << "x" << height << ", " << channels << " channels, "
+              << bitsPerChannel << " bits" << std::endl;
+    return false;
+  }
+  if (bgra)
+    chosen.format = GL_BGRA;
+  applyPreferredUploadFormat(channels, chosen);
+
+  this->width = width;
+  this->height = height;
+  this->levels = levelCount;
+  this->format = chosen;
+
+  // 기존 텍스쳐가 있었다면 삭제 큐로 넘기고 새로 생성 (불변 텍스쳐는 크기나 포맷을 바꿀 수 없음)
+  ID = TextureHandle::generate();
+  glBindTexture(GL_TEXTURE_2D, ID.get());
+
+  if (GLAD_GL_VERSION_4_2)
+  {
+    // 모든 밉맵 레벨을 한 번에 할당하는 불변 텍스쳐
+    glTexStorage2D(GL_TEXTURE_2D, levels, format.internalFormat, width, height);
+  }
+  else
+  {
+    // glTexStorage2D() 를 사용할 수 없다면 같은 포맷으로 레벨마다 할당 (텍스쳐가 완전해지도록 GL_TEXTURE_MAX_LEVEL 도 맞춰줌)
+    int levelWidth = width;
+    int levelHeight = height;
+    for (int level = 0; level < levels; level++)
+    {
+      glTexImage2D(GL_TEXTURE_2D, level, format.internalFormat, levelWidth, levelHeight, 0, format.format, format.type, NULL);
+      levelWidth = levelWidth > 1 ? levelWidth / 2 : 1;
+      levelHeight = levelHeight > 1 ? levelHeight / 2 : 1;
+    }
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, levels - 1);
+  }
+  return true;
+}
+
+// 바인딩된 텍스쳐의 밉맵 레벨 하나 업로드
+void Texture::uploadLevel(int level, int width, int height, int channels, int bitsPerChannel, const void *pixels, PixelUploadRing *ring)
+{
+  // 행의 바이트 수에 맞춰 GL_UNPACK_ALIGNMENT 를 설정한 뒤 업로드하고, 다른 업로드에 영향이 없도록 기본값(4)으로 되돌림
+  size_t rowBytes = (size_t)width * channels * (bitsPerChannel / 8);
+  glPixelStorei(GL_UNPACK_ALIGNMENT, unpackAlignment(rowBytes));
+  if (ring)
+    ring->texSubImage2D(GL_TEXTURE_2D, level, 0, 0, width, height, format.format, format.type, pixels, rowBytes * height);
+  else
+    glTexSubImage2D(GL_TEXTURE_2D, level, 0, 0, width, height, format.format, format.type, pixels);
+  glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+}
+
+// 바인딩된 텍스쳐의 샘플링 파라미터를 설정하고 바인딩 해제
+void Texture::applyParameters(int channels)
+{
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, levels > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+  // 1, 2 채널 텍스쳐는 쉐이더에서 vec4 로 샘플링할 때 흑백 이미지로 보이도록 swizzle 설정
+  if (channels == 1)
+  {
+    GLint swizzle[4] = {GL_RED, GL_RED, GL_RED, GL_ONE};
+    glTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_RGBA, swizzle);
+  }
+  else if (channels == 2)
+  {
+    GLint swizzle[4] = {GL_RED, GL_RED, GL_RED, GL_GREEN};
+    glTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_RGBA, swizzle);
+  }
+
+  glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+// 지정한 텍스쳐 유닛에 바인딩
+void Texture::bind(unsigned int unit) const
+{
+  glActiveTexture(GL_TEXTURE0 + unit);
+  glBindTexture(GL_TEXTURE_2D, ID.get());
+}
+
+int Texture::getWidth() const
+{
+  return width;
+}
+
+int Texture::getHeight() const
+{
+  return height;
+}
+
+int Texture::getLevels() const
+{
+  return levels;
+}
+
+const TextureFormat &Texture::getFormat() const
+{
+  return format;
+}
+
+// 채널 수, 채널당 비트 수, sRGB 여부에 맞는 포맷 선택
+bool Texture::chooseFormat(int channels, int bitsPerChannel, bool srgb, TextureFormat &out)
+{
+  if (bitsPerChannel != 8 && bitsPerChannel != 16)
+    return false;
+  bool wide = bitsPerChannel == 16;
+  out.type = wide ? GL_UNSIGNED_SHORT : GL_UNSIGNED_BYTE;
+
+  /**
+   * sRGB 포맷은 8 비트 RGB, RGBA 에만 존재함.
+   *
+   * 1, 2 채널 이미지는 보통 마스크나 노멀맵 등 색상이 아닌 데이터이고,
+   * 16 비트 이미지는 감마 보정 없이도 어두운 영역의 정밀도가 충분하므로 선형 포맷을 사용함.
+   */
+  switch (channels)
+  {
+  case 1:
+    out.format = GL_RED;
+    out.internalFormat = wide ? GL_R16 : GL_R8;
+    return true;
+  case 2:
+    out.format = GL_RG;
+    out.internalFormat = wide ? GL_RG16 : GL_RG8;
+    return true;
+  case 3:
+    out.format = GL_RGB;
+    out.internalFormat = wide ? GL_RGB16 : (srgb ? GL_SRGB8 : GL_RGB8);
+    return true;
+  case 4:
+    out.format = GL_RGBA;
+    out.internalFormat = wide ? GL_RGBA16 : (srgb ? GL_SRGB8_ALPHA8 : GL_RGBA8);
+    return true;
+  default:
+    return false;
+  }
+}
+
+// 블록 압축 포맷에 해당하는 GL 내부 포맷
+GLenum Texture::compressedFormat(BlockFormat format, bool srgb)
+{
+  /**
+   * BC1 은 알파가 없는 GL_COMPRESSED_RGB_S3TC_DXT1_EXT 대신 알파가 있는 RGBA 포맷으로 업로드함.
+   *
+   * 인코더는 4 색상 모드만 사용하므로 결과는 같지만, sRGB 버전은 RGBA 포맷만 짝이 맞기 때문에 둘을 통일함.
+   */
+  switch (format)
+  {
+  case BLOCK_FORMAT_BC1:
+    return srgb ? GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT : GL_COMPRESSED_RGBA_S3TC_DXT1_EXT;
+  case BLOCK_FORMAT_BC3:
+    return srgb ? GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT : GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+  default:
+    return srgb ? GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM : GL_COMPRESSED_RGBA_BPTC_UNORM;
+  }
+}
+
+// 드라이버가 압축된 데이터를 그대로 받아들이는 내부 포맷인지 여부
+bool Texture::isCompressedFormatSupported(GLenum internalFormat)
+{
+  // BPTC(BC7) 는 OpenGL 4.2 부터 코어에 포함됨
+  if (GLAD_GL_VERSION_4_2 && (internalFormat == GL_COMPRESSED_RGBA_BPTC_UNORM || internalFormat == GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM))
+    return true;
+
+  // 그 외에는 드라이버가 알려주는 압축 포맷 목록에서 찾음 (S3TC 는 데스크탑 드라이버라면 사실상 항상 지원됨)
+  GLint count = 0;
+  glGetIntegerv(GL_NUM_COMPRESSED_TEXTURE_FORMATS, &count);
+  if (count <= 0)
+    return false;
+  std::vector<GLint> formats((size_t)count);
+  glGetIntegerv(GL_COMPRESSED_TEXTURE_FORMATS, &formats[0]);
+  for (size_t i = 0; i < formats.size(); i++)
+  {
+    if ((GLenum)formats[i] == internalFormat)
+      return true;
+  }
+  return false;
+}
+
+// 드라이버가 8 비트 RGBA 텍스쳐의 업로드 포맷으로 GL_BGRA 를 선호하는지 여부
+bool Texture::prefersBgraUpload(bool srgb)
+{
+  if (!GLAD_GL_VERSION_4_3)
+    return false;
+
+  GLint preferredFormat = 0;
+  glGetInternalformativ(GL_TEXTURE_2D, srgb ? GL_SRGB8_ALPHA8 : GL_RGBA8, GL_TEXTURE_IMAGE_FORMAT, 1, &preferredFormat);
+  return (GLenum)preferredFormat == GL_BGRA;
+}
+
+// 행의 바이트 수로 나누어 떨어지는 가장 큰 GL_UNPACK_ALIGNMENT 값
+int Texture::unpackAlignment(size_t rowBytes)
+{
+  if (rowBytes % 8 == 0)
+    return 8;
+  if (rowBytes % 4 == 0)
+    return 4;
+  if (rowBytes % 2 == 0)
+    return 2;
+  return 1;
+}
+
+// 1x1 까지의 밉맵 레벨 개수
+int Texture::mipLevelCount(int width, int height)
+{
+  int size = width > height ? width : height;
+  int count = 1;
+  while (size > 1)
+  {
+    size /= 2;
+    count++;
+  }
+  return count;
+}
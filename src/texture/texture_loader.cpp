@@ -0,0 +1,477 @@
+#include "texture/texture_loader.hpp"
+#include "asset/asset_pack.hpp"
+#include "gl/pixel_upload_ring.hpp"
+#include "texture/dds.hpp"
+#include "texture/image_decoder.hpp"
+#include "texture/mip_generator.hpp"
+#include "texture/pixel_cache.hpp"
+#include "texture/pixel_convert.hpp"
+#include "util/hash.hpp"
+
+#include <iostream> // 콘솔 입출력을 위한 헤더
+
+// 디스크 캐시 키에 넣는 디코딩 결과의 버전 (밉맵 필터나 변환 방식이 바뀌어 같은 설정에서도 결과가 달라진다면 올려서 기존 캐시를 무효화)
+static const uint32_t PIXEL_CACHE_LOADER_VERSION = 1;
+
+// 텍스쳐 하나의 로딩 진행 상태
+struct TextureFuture::Request
+{
+  // 로딩 진행 단계 (GL 스레드에서만 접근)
+  enum Stage
+  {
+    STAGE_LOADING, // 디코딩 또는 업로드 대기
+    STAGE_READY,   // 완료
+    STAGE_FAILED   // 실패
+  };
+
+  Stage stage;
+  std::string path;
+  bool srgb;          // 색상 데이터라면 sRGB 포맷으로 생성
+  MipFilter mipFilter; // 워커 스레드에서 밉맵을 만들 때 사용할 필터
+  bool bgra;           // 드라이버가 GL_BGRA 업로드를 선호한다면 true (4 채널 8 비트 픽셀은 워커 스레드에서 채널 순서를 바꿔둠)
+  GLuint placeholder; // 완료 전까지 대신 바인딩할 텍스쳐
+
+  // 워커 스레드에서 채워지고, 큐를 통해 GL 스레드로 넘어감
+  bool decoded;    // 디코딩(또는 DDS 해석) 성공 여부
+  bool compressed; // 빌드 시점에 블록 압축된 DDS 파일이라면 true (pixels 대신 dds 를 업로드)
+  void *pixels;
+  int width;
+  int height;
+  int channels;
+  int bitsPerChannel;
+  std::vector<MipLevel> mipmaps; // 8 비트 이미지라면 워커 스레드에서 미리 만든 레벨 1 부터의 밉맵들
+  DdsImage dds;
+  PixelCacheEntry cached;        // 디스크 캐시에 적중했다면 매핑된 캐시 파일 (pixels 와 mipmaps 대신 업로드)
+
+  Texture texture;
+
+  Request()
+      : stage(STAGE_LOADING), srgb(false), mipFilter(MIP_FILTER_KAISER), bgra(false), placeholder(0), decoded(false), compressed(false), pixels(nullptr), width(0), height(0),
+        channels(0), bitsPerChannel(8) {}
+};
+
+// start 부터 end 까지 흐른 시간 (ms)
+static double durationMs(std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end)
+{
+  return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+/** TextureFuture 구현부 */
+
+TextureFuture::TextureFuture()
+{
+}
+
+// 디코딩 및 업로드가 성공적으로 완료되었는지 여부
+bool TextureFuture::ready() const
+{
+  return request && request->stage == Request::STAGE_READY;
+}
+
+// 디코딩에 실패했는지 여부
+bool TextureFuture::failed() const
+{
+  return request && request->stage == Request::STAGE_FAILED;
+}
+
+// 바인딩할 텍스쳐 객체 (아직 완료되지 않았거나 실패했다면 대체 텍스쳐)
+GLuint TextureFuture::get() const
+{
+  if (!request)
+    return 0;
+  return ready() ? request->texture.ID.get() : request->placeholder;
+}
+
+// 완료된 텍스쳐 (아직 완료되지 않았거나 실패했다면 nullptr)
+const Texture *TextureFuture::texture() const
+{
+  return ready() ? &request->texture : nullptr;
+}
+
+/** TextureLoader 구현부 */
+
+// TextureLoader 클래스 생성자
+TextureLoader::TextureLoader(unsigned int threadCount, MipFilter mipFilter)
+    : mipFilter(mipFilter), stopping(false), diskCache(nullptr), pending(0), uploadRing(nullptr), decodeCount(0), decodeBytes(0), decodeMs(0.0), uploadCount(0), uploadMs(0.0)
+{
+  // 로딩이 끝나기 전까지 바인딩할 1x1 회색 텍스쳐
+  const unsigned char gray[4] = {128, 128, 128, 255};
+  placeholderTexture = TextureHandle::generate();
+  glBindTexture(GL_TEXTURE_2D, placeholderTexture.get());
+  glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, gray);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+  glBindTexture(GL_TEXTURE_2D, 0);
+
+  // 드라이버가 선호하는 채널 순서는 GL 스레드에서만 조회할 수 있으므로 미리 조회해두고 요청마다 넘겨줌
+  bgraUpload[0] = Texture::prefersBgraUpload(false);
+  bgraUpload[1] = Texture::prefersBgraUpload(true);
+
+  // GL 스레드 몫으로 코어 하나를 남겨두고 나머지 코어 수만큼 워커 스레드 생성
+  if (threadCount == 0)
+  {
+    unsigned int cores = std::thread::hardware_concurrency();
+    threadCount = cores > 1 ? cores - 1 : 1;
+  }
+  for (unsigned int i = 0; i < threadCount; i++)
+  {
+    workers.push_back(std::thread(&TextureLoader::run, this));
+  }
+}
+
+// TextureLoader 클래스 소멸자
+TextureLoader::~TextureLoader()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    stopping = true;
+    jobs.clear();
+  }
+  wakeUp.notify_all();
+  for (size_t i = 0; i < workers.size(); i++)
+  {
+    workers[i].join();
+  }
+
+  // 업로드되지 못한 픽셀 데이터 메모리 반납 (텍스쳐 객체는 핸들이 소멸되면서 삭제 큐로 넘어감)
+  for (size_t i = 0; i < decoded.size(); i++)
+  {
+    freeImagePixels(decoded[i]->pixels);
+    decoded[i]->pixels = nullptr;
+  }
+}
+
+// 텍스쳐 로딩 요청
+TextureFuture TextureLoader::submit(const std::string &path, bool srgb)
+{
+  TextureFuture future;
+  future.request = std::make_shared<TextureFuture::Request>();
+  future.request->path = path;
+  future.request->srgb = srgb;
+  future.request->mipFilter = mipFilter;
+  future.request->bgra = bgraUpload[srgb ? 1 : 0];
+  future.request->placeholder = placeholderTexture.get();
+
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (decodeCount == 0 && jobs.empty() && pending == 0)
+    {
+      firstSubmit = Clock::now();
+    }
+    jobs.push_back(future.request);
+  }
+  wakeUp.notify_one();
+  pending++;
+  return future;
+}
+
+// 매 프레임마다 호출하여 디코딩이 끝난 텍스쳐를 budgetMs 안에서 업로드
+void TextureLoader::update(double budgetMs)
+{
+  /**
+   * 업로드(glTexSubImage2D + glGenerateMipmap)는 GL 스레드를 막으므로 프레임당 시간 예산 안에서만 처리함.
+   *
+   * 텍스쳐 하나의 업로드가 예산을 넘길 수는 있지만, 적어도 한 개는 매 프레임 업로드되도록 보장함.
+   */
+  Clock::time_point start = Clock::now();
+  size_t uploaded = 0;
+  while (pending > 0)
+  {
+    std::shared_ptr<TextureFuture::Request> request;
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      if (decoded.empty())
+        break;
+
+      // 링의 이번 프레임 구간에 다 들어가지 않는 텍스쳐는 다음 프레임으로 미룸 (링보다 큰 텍스쳐도 프레임의 첫 업로드로는 처리됨)
+      if (uploadRing && uploaded > 0 && ringBytes(*decoded.front()) > uploadRing->remaining())
+        break;
+
+      request = decoded.front();
+      decoded.pop_front();
+    }
+
+    upload(*request);
+    uploaded++;
+
+    if (durationMs(start, Clock::now()) >= budgetMs)
+      break;
+  }
+}
+
+// 픽셀 데이터를 업로드할 때 사용할 링
+void TextureLoader::setUploadRing(PixelUploadRing *ring)
+{
+  uploadRing = ring;
+}
+
+// 디코딩된 픽셀을 저장하고 다시 읽어올 디스크 캐시
+void TextureLoader::setDiskCache(PixelCache *cache)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  diskCache = cache;
+}
+
+// 아직 완료되지 않은 모든 요청이 끝날 때까지 대기
+void TextureLoader::finish()
+{
+  while (pending > 0)
+  {
+    std::shared_ptr<TextureFuture::Request> request;
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      while (decoded.empty())
+      {
+        decodedSignal.wait(lock);
+      }
+      request = decoded.front();
+      decoded.pop_front();
+    }
+    upload(*request);
+  }
+}
+
+// 아직 완료되지 않은 요청 개수
+size_t TextureLoader::pendingCount() const
+{
+  return pending;
+}
+
+// 디코딩 및 업로드되기 전까지 대신 바인딩되는 1x1 텍스쳐
+GLuint TextureLoader::placeholder() const
+{
+  return placeholderTexture.get();
+}
+
+// 디코딩 처리량 및 업로드 시간 출력
+void TextureLoader::report() const
+{
+  std::lock_guard<std::mutex> lock(mutex);
+
+  // 워커 스레드들이 병렬로 디코딩하므로, 첫 요청부터 마지막 디코딩 완료까지의 실제 경과 시간으로 처리량을 계산
+  double wallMs = decodeCount > 0 ? durationMs(firstSubmit, lastDecoded) : 0.0;
+  double megabytes = decodeBytes / (1024.0 * 1024.0);
+  double throughput = wallMs > 0.0 ? megabytes / (wallMs / 1000.0) : 0.0;
+
+  std::cout << "TEXTURE::STATS: " << decodeCount << " textures decoded on " << workers.size() << " threads, "
+            << megabytes << " MB in " << wallMs << " ms (" << throughput << " MB/s, " << decodeMs << " ms CPU), "
+            << uploadCount << " uploads in " << uploadMs << " ms" << std::endl;
+}
+
+// 워커 스레드 루프
+void TextureLoader::run()
+{
+  while (true)
+  {
+    std::shared_ptr<TextureFuture::Request> request;
+    PixelCache *cache = nullptr;
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      while (!stopping && jobs.empty())
+      {
+        wakeUp.wait(lock);
+      }
+      if (stopping)
+        return;
+      request = jobs.front();
+      jobs.pop_front();
+      cache = diskCache;
+    }
+
+    // 디코딩은 OpenGL 컨텍스트 없이 워커 스레드에서 처리
+    Clock::time_point start = Clock::now();
+    decode(*request, cache);
+    Clock::time_point end = Clock::now();
+
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      decodeMs += durationMs(start, end);
+      lastDecoded = end;
+      if (request->decoded)
+      {
+        decodeCount++;
+        decodeBytes += request->compressed ? request->dds.byteCount()
+                                           : (size_t)request->width * request->height * request->channels * (request->bitsPerChannel / 8);
+      }
+      decoded.push_back(request);
+    }
+    decodedSignal.notify_one();
+  }
+}
+
+// 워커 스레드에서 이미지 파일 하나를 디코딩
+void TextureLoader::decode(TextureFuture::Request &request, PixelCache *cache)
+{
+  /**
+   * 디스크 캐시에 디코딩 결과가 있다면 파일을 매핑하기만 하고 끝냄. (파일 읽기, 디코딩, 밉맵 생성, 채널 순서 변환 모두 생략)
+   *
+   * 캐시 키에는 디코딩 결과에 영향을 주는 설정(sRGB 여부, 밉맵 필터, 채널 순서)을 모두 넣어야 함.
+   * 에셋 팩 안의 파일은 원본의 수정 시각을 알 수 없고, 이미 매핑된 팩에서 곧바로 디코딩하므로 캐시하지 않음.
+   */
+  PixelCacheKey cacheKey;
+  const char *packedData;
+  size_t packedSize;
+  uint32_t settings[4] = {PIXEL_CACHE_LOADER_VERSION, request.srgb ? 1u : 0u, (uint32_t)request.mipFilter, request.bgra ? 1u : 0u};
+  bool cacheable = cache && !AssetPack::shared().find(request.path, packedData, packedSize) &&
+                   cache->makeKey(request.path, fnv1a64(settings, sizeof(settings)), cacheKey);
+  if (cacheable && cache->lookup(cacheKey, request.cached))
+  {
+    request.width = request.cached.width;
+    request.height = request.cached.height;
+    request.channels = request.cached.channels;
+    request.bitsPerChannel = request.cached.bitsPerChannel;
+    request.bgra = request.bgra && request.bitsPerChannel == 8 && request.channels == 4;
+    request.decoded = true;
+    return;
+  }
+
+  /**
+   * 에셋 팩에 있는 파일이라면 팩의 메모리를 그대로 사용하고 (복사 없음),
+   * 없다면 파일을 한 번만 읽어두고, 헤더 조회와 디코딩은 메모리에서 처리
+   */
+  std::string file;
+  const char *bytes = nullptr;
+  size_t byteCount = 0;
+  if (!readAssetView(request.path, file, bytes, byteCount) || byteCount == 0)
+    return;
+  bool packed = file.empty();
+
+  // 블록 압축된 DDS 파일은 디코딩 없이 헤더만 해석하고, 압축된 데이터를 그대로 업로드함
+  // (에셋 팩의 DDS 는 매핑된 메모리에서 곧바로 업로드되므로 한 번도 복사되지 않음)
+  if (packed ? parseDdsView(bytes, byteCount, request.dds) : parseDds(file, request.dds))
+  {
+    request.compressed = true;
+    request.decoded = true;
+    return;
+  }
+
+  // 파일 시그니처에 맞는 디코더 백엔드로 디코딩 (PNG 는 SIMD 백엔드, 그 외 포맷이나 지원하지 않는 변형은 stb_image)
+  const uint8_t *data = reinterpret_cast<const uint8_t *>(bytes);
+  const ImageDecoders &decoders = ImageDecoders::shared();
+
+  int width, height, channels, bitsPerChannel;
+  if (!decoders.info(data, byteCount, width, height, channels, bitsPerChannel))
+    return;
+
+  /**
+   * 3 채널 이미지는 디코딩하면서 4 채널로 채워넣음.
+   *
+   * 대부분의 드라이버는 RGB8 텍스쳐도 내부적으로는 픽셀당 4 바이트로 저장하기 때문에,
+   * 3 바이트 픽셀을 그대로 넘기면 업로드 시점에 GL 스레드에서 변환 작업이 일어남.
+   * (디코더가 디코딩 중에 채워넣는 것은 워커 스레드에서 처리되므로 거의 공짜)
+   */
+  int desired = channels == 3 ? 4 : channels;
+  DecodedImage image;
+  request.decoded = decoders.decode(data, byteCount, desired, image);
+  request.pixels = image.pixels;
+  request.width = image.width;
+  request.height = image.height;
+  request.channels = image.channels;
+  request.bitsPerChannel = image.bitsPerChannel;
+
+  /**
+   * 8 비트 이미지는 밉맵 체인도 워커 스레드에서 만들어둠. (업로드 시 glGenerateMipmap() 을 호출하지 않음)
+   *
+   * 여러 텍스쳐가 워커 스레드들에서 이미 병렬로 처리되고 있으므로, 텍스쳐 하나 안에서는 스레드를 더 만들지 않음.
+   * 16 비트 이미지는 드라이버의 glGenerateMipmap() 을 그대로 사용함.
+   */
+  if (request.decoded && request.bitsPerChannel == 8)
+  {
+    generateMipmaps(static_cast<const uint8_t *>(request.pixels), request.width, request.height, request.channels, request.srgb,
+                    request.mipFilter, request.mipmaps, 1);
+  }
+
+  // 드라이버가 GL_BGRA 를 선호한다면 밉맵까지 모두 채널 순서를 바꿔둠 (업로드할 때 드라이버가 변환하지 않도록)
+  request.bgra = request.bgra && request.decoded && request.bitsPerChannel == 8 && request.channels == 4;
+  if (request.bgra)
+  {
+    uint8_t *pixels = static_cast<uint8_t *>(request.pixels);
+    swizzleRgbaBgra(pixels, pixels, (size_t)request.width * request.height);
+    for (size_t i = 0; i < request.mipmaps.size(); i++)
+    {
+      MipLevel &level = request.mipmaps[i];
+      swizzleRgbaBgra(&level.pixels[0], &level.pixels[0], (size_t)level.width * level.height);
+    }
+  }
+
+  // 업로드할 모습 그대로 캐시에 저장 (16 비트 이미지는 밉맵을 드라이버가 만들므로 레벨 0 만 저장)
+  if (cacheable && request.decoded)
+  {
+    std::vector<const void *> levels(1, request.pixels);
+    for (size_t i = 0; i < request.mipmaps.size(); i++)
+    {
+      levels.push_back(&request.mipmaps[i].pixels[0]);
+    }
+    cache->store(cacheKey, request.width, request.height, request.channels, request.bitsPerChannel, levels);
+  }
+}
+
+// 디코딩이 끝난 요청 하나를 GL 스레드에서 업로드
+void TextureLoader::upload(TextureFuture::Request &request)
+{
+  pending--;
+  if (!request.decoded)
+  {
+    std::cout << "ERROR::TEXTURE_LOADER::DECODE_FAILED: " << request.path << std::endl;
+    request.stage = TextureFuture::Request::STAGE_FAILED;
+    return;
+  }
+
+  Clock::time_point start = Clock::now();
+  bool created = false;
+  if (request.compressed)
+  {
+    // 압축된 밉맵 레벨들을 그대로 업로드 (sRGB 여부는 빌드 시점에 DDS 에 기록된 값을 따름)
+    created = request.texture.createCompressed(request.dds);
+    request.dds = DdsImage();
+  }
+  else if (request.cached.file)
+  {
+    // 매핑된 캐시 파일의 레벨들을 복사 없이 그대로 업로드하고 매핑 해제
+    if (request.bitsPerChannel == 8)
+      created = request.texture.createFromLevels(request.width, request.height, request.channels, request.cached.levels, request.srgb,
+                                                 uploadRing, request.bgra);
+    else
+      created = request.texture.create(request.width, request.height, request.channels, request.bitsPerChannel,
+                                       request.cached.levels[0], request.srgb, true, uploadRing);
+    request.cached = PixelCacheEntry();
+  }
+  else
+  {
+    // 채널 수와 비트 수에 맞는 포맷의 불변 텍스쳐로 생성 (미리 만든 밉맵이 있다면 레벨마다 업로드)
+    if (request.bitsPerChannel == 8)
+      created = request.texture.createWithMipmaps(request.width, request.height, request.channels, request.pixels, request.mipmaps,
+                                                  request.srgb, uploadRing, request.bgra);
+    else
+      created = request.texture.create(request.width, request.height, request.channels, request.bitsPerChannel, request.pixels,
+                                       request.srgb, true, uploadRing);
+    request.mipmaps.clear();
+
+    // 업로드가 끝난 픽셀 데이터 메모리 반납
+    freeImagePixels(request.pixels);
+    request.pixels = nullptr;
+  }
+  request.stage = created ? TextureFuture::Request::STAGE_READY : TextureFuture::Request::STAGE_FAILED;
+
+  uploadCount++;
+  uploadMs += durationMs(start, Clock::now());
+}
+
+// 요청 하나를 업로드할 때 링을 거치는 바이트 수
+size_t TextureLoader::ringBytes(const TextureFuture::Request &request)
+{
+  if (!request.decoded || request.compressed)
+    return 0;
+
+  size_t bytes = (size_t)request.width * request.height * request.channels * (request.bitsPerChannel / 8);
+  for (size_t i = 0; i < request.mipmaps.size(); i++)
+  {
+    bytes += request.mipmaps[i].pixels.size();
+  }
+  for (size_t level = 1; level < request.cached.levels.size(); level++)
+  {
+    bytes += (size_t)PixelCache::levelDimension(request.width, (int)level) * PixelCache::levelDimension(request.height, (int)level) *
+             request.channels;
+  }
+  return bytes;
+}
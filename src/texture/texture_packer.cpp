@@ -0,0 +1,361 @@
+#include "texture/texture_packer.hpp"
+#include "texture/pixel_convert.hpp"
+#include "texture/texture.hpp"
+
+#include <algorithm> // std::sort, std::min, std::max
+#include <cstring>   // std::memcpy
+#include <map>       // std::map
+#include <iostream>  // 콘솔 입출력을 위한 헤더
+
+// value 를 alignment 의 배수로 올림
+static int alignUp(int value, int alignment)
+{
+  return (value + alignment - 1) / alignment * alignment;
+}
+
+// 2 의 거듭제곱 value 의 log2
+static int log2Floor(int value)
+{
+  int result = 0;
+  while (value > 1)
+  {
+    value >>= 1;
+    result++;
+  }
+  return result;
+}
+
+// TexturePacker 클래스 생성자
+TexturePacker::TexturePacker(int atlasSize, int gutter)
+    : atlasSize(atlasSize), gutter(gutter), atlasUsedTexels(0)
+{
+}
+
+// 텍스쳐 하나 추가
+int TexturePacker::add(const std::string &name, int width, int height, int channels, const uint8_t *pixels, bool srgb)
+{
+  Input input;
+  input.name = name;
+  input.width = width;
+  input.height = height;
+  input.srgb = srgb;
+
+  // 채널 수와 상관없이 같은 배열에 담을 수 있도록 RGBA 로 확장 (1, 2 채널은 흑백 + 알파로 취급)
+  size_t texels = (size_t)width * height;
+  input.pixels.resize(texels * 4);
+  if (channels == 4)
+  {
+    std::memcpy(&input.pixels[0], pixels, texels * 4);
+  }
+  else if (channels == 3)
+  {
+    expandRgbToRgba(pixels, &input.pixels[0], texels);
+  }
+  else
+  {
+    for (size_t i = 0; i < texels; i++)
+    {
+      const uint8_t *src = pixels + i * channels;
+      uint8_t *dst = &input.pixels[i * 4];
+      dst[0] = src[0];
+      dst[1] = src[0];
+      dst[2] = src[0];
+      dst[3] = channels == 2 ? src[1] : 255;
+    }
+  }
+
+  inputs.push_back(input);
+  return (int)inputs.size() - 1;
+}
+
+// 추가된 텍스쳐들을 페이지로 묶고 업로드
+bool TexturePacker::build(MipFilter filter)
+{
+  placements.assign(inputs.size(), MaterialPlacement());
+  pages.clear();
+  atlasUsedTexels = 0;
+
+  GLint maxLayers = 256; // OpenGL 3.0 이상에서 보장되는 최소값
+  glGetIntegerv(GL_MAX_ARRAY_TEXTURE_LAYERS, &maxLayers);
+
+  for (int srgb = 0; srgb < 2; srgb++)
+  {
+    // 크기가 같은 텍스쳐들끼리 모음
+    std::map<std::pair<int, int>, std::vector<int> > bySize;
+    for (size_t i = 0; i < inputs.size(); i++)
+    {
+      if (inputs[i].srgb == (srgb != 0))
+        bySize[std::make_pair(inputs[i].width, inputs[i].height)].push_back((int)i);
+    }
+
+    std::vector<int> atlasMaterials;
+    for (std::map<std::pair<int, int>, std::vector<int> >::const_iterator it = bySize.begin(); it != bySize.end(); ++it)
+    {
+      int width = it->first.first;
+      int height = it->first.second;
+      const std::vector<int> &materials = it->second;
+
+      // 크기가 같은 텍스쳐가 하나뿐이고 아틀라스에 들어간다면 아틀라스로 보냄
+      bool fitsAtlas = width + 2 * gutter <= atlasSize && height + 2 * gutter <= atlasSize;
+      if (materials.size() == 1 && fitsAtlas)
+      {
+        atlasMaterials.push_back(materials[0]);
+        continue;
+      }
+
+      // 나머지는 텍스쳐마다 레이어 하나씩 (레이어 수 제한을 넘으면 페이지를 나눔)
+      for (size_t first = 0; first < materials.size(); first += (size_t)maxLayers)
+      {
+        size_t count = std::min(materials.size() - first, (size_t)maxLayers);
+        std::vector<const uint8_t *> layers;
+        for (size_t l = 0; l < count; l++)
+        {
+          int material = materials[first + l];
+          layers.push_back(&inputs[material].pixels[0]);
+
+          MaterialPlacement &placement = placements[material];
+          placement.page = (int)pages.size();
+          placement.layer = (int)l;
+          placement.uvRect[0] = 0.0f;
+          placement.uvRect[1] = 0.0f;
+          placement.uvRect[2] = 1.0f;
+          placement.uvRect[3] = 1.0f;
+        }
+        createPage(width, height, false, srgb != 0, layers, filter);
+      }
+    }
+
+    if (!atlasMaterials.empty())
+      packAtlas(atlasMaterials, srgb != 0, maxLayers);
+  }
+
+  // 업로드가 끝났으므로 복사해둔 픽셀 데이터는 해제 (placements 와 이름은 남겨둠)
+  for (size_t i = 0; i < inputs.size(); i++)
+  {
+    std::vector<uint8_t>().swap(inputs[i].pixels);
+  }
+  return true;
+}
+
+// 크기가 제각각인 텍스쳐들을 아틀라스 레이어들에 나눠 담음
+void TexturePacker::packAtlas(const std::vector<int> &materials, bool srgb, int maxLayers)
+{
+  /**
+   * 선반(shelf) 방식 : 높이가 큰 순서대로 왼쪽부터 한 줄씩 채우고, 줄이 넘치면 그 줄의 가장 큰 높이만큼 내려가서 다음 줄을 시작함.
+   *
+   * 칸(cell)의 크기와 위치를 모두 gutter 의 배수로 맞춰두면, gutter 크기의 블록이 항상 한 칸 안에만 있으므로
+   * 박스 필터로 log2(gutter) 번 줄이는 동안에는 이웃한 칸의 픽셀이 섞이지 않음.
+   */
+  std::vector<int> order = materials;
+  std::sort(order.begin(), order.end(), [this](int a, int b)
+            { return inputs[a].height != inputs[b].height ? inputs[a].height > inputs[b].height : inputs[a].width > inputs[b].width; });
+
+  std::vector<std::vector<uint8_t> > layers;
+  int cursorX = 0;
+  int cursorY = 0;
+  int shelfHeight = 0;
+  for (size_t i = 0; i < order.size(); i++)
+  {
+    const Input &input = inputs[order[i]];
+    int cellWidth = alignUp(input.width + 2 * gutter, gutter);
+    int cellHeight = alignUp(input.height + 2 * gutter, gutter);
+
+    if (cursorX + cellWidth > atlasSize)
+    {
+      cursorX = 0;
+      cursorY += shelfHeight;
+      shelfHeight = 0;
+    }
+    if (layers.empty() || cursorY + cellHeight > atlasSize)
+    {
+      // 레이어 수 제한에 도달했다면 지금까지 채운 레이어들로 페이지를 만들고 다음 페이지에서 새로 시작
+      if ((int)layers.size() == maxLayers)
+        flushAtlas(layers, srgb);
+
+      layers.push_back(std::vector<uint8_t>((size_t)atlasSize * atlasSize * 4, 0));
+      cursorX = 0;
+      cursorY = 0;
+      shelfHeight = 0;
+    }
+
+    // 텍스쳐를 복사하면서 gutter 영역은 가장자리 픽셀을 복제하여 채움 (바이리니어 필터링이 경계 밖을 읽어도 같은 색)
+    std::vector<uint8_t> &layer = layers.back();
+    for (int y = -gutter; y < input.height + gutter; y++)
+    {
+      int sourceY = std::min(std::max(y, 0), input.height - 1);
+      uint8_t *dst = &layer[((size_t)(cursorY + gutter + y) * atlasSize + cursorX) * 4];
+      const uint8_t *src = &input.pixels[(size_t)sourceY * input.width * 4];
+      for (int x = -gutter; x < input.width + gutter; x++)
+      {
+        int sourceX = std::min(std::max(x, 0), input.width - 1);
+        std::copy(src + sourceX * 4, src + sourceX * 4 + 4, dst + (gutter + x) * 4);
+      }
+    }
+
+    MaterialPlacement &placement = placements[order[i]];
+    placement.page = (int)pages.size();
+    placement.layer = (int)layers.size() - 1;
+    placement.uvRect[0] = (float)(cursorX + gutter) / atlasSize;
+    placement.uvRect[1] = (float)(cursorY + gutter) / atlasSize;
+    placement.uvRect[2] = (float)input.width / atlasSize;
+    placement.uvRect[3] = (float)input.height / atlasSize;
+    atlasUsedTexels += (size_t)input.width * input.height;
+
+    cursorX += cellWidth;
+    shelfHeight = std::max(shelfHeight, cellHeight);
+  }
+
+  flushAtlas(layers, srgb);
+}
+
+// 채워둔 아틀라스 레이어들로 페이지 하나를 만들고 레이어들을 비움
+void TexturePacker::flushAtlas(std::vector<std::vector<uint8_t> > &layers, bool srgb)
+{
+  if (layers.empty())
+    return;
+
+  std::vector<const uint8_t *> layerPixels;
+  for (size_t l = 0; l < layers.size(); l++)
+  {
+    layerPixels.push_back(&layers[l][0]);
+  }
+  createPage(atlasSize, atlasSize, true, srgb, layerPixels, MIP_FILTER_BOX);
+  layers.clear();
+}
+
+// 레이어들의 픽셀 데이터와 밉맵으로 텍스쳐 배열 하나를 만들어 pages 에 추가
+void TexturePacker::createPage(int width, int height, bool atlas, bool srgb, const std::vector<const uint8_t *> &layers, MipFilter filter)
+{
+  TexturePage page;
+  page.width = width;
+  page.height = height;
+  page.layers = (int)layers.size();
+  page.atlas = atlas;
+  page.srgb = srgb;
+
+  // 아틀라스는 이웃한 텍스쳐가 섞이기 전의 레벨까지만 사용
+  page.levels = Texture::mipLevelCount(width, height);
+  if (atlas)
+    page.levels = std::min(page.levels, log2Floor(gutter) + 1);
+
+  GLenum internalFormat = srgb ? GL_SRGB8_ALPHA8 : GL_RGBA8;
+  page.ID = TextureHandle::generate();
+  glBindTexture(GL_TEXTURE_2D_ARRAY, page.ID.get());
+  glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+
+  // 모든 레이어와 레벨을 한 번에 할당 (4.2 미만에서는 레벨마다 glTexImage3D() 로 대체)
+  if (GLAD_GL_VERSION_4_2)
+  {
+    glTexStorage3D(GL_TEXTURE_2D_ARRAY, page.levels, internalFormat, width, height, page.layers);
+  }
+  else
+  {
+    for (int level = 0; level < page.levels; level++)
+    {
+      glTexImage3D(GL_TEXTURE_2D_ARRAY, level, internalFormat, std::max(width >> level, 1), std::max(height >> level, 1), page.layers, 0,
+                   GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    }
+  }
+
+  // 레이어마다 밉맵을 CPU 에서 만들어 레벨마다 업로드 (텍스쳐 배열은 레이어별 glGenerateMipmap() 이 불가능함)
+  for (int layer = 0; layer < page.layers; layer++)
+  {
+    glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, layer, width, height, 1, GL_RGBA, GL_UNSIGNED_BYTE, layers[layer]);
+
+    std::vector<MipLevel> mipmaps;
+    if (page.levels > 1)
+      generateMipmaps(layers[layer], width, height, 4, srgb, filter, mipmaps);
+    for (int level = 1; level < page.levels; level++)
+    {
+      const MipLevel &mip = mipmaps[level - 1];
+      glTexSubImage3D(GL_TEXTURE_2D_ARRAY, level, 0, 0, layer, mip.width, mip.height, 1, GL_RGBA, GL_UNSIGNED_BYTE, &mip.pixels[0]);
+    }
+  }
+
+  GLint wrap = atlas ? GL_CLAMP_TO_EDGE : GL_REPEAT; // 아틀라스의 반복은 쉐이더에서 fract() 로 처리함
+  glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAX_LEVEL, page.levels - 1);
+  glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, wrap);
+  glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, wrap);
+  glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, page.levels > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+  glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+  glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+
+  pages.push_back(std::move(page));
+}
+
+// 머티리얼 개수
+int TexturePacker::materialCount() const
+{
+  return (int)inputs.size();
+}
+
+// 머티리얼의 페이지, 레이어, uv 영역
+const MaterialPlacement &TexturePacker::placement(int material) const
+{
+  return placements[material];
+}
+
+// 이름으로 머티리얼 번호 찾기
+int TexturePacker::find(const std::string &name) const
+{
+  for (size_t i = 0; i < inputs.size(); i++)
+  {
+    if (inputs[i].name == name)
+      return (int)i;
+  }
+  return -1;
+}
+
+// 페이지 개수
+int TexturePacker::pageCount() const
+{
+  return (int)pages.size();
+}
+
+// 페이지
+const TexturePage &TexturePacker::page(int index) const
+{
+  return pages[index];
+}
+
+// 페이지를 지정한 텍스쳐 유닛에 바인딩
+void TexturePacker::bindPage(int index, unsigned int unit) const
+{
+  glActiveTexture(GL_TEXTURE0 + unit);
+  glBindTexture(GL_TEXTURE_2D_ARRAY, pages[index].ID.get());
+}
+
+// Materials 블록 채우기
+void TexturePacker::fillMaterials(MaterialsBlock &out) const
+{
+  int count = std::min((int)placements.size(), MAX_MATERIAL_SLOTS);
+  if ((int)placements.size() > MAX_MATERIAL_SLOTS)
+  {
+    std::cout << "ERROR::TEXTURE_PACKER::TOO_MANY_MATERIALS: " << placements.size() << " > " << MAX_MATERIAL_SLOTS << std::endl;
+  }
+
+  for (int i = 0; i < count; i++)
+  {
+    const MaterialPlacement &placement = placements[i];
+    out.slots[i].uvRect = glm::vec4(placement.uvRect[0], placement.uvRect[1], placement.uvRect[2], placement.uvRect[3]);
+    out.slots[i].layer = glm::vec4((float)placement.layer, 0.0f, 0.0f, 0.0f);
+  }
+}
+
+// 페이지 수, 레이어 수, 아틀라스 사용률 출력
+void TexturePacker::report() const
+{
+  int layers = 0;
+  size_t atlasTexels = 0;
+  for (size_t i = 0; i < pages.size(); i++)
+  {
+    layers += pages[i].layers;
+    if (pages[i].atlas)
+      atlasTexels += (size_t)pages[i].width * pages[i].height * pages[i].layers;
+  }
+
+  std::cout << "TEXTURE_PACKER: " << inputs.size() << " materials in " << pages.size() << " pages (" << layers << " layers)";
+  if (atlasTexels > 0)
+    std::cout << ", atlas usage " << 100.0 * atlasUsedTexels / atlasTexels << "%";
+  std::cout << std::endl;
+}
@@ -0,0 +1,435 @@
+#include "texture/texture_streamer.hpp"
+#include "asset/asset_pack.hpp"
+#include "gl/gl_handle.hpp"
+#include "texture/dds.hpp"
+#include "texture/texture.hpp"
+
+#include <algorithm> // std::sort
+#include <chrono>    // 업로드 시간 측정
+#include <fstream>   // 파일 입출력을 위한 헤더
+#include <iostream>  // 콘솔 입출력을 위한 헤더
+
+// 동시에 읽기를 요청해둘 수 있는 최대 레벨 수 (너무 많이 요청해두면 우선순위가 바뀌어도 반영되지 않음)
+static const size_t MAX_PENDING_JOBS = 4;
+
+// 텍스쳐 하나의 스트리밍 상태 (I/O 스레드는 path, image, dataOffset 만 읽음)
+struct StreamedTexture::Entry
+{
+  std::string path;
+  DdsImage image;        // 헤더만 해석한 이미지 (에셋 팩 안의 파일이라면 image.view 가 팩의 블록 데이터를 가리킴)
+  size_t dataOffset;     // 파일 안에서 블록 데이터의 시작 위치
+  GLenum internalFormat; // 압축 포맷
+  TextureHandle texture;
+
+  int residentLevel;           // GPU 에 올라와 있는 가장 세밀한 레벨 (이 레벨부터 마지막 레벨까지 올라와 있음)
+  int tailLevel;               // 항상 올려두는 레벨의 시작 (내려놓지 않음)
+  int wantedLevel;             // 화면에 보이는 크기에 필요한 레벨
+  float screenPixels;          // 이번 프레임에 화면에서 차지하는 가장 큰 크기 (픽셀)
+  unsigned long lastUsedFrame; // 마지막으로 use() 된 프레임 번호 (0 이면 사용된 적 없음)
+  size_t residentBytes;        // 올라와 있는 레벨들의 크기 합
+  bool loading;                // I/O 스레드에서 레벨을 읽는 중인지 여부
+  bool failed;                 // 레벨을 읽는 데 실패했다면 더 이상 스트리밍하지 않음
+
+  Entry()
+      : dataOffset(0), internalFormat(GL_NONE), residentLevel(0), tailLevel(0), wantedLevel(0), screenPixels(0.0f),
+        lastUsedFrame(0), residentBytes(0), loading(false), failed(false)
+  {
+  }
+
+  // first ~ last 레벨의 압축된 블록 데이터를 out 에 읽기 (레벨들은 파일 안에 연속으로 저장되어 있으므로 한 번에 읽음)
+  bool readLevels(int first, int last, std::string &out) const
+  {
+    const DdsLevel &firstLevel = image.levels[first];
+    const DdsLevel &lastLevel = image.levels[last];
+    size_t size = lastLevel.offset + lastLevel.size - firstLevel.offset;
+
+    // 에셋 팩 안의 파일이라면 매핑된 메모리에서 복사 (페이지 폴트로 인한 디스크 읽기도 I/O 스레드에서 일어남)
+    if (image.view)
+    {
+      out.assign(image.view + firstLevel.offset, size);
+      return true;
+    }
+
+    std::ifstream file(path.c_str(), std::ios::binary);
+    out.resize(size);
+    return file.seekg((std::streamoff)(dataOffset + firstLevel.offset)) && file.read(&out[0], (std::streamsize)size);
+  }
+};
+
+// 두 시점 사이의 경과 시간 (ms)
+static double durationMs(std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end)
+{
+  return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+/** StreamedTexture 구현부 */
+
+StreamedTexture::StreamedTexture()
+{
+}
+
+// 스트리밍할 수 있는 텍스쳐인지 여부
+bool StreamedTexture::valid() const
+{
+  return entry != nullptr;
+}
+
+// 바인딩할 텍스쳐 객체
+GLuint StreamedTexture::get() const
+{
+  return entry ? entry->texture.get() : 0;
+}
+
+// GPU 에 올라와 있는 가장 세밀한 밉맵 레벨
+int StreamedTexture::residentLevel() const
+{
+  return entry ? entry->residentLevel : 0;
+}
+
+// 전체 밉맵 레벨 개수
+int StreamedTexture::levelCount() const
+{
+  return entry ? (int)entry->image.levels.size() : 0;
+}
+
+/** TextureStreamer 구현부 */
+
+// TextureStreamer 클래스 생성자
+TextureStreamer::TextureStreamer(size_t budgetBytes, int tailSize)
+    : budget(budgetBytes), tailSize(tailSize), frame(1), resident(0), reserved(0), streamedLevels(0), evictedLevels(0),
+      stopping(false)
+{
+  ioThread = std::thread(&TextureStreamer::run, this);
+}
+
+// TextureStreamer 클래스 소멸자
+TextureStreamer::~TextureStreamer()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    stopping = true;
+    jobs.clear();
+  }
+  wakeUp.notify_all();
+  ioThread.join();
+}
+
+// DDS 텍스쳐를 열고 작은 레벨들만 곧바로 업로드
+StreamedTexture TextureStreamer::open(const std::string &path)
+{
+  StreamedTexture texture;
+  std::shared_ptr<StreamedTexture::Entry> entry = std::make_shared<StreamedTexture::Entry>();
+  entry->path = path;
+
+  // 헤더만 해석 (에셋 팩 안의 파일이라면 매핑된 메모리에서, 아니라면 파일 앞부분만 읽음)
+  const char *data;
+  size_t size;
+  bool parsed = AssetPack::shared().find(path, data, size) ? parseDdsView(data, size, entry->image)
+                                                            : readDdsHeader(path, entry->image, entry->dataOffset);
+  if (!parsed)
+    return texture;
+
+  entry->internalFormat = Texture::compressedFormat(entry->image.format, entry->image.srgb);
+  if (!Texture::isCompressedFormatSupported(entry->internalFormat))
+  {
+    std::cout << "ERROR::TEXTURE_STREAMER::UNSUPPORTED_COMPRESSED_FORMAT: " << path << std::endl;
+    return texture;
+  }
+
+  // tailSize 이하 크기의 레벨들은 작으므로 (64x64 이하의 BC7 레벨들을 모두 합쳐도 6KB 정도) 지금 곧바로 읽어서 올림
+  const std::vector<DdsLevel> &levels = entry->image.levels;
+  int lastLevel = (int)levels.size() - 1;
+  int tailLevel = lastLevel;
+  while (tailLevel > 0 && std::max(levels[tailLevel - 1].width, levels[tailLevel - 1].height) <= tailSize)
+  {
+    tailLevel--;
+  }
+
+  std::string tail;
+  if (!entry->readLevels(tailLevel, lastLevel, tail))
+  {
+    std::cout << "ERROR::TEXTURE_STREAMER::FILE_NOT_SUCCESSFULLY_READ: " << path << std::endl;
+    return texture;
+  }
+
+  entry->texture = TextureHandle::generate();
+  glBindTexture(GL_TEXTURE_2D, entry->texture.get());
+  for (int level = tailLevel; level <= lastLevel; level++)
+  {
+    const DdsLevel &entryLevel = levels[level];
+    glCompressedTexImage2D(GL_TEXTURE_2D, level, entry->internalFormat, entryLevel.width, entryLevel.height, 0, (GLsizei)entryLevel.size,
+                           tail.data() + (entryLevel.offset - levels[tailLevel].offset));
+  }
+
+  // 올라와 있는 레벨들만 샘플링하도록 범위를 제한 (범위 밖의 비어있는 레벨들은 완전성 검사에서 제외됨)
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, tailLevel);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, lastLevel);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, lastLevel > 0 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+  glBindTexture(GL_TEXTURE_2D, 0);
+
+  entry->residentLevel = tailLevel;
+  entry->tailLevel = tailLevel;
+  entry->wantedLevel = tailLevel;
+  entry->residentBytes = tail.size();
+  resident += tail.size();
+
+  entries.push_back(entry);
+  texture.entry = entry;
+  return texture;
+}
+
+// 이번 프레임에 텍스쳐를 screenPixels 크기로 그린다고 알리고, 바인딩할 텍스쳐 객체 반환
+GLuint TextureStreamer::use(const StreamedTexture &texture, float screenPixels)
+{
+  if (!texture.entry)
+    return 0;
+
+  StreamedTexture::Entry &entry = *texture.entry;
+  if (entry.lastUsedFrame != frame)
+  {
+    entry.screenPixels = 0.0f;
+    entry.wantedLevel = entry.tailLevel;
+  }
+  entry.lastUsedFrame = frame;
+
+  // 같은 프레임에 여러 번 그린다면 가장 크게 보이는 크기를 기준으로 함
+  if (screenPixels > entry.screenPixels)
+  {
+    entry.screenPixels = screenPixels;
+
+    // 레벨 크기가 화면 크기보다 작아지기 직전의 레벨 (텍셀 하나가 픽셀 하나 이상을 덮는 가장 흐린 레벨)
+    int level = entry.tailLevel;
+    while (level > 0 && std::max(entry.image.levels[level].width, entry.image.levels[level].height) < screenPixels)
+    {
+      level--;
+    }
+    entry.wantedLevel = level;
+  }
+  return entry.texture.get();
+}
+
+// 매 프레임마다 호출하여 읽기가 끝난 레벨을 업로드하고, 다음에 읽을 레벨들을 요청
+void TextureStreamer::update(double budgetMs)
+{
+  /**
+   * 업로드는 GL 스레드를 막으므로 프레임당 시간 예산 안에서만 처리함.
+   * (한 레벨의 업로드가 예산을 넘길 수는 있지만, 적어도 한 레벨은 매 프레임 업로드되도록 보장함)
+   */
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  while (true)
+  {
+    std::shared_ptr<Job> job;
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      if (completed.empty())
+        break;
+      job = completed.front();
+      completed.pop_front();
+    }
+
+    upload(*job);
+
+    if (durationMs(start, std::chrono::steady_clock::now()) >= budgetMs)
+      break;
+  }
+
+  // 핸들이 모두 사라진 텍스쳐는 목록에서 제거 (텍스쳐 객체는 삭제 큐를 통해 삭제됨)
+  for (size_t i = 0; i < entries.size();)
+  {
+    if (entries[i].use_count() == 1 && !entries[i]->loading)
+    {
+      resident -= entries[i]->residentBytes;
+      entries[i] = entries.back();
+      entries.pop_back();
+    }
+    else
+      i++;
+  }
+
+  // 예산이 줄어들었다면 넘친 만큼 내려놓은 뒤, 부족한 레벨들을 요청
+  makeRoom(0, nullptr);
+  schedule();
+
+  frame++;
+}
+
+// GPU 에 올라와 있는 밉맵 레벨들의 크기 합
+size_t TextureStreamer::residentBytes() const
+{
+  return resident;
+}
+
+// GPU 메모리 예산 변경
+void TextureStreamer::setBudget(size_t budgetBytes)
+{
+  budget = budgetBytes;
+}
+
+// 스트리밍 및 내려놓은 레벨 수, 메모리 사용량 출력
+void TextureStreamer::report() const
+{
+  std::cout << "TEXTURE_STREAMER: " << entries.size() << " textures, " << resident / (1024.0 * 1024.0) << " / "
+            << budget / (1024.0 * 1024.0) << " MB resident, " << streamedLevels << " levels streamed, " << evictedLevels
+            << " levels evicted" << std::endl;
+}
+
+// I/O 스레드 루프
+void TextureStreamer::run()
+{
+  while (true)
+  {
+    std::shared_ptr<Job> job;
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      while (!stopping && jobs.empty())
+      {
+        wakeUp.wait(lock);
+      }
+      if (stopping)
+        return;
+      job = jobs.front();
+      jobs.pop_front();
+    }
+
+    job->ok = job->entry->readLevels(job->level, job->level, job->bytes);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    completed.push_back(job);
+  }
+}
+
+// 읽기가 끝난 레벨 하나를 업로드하고 GL_TEXTURE_BASE_LEVEL 을 낮춤
+void TextureStreamer::upload(Job &job)
+{
+  StreamedTexture::Entry &entry = *job.entry;
+  const DdsLevel &level = entry.image.levels[job.level];
+  reserved -= level.size;
+  entry.loading = false;
+
+  if (!job.ok)
+  {
+    std::cout << "ERROR::TEXTURE_STREAMER::LEVEL_NOT_SUCCESSFULLY_READ: " << entry.path << " (level " << job.level << ")" << std::endl;
+    entry.failed = true;
+    return;
+  }
+
+  /**
+   * 레벨을 다 채운 뒤에 GL_TEXTURE_BASE_LEVEL 을 낮춰야 함.
+   * (먼저 낮추면 비어있는 레벨이 샘플링 범위에 들어가서 텍스쳐가 불완전(incomplete)해지고 검은색으로 그려짐)
+   *
+   * 읽는 중인 텍스쳐는 내려놓지 않으므로, 이 레벨은 항상 residentLevel 바로 위의 레벨임.
+   */
+  glBindTexture(GL_TEXTURE_2D, entry.texture.get());
+  glCompressedTexImage2D(GL_TEXTURE_2D, job.level, entry.internalFormat, level.width, level.height, 0, (GLsizei)level.size,
+                         job.bytes.data());
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, job.level);
+  glBindTexture(GL_TEXTURE_2D, 0);
+
+  entry.residentLevel = job.level;
+  entry.residentBytes += level.size;
+  resident += level.size;
+  streamedLevels++;
+}
+
+// 화면 크기에 비해 부족한 레벨을 우선순위 순서대로 I/O 스레드에 요청
+void TextureStreamer::schedule()
+{
+  size_t inFlight = 0;
+  std::vector<std::shared_ptr<StreamedTexture::Entry> > candidates;
+  for (size_t i = 0; i < entries.size(); i++)
+  {
+    const StreamedTexture::Entry &entry = *entries[i];
+    if (entry.loading)
+      inFlight++;
+    else if (!entry.failed && entry.lastUsedFrame == frame && entry.residentLevel > entry.wantedLevel)
+      candidates.push_back(entries[i]);
+  }
+
+  // 화면에 크게 보이는 텍스쳐일수록 흐린 레벨이 눈에 잘 띄므로 먼저 요청
+  std::sort(candidates.begin(), candidates.end(),
+            [](const std::shared_ptr<StreamedTexture::Entry> &a, const std::shared_ptr<StreamedTexture::Entry> &b)
+            { return a->screenPixels > b->screenPixels; });
+
+  std::vector<std::shared_ptr<Job> > scheduled;
+  for (size_t i = 0; i < candidates.size() && inFlight < MAX_PENDING_JOBS; i++)
+  {
+    StreamedTexture::Entry *entry = candidates[i].get();
+
+    // 레벨들은 이어져 있어야 하므로, 올라와 있는 레벨 바로 위의 레벨 하나만 요청
+    int level = entry->residentLevel - 1;
+    size_t size = entry->image.levels[level].size;
+    if (!makeRoom(size, entry))
+      continue; // 예산 안에 넣을 수 없다면 지금의 흐린 레벨로 계속 그림
+
+    std::shared_ptr<Job> job = std::make_shared<Job>();
+    job->entry = candidates[i];
+    job->level = level;
+    job->ok = false;
+
+    entry->loading = true;
+    reserved += size;
+    inFlight++;
+    scheduled.push_back(job);
+  }
+
+  if (scheduled.empty())
+    return;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    jobs.insert(jobs.end(), scheduled.begin(), scheduled.end());
+  }
+  wakeUp.notify_one();
+}
+
+// bytes 만큼의 예산이 생길 때까지 LRU 순서로 레벨을 내려놓음
+bool TextureStreamer::makeRoom(size_t bytes, const StreamedTexture::Entry *keep)
+{
+  while (resident + reserved + bytes > budget)
+  {
+    /**
+     * 내려놓을 수 있는 레벨 :
+     * - 이번 프레임에 사용되지 않은 텍스쳐의 레벨
+     * - 사용되었더라도 화면 크기에 필요한 것보다 세밀한 레벨
+     *
+     * 그 중 가장 오래 전에 사용된 텍스쳐부터 내려놓고, 같다면 더 큰 레벨을 가진 텍스쳐부터 내려놓음
+     */
+    StreamedTexture::Entry *victim = nullptr;
+    for (size_t i = 0; i < entries.size(); i++)
+    {
+      StreamedTexture::Entry *entry = entries[i].get();
+      if (entry == keep || entry->loading || entry->residentLevel >= entry->tailLevel)
+        continue;
+      if (entry->lastUsedFrame == frame && entry->residentLevel >= entry->wantedLevel)
+        continue;
+      if (!victim || entry->lastUsedFrame < victim->lastUsedFrame ||
+          (entry->lastUsedFrame == victim->lastUsedFrame && entry->residentLevel < victim->residentLevel))
+        victim = entry;
+    }
+    if (!victim)
+      return false;
+
+    evict(*victim);
+  }
+  return true;
+}
+
+// 텍스쳐의 가장 세밀한 레벨 하나를 내려놓음
+void TextureStreamer::evict(StreamedTexture::Entry &entry)
+{
+  int level = entry.residentLevel;
+  const DdsLevel &evicted = entry.image.levels[level];
+
+  // 샘플링 범위에서 먼저 제외한 뒤, 크기 0 으로 다시 지정하여 드라이버가 레벨의 메모리를 해제하도록 함
+  glBindTexture(GL_TEXTURE_2D, entry.texture.get());
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, level + 1);
+  glCompressedTexImage2D(GL_TEXTURE_2D, level, entry.internalFormat, 0, 0, 0, 0, nullptr);
+  glBindTexture(GL_TEXTURE_2D, 0);
+
+  entry.residentLevel = level + 1;
+  entry.residentBytes -= evicted.size;
+  resident -= evicted.size;
+  evictedLevels++;
+}
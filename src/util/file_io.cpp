@@ -0,0 +1,292 @@
+#include "util/file_io.hpp"
+
+#include <sys/types.h> // off_t
+#include <sys/stat.h>  // stat, fstat
+
+#ifdef _WIN32
+#include <cerrno>       // errno, EEXIST
+#include <cstdio>       // std::fopen, std::fread
+#include <direct.h>     // _mkdir, _rmdir
+#include <sys/utime.h>  // _utime
+#include <windows.h>    // CreateFileMapping, MapViewOfFile, MoveFileEx, FindFirstFile
+#else
+#include <fcntl.h>    // open
+#include <unistd.h>   // read, close, rmdir
+#include <cerrno>     // errno, EINTR, EEXIST
+#include <cstdio>     // std::rename
+#include <dirent.h>   // opendir, readdir
+#include <sys/mman.h> // mmap, munmap
+#include <utime.h>    // utime
+#endif
+
+// 파일 내용 전체를 out 에 읽기
+bool readWholeFile(const std::string &path, std::string &out)
+{
+#ifdef _WIN32
+  FILE *file = std::fopen(path.c_str(), "rb");
+  if (!file)
+    return false;
+
+  struct _stat64 info;
+  if (_fstat64(_fileno(file), &info) != 0)
+  {
+    std::fclose(file);
+    return false;
+  }
+
+  out.resize((size_t)info.st_size);
+  size_t total = out.empty() ? 0 : std::fread(&out[0], 1, out.size(), file);
+  std::fclose(file);
+  out.resize(total);
+  return total == (size_t)info.st_size;
+#else
+  int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0)
+    return false;
+
+  // 파일 크기만큼 한 번에 할당
+  struct stat info;
+  if (::fstat(fd, &info) != 0 || !S_ISREG(info.st_mode))
+  {
+    ::close(fd);
+    return false;
+  }
+  out.resize((size_t)info.st_size);
+
+  // 보통은 read() 한 번에 끝나지만, 시그널 등으로 중간에 끊기는 경우를 대비해 반복
+  size_t total = 0;
+  while (total < out.size())
+  {
+    ssize_t count = ::read(fd, &out[total], out.size() - total);
+    if (count < 0 && errno == EINTR)
+      continue;
+    if (count <= 0)
+      break;
+    total += (size_t)count;
+  }
+  ::close(fd);
+
+  // 읽는 도중 파일이 잘렸다면 실제로 읽은 만큼만 남김
+  out.resize(total);
+  return total == (size_t)info.st_size;
+#endif
+}
+
+// 파일(디렉토리 제외)이 존재하는지 여부
+bool fileExists(const std::string &path)
+{
+#ifdef _WIN32
+  struct _stat64 info;
+  return _stat64(path.c_str(), &info) == 0 && (info.st_mode & _S_IFREG) != 0;
+#else
+  struct stat info;
+  return ::stat(path.c_str(), &info) == 0 && S_ISREG(info.st_mode);
+#endif
+}
+
+// 파일의 크기와 마지막 수정 시각 조회
+bool fileStamp(const std::string &path, FileStamp &out)
+{
+#ifdef _WIN32
+  struct _stat64 info;
+  if (_stat64(path.c_str(), &info) != 0 || (info.st_mode & _S_IFREG) == 0)
+    return false;
+#else
+  struct stat info;
+  if (::stat(path.c_str(), &info) != 0 || !S_ISREG(info.st_mode))
+    return false;
+#endif
+  out.size = (uint64_t)info.st_size;
+  out.modified = (int64_t)info.st_mtime;
+  return true;
+}
+
+// 마지막 수정 시각을 현재 시각으로 갱신
+bool touchFile(const std::string &path)
+{
+#ifdef _WIN32
+  return _utime(path.c_str(), nullptr) == 0;
+#else
+  return ::utime(path.c_str(), nullptr) == 0;
+#endif
+}
+
+// from 파일을 to 로 원자적으로 교체
+bool replaceFile(const std::string &from, const std::string &to)
+{
+#ifdef _WIN32
+  // std::rename 은 대상이 이미 있으면 실패하므로 덮어쓰기를 허용하는 MoveFileEx 사용
+  return MoveFileExA(from.c_str(), to.c_str(), MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+  // 같은 파일 시스템 안에서의 rename() 은 원자적이므로, 다른 프로세스는 이전 파일이나 새 파일 중 하나만 보게 됨
+  return std::rename(from.c_str(), to.c_str()) == 0;
+#endif
+}
+
+// 디렉토리 생성
+bool makeDirectory(const std::string &path)
+{
+#ifdef _WIN32
+  if (_mkdir(path.c_str()) == 0 || errno == EEXIST)
+    return true;
+#else
+  if (::mkdir(path.c_str(), 0755) == 0 || errno == EEXIST)
+    return true;
+#endif
+  return false;
+}
+
+// 빈 디렉토리 삭제
+bool removeDirectory(const std::string &path)
+{
+#ifdef _WIN32
+  return _rmdir(path.c_str()) == 0;
+#else
+  return ::rmdir(path.c_str()) == 0;
+#endif
+}
+
+// 디렉토리 안의 파일 이름 목록
+bool listFiles(const std::string &directory, std::vector<std::string> &out)
+{
+  out.clear();
+#ifdef _WIN32
+  WIN32_FIND_DATAA entry;
+  HANDLE find = FindFirstFileA((directory + "\\*").c_str(), &entry);
+  if (find == INVALID_HANDLE_VALUE)
+    return false;
+  do
+  {
+    if ((entry.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) == 0)
+      out.push_back(entry.cFileName);
+  } while (FindNextFileA(find, &entry));
+  FindClose(find);
+  return true;
+#else
+  DIR *dir = ::opendir(directory.c_str());
+  if (!dir)
+    return false;
+  while (struct dirent *entry = ::readdir(dir))
+  {
+    std::string name = entry->d_name;
+    if (name == "." || name == "..")
+      continue;
+
+    // d_type 을 알려주지 않는 파일 시스템도 있으므로 stat 으로 확인
+    if (fileExists(directory + "/" + name))
+      out.push_back(name);
+  }
+  ::closedir(dir);
+  return true;
+#endif
+}
+
+/** MappedFile 구현부 */
+
+// MappedFile 클래스 생성자
+MappedFile::MappedFile()
+    : address(nullptr), length(0)
+#ifdef _WIN32
+      ,
+      fileHandle(nullptr), mappingHandle(nullptr)
+#endif
+{
+}
+
+// MappedFile 클래스 소멸자
+MappedFile::~MappedFile()
+{
+  close();
+}
+
+// 파일을 읽기 전용으로 매핑
+bool MappedFile::open(const std::string &path)
+{
+  close();
+
+#ifdef _WIN32
+  HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+  if (file == INVALID_HANDLE_VALUE)
+    return false;
+
+  LARGE_INTEGER fileSize;
+  if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0)
+  {
+    CloseHandle(file);
+    return false;
+  }
+
+  HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+  void *view = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : NULL;
+  if (!view)
+  {
+    if (mapping)
+      CloseHandle(mapping);
+    CloseHandle(file);
+    return false;
+  }
+
+  fileHandle = file;
+  mappingHandle = mapping;
+  address = static_cast<const char *>(view);
+  length = (size_t)fileSize.QuadPart;
+  return true;
+#else
+  int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0)
+    return false;
+
+  // 크기가 0 인 파일은 매핑할 수 없음
+  struct stat info;
+  if (::fstat(fd, &info) != 0 || !S_ISREG(info.st_mode) || info.st_size == 0)
+  {
+    ::close(fd);
+    return false;
+  }
+
+  void *view = ::mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+  // 매핑이 끝나면 파일 디스크립터는 닫아도 매핑은 유지됨
+  ::close(fd);
+  if (view == MAP_FAILED)
+    return false;
+
+  address = static_cast<const char *>(view);
+  length = (size_t)info.st_size;
+  return true;
+#endif
+}
+
+// 매핑 해제
+void MappedFile::close()
+{
+  if (!address)
+    return;
+
+#ifdef _WIN32
+  UnmapViewOfFile(address);
+  CloseHandle((HANDLE)mappingHandle);
+  CloseHandle((HANDLE)fileHandle);
+  mappingHandle = nullptr;
+  fileHandle = nullptr;
+#else
+  ::munmap(const_cast<char *>(address), length);
+#endif
+  address = nullptr;
+  length = 0;
+}
+
+bool MappedFile::isOpen() const
+{
+  return address != nullptr;
+}
+
+const char *MappedFile::data() const
+{
+  return address;
+}
+
+size_t MappedFile::size() const
+{
+  return length;
+}
@@ -0,0 +1,49 @@
+/*
+  빌드 시점 에셋 팩 생성 도구
+
+  CMake 의 ASSET_PACK 옵션을 켜면 빌드 과정에서 실행되며,
+  (가공된) 쉐이더와 텍스쳐 파일들을 하나의 팩 파일로 묶음. (팩 파일 구조는 asset/asset_pack.hpp 참고)
+
+  사용 방법 :
+    asset_pack <출력.pack> <팩 안의 경로>=<파일 경로>...
+
+  런타임은 팩 안의 경로로 에셋을 찾으므로, 디스크의 실제 위치와 상관없이 같은 이름으로 조회할 수 있음.
+  (예 : shaders/debugging.vs=build/shaders/debugging.vs)
+*/
+
+#include "asset/asset_pack.hpp"
+
+#include <iostream> // 콘솔 입출력을 위한 헤더
+#include <string>   // std::string
+#include <vector>   // std::vector
+
+// 사용 방법 출력
+static int printUsage()
+{
+  std::cout << "usage: asset_pack <output.pack> <pack path>=<file>..." << std::endl;
+  return 1;
+}
+
+int main(int argc, char **argv)
+{
+  if (argc < 3)
+    return printUsage();
+
+  std::vector<std::pair<std::string, std::string> > files;
+  for (int i = 2; i < argc; i++)
+  {
+    std::string arg = argv[i];
+    size_t separator = arg.find('=');
+    if (separator == std::string::npos || separator == 0 || separator + 1 == arg.size())
+      return printUsage();
+    files.push_back(std::make_pair(arg.substr(0, separator), arg.substr(separator + 1)));
+  }
+
+  if (!AssetPack::write(argv[1], files))
+  {
+    std::cout << "ERROR::ASSET_PACK::FILE_NOT_SUCCESSFULLY_WRITTEN: " << argv[1] << std::endl;
+    return 1;
+  }
+  std::cout << "ASSET_PACK: " << files.size() << " assets -> " << argv[1] << std::endl;
+  return 0;
+}
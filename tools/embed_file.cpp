@@ -0,0 +1,105 @@
+/*
+  빌드 시점 파일 포함 도구
+
+  CMake 의 EMBED_RESOURCES 옵션을 켜면 빌드 과정에서 실행되며,
+  파일 하나(에셋 팩)를 64 바이트 경계에 정렬된 상수 배열로 정의하는 C++ 소스 파일을 생성함.
+
+  사용 방법 :
+    embed_file <입력 파일> <출력.cpp> <심볼 이름>
+
+  생성된 소스는 <심볼 이름>[] 배열과 <심볼 이름>_SIZE 를 정의함.
+  C23 / C++26 의 #embed 를 지원하는 컴파일러라면 바이트 목록 대신 #embed 로 파일을 직접 포함하므로 컴파일이 훨씬 빠름.
+  (지원하지 않는 컴파일러는 아래에 함께 생성된 16 진수 바이트 목록을 사용함)
+*/
+
+#include "util/file_io.hpp"
+
+#include <fstream>  // 파일 입출력을 위한 헤더
+#include <iostream> // 콘솔 입출력을 위한 헤더
+#include <string>   // std::string
+
+// 사용 방법 출력
+static int printUsage()
+{
+  std::cout << "usage: embed_file <input> <output.cpp> <symbol>" << std::endl;
+  return 1;
+}
+
+// #embed 에 넘길 수 있도록 경로의 역슬래시와 따옴표를 이스케이프
+static std::string escapePath(const std::string &path)
+{
+  std::string out;
+  for (size_t i = 0; i < path.size(); i++)
+  {
+    if (path[i] == '\\' || path[i] == '"')
+      out += '\\';
+    out += path[i];
+  }
+  return out;
+}
+
+int main(int argc, char **argv)
+{
+  if (argc != 4)
+    return printUsage();
+
+  std::string input = argv[1];
+  std::string symbol = argv[3];
+
+  std::string contents;
+  if (!readWholeFile(input, contents) || contents.empty())
+  {
+    std::cout << "ERROR::EMBED_FILE::FILE_NOT_SUCCESSFULLY_READ: " << input << std::endl;
+    return 1;
+  }
+
+  // 16 진수 바이트 목록 (한 줄에 16 바이트)
+  static const char HEX_DIGITS[] = "0123456789abcdef";
+  std::string bytes;
+  bytes.reserve(contents.size() * 6 + contents.size() / 16 * 3);
+  for (size_t i = 0; i < contents.size(); i++)
+  {
+    unsigned char value = (unsigned char)contents[i];
+    bytes += i % 16 == 0 ? "  " : " ";
+    bytes += "0x";
+    bytes += HEX_DIGITS[value >> 4];
+    bytes += HEX_DIGITS[value & 15];
+    bytes += ',';
+    if (i % 16 == 15)
+      bytes += '\n';
+  }
+  if (contents.size() % 16 != 0)
+    bytes += '\n';
+
+  std::string escaped = escapePath(input);
+  std::string source;
+  source += "// tools/embed_file.cpp 가 " + input + " 로부터 생성한 파일 (직접 수정하지 말 것)\n";
+  source += "#include <cstddef>\n\n";
+  source += "extern const unsigned char " + symbol + "[];\n";
+  source += "extern const size_t " + symbol + "_SIZE;\n\n";
+  // 배열 끝에는 0 을 하나 덧붙여둠 (크기에는 포함하지 않음)
+  source += "alignas(64) const unsigned char " + symbol + "[] = {\n";
+  source += "#if defined(__has_embed)\n";
+  source += "#if __has_embed(\"" + escaped + "\")\n";
+  source += "#define EMBED_FILE_USE_EMBED\n";
+  source += "#endif\n";
+  source += "#endif\n";
+  source += "#ifdef EMBED_FILE_USE_EMBED\n";
+  source += "#embed \"" + escaped + "\"\n";
+  source += "  ,\n";
+  source += "#else\n";
+  source += bytes;
+  source += "#endif\n";
+  source += "  0};\n\n";
+  source += "const size_t " + symbol + "_SIZE = " + std::to_string(contents.size()) + ";\n";
+
+  std::ofstream out(argv[2], std::ios::binary);
+  out.write(source.data(), (std::streamsize)source.size());
+  if (!out.good())
+  {
+    std::cout << "ERROR::EMBED_FILE::FILE_NOT_SUCCESSFULLY_WRITTEN: " << argv[2] << std::endl;
+    return 1;
+  }
+  std::cout << "EMBED_FILE: " << contents.size() << " bytes -> " << argv[2] << std::endl;
+  return 0;
+}
@@ -0,0 +1,84 @@
+/*
+  빌드 시점 쉐이더 가공 도구
+
+  CMake 의 SHADER_OFFLINE_BUILD 옵션을 켜면 빌드 과정에서 resources/shaders/ 의 쉐이더마다 실행되며,
+  런타임과 같은 ShaderPreprocessor 로 #include 를 펼쳐서 glslangValidator 에 넘길 코드를 만들거나,
+  주석과 공백을 제거한 코드를 빌드 디렉토리에 출력함. (_cmake/compile_shader.cmake 참고)
+
+  사용 방법 :
+    shader_minify [-I <검색 경로>]... <입력> <출력>              : #include 를 펼친 뒤 minify 하여 출력
+    shader_minify [-I <검색 경로>]... --expand <입력> <출력>     : #include 만 펼쳐서 출력 (#line 지시문 유지)
+    shader_minify [-I <검색 경로>]... --annotate <입력> <로그>   : 로그의 '파일번호:라인' 을 '파일경로:라인' 으로 바꿔서 출력
+
+  --annotate 는 --expand 와 같은 순서로 파일을 읽으므로, --expand 결과를 검증한 로그의 파일번호를 그대로 되돌릴 수 있음.
+*/
+
+#include "shader/shader_preprocessor.hpp"
+#include "util/file_io.hpp"
+
+#include <fstream>  // 파일 입출력을 위한 헤더
+#include <iostream> // 콘솔 입출력을 위한 헤더
+#include <string>   // std::string
+#include <vector>   // std::vector
+
+// 사용 방법 출력
+static int printUsage()
+{
+  std::cout << "usage: shader_minify [-I <dir>]... [--expand | --annotate] <input> <output|log>" << std::endl;
+  return 1;
+}
+
+// code 를 path 에 저장
+static bool writeFile(const std::string &path, const std::string &code)
+{
+  std::ofstream file(path.c_str(), std::ios::binary);
+  file.write(code.data(), (std::streamsize)code.size());
+  return file.good();
+}
+
+int main(int argc, char **argv)
+{
+  ShaderPreprocessor preprocessor;
+  std::string mode;
+  std::vector<std::string> files;
+  for (int i = 1; i < argc; i++)
+  {
+    std::string arg = argv[i];
+    if (arg == "-I" && i + 1 < argc)
+      preprocessor.addSearchPath(argv[++i]);
+    else if (arg == "--expand" || arg == "--annotate")
+      mode = arg;
+    else
+      files.push_back(arg);
+  }
+  if (files.size() != 2)
+    return printUsage();
+
+  // 런타임과 같은 방식으로 #include 를 펼침
+  std::string code = preprocessor.process(files[0]);
+  if (code.empty())
+  {
+    std::cout << "ERROR::SHADER_MINIFY::FILE_NOT_SUCCESSFULLY_READ: " << files[0] << std::endl;
+    return 1;
+  }
+
+  if (mode == "--annotate")
+  {
+    std::string log;
+    if (!readWholeFile(files[1], log))
+    {
+      std::cout << "ERROR::SHADER_MINIFY::FILE_NOT_SUCCESSFULLY_READ: " << files[1] << std::endl;
+      return 1;
+    }
+    std::cout << preprocessor.annotateLog(log) << std::flush;
+    return 0;
+  }
+
+  std::string out = mode == "--expand" ? code : ShaderPreprocessor::minify(code);
+  if (!writeFile(files[1], out))
+  {
+    std::cout << "ERROR::SHADER_MINIFY::FILE_NOT_SUCCESSFULLY_WRITTEN: " << files[1] << std::endl;
+    return 1;
+  }
+  return 0;
+}
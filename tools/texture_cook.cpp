@@ -0,0 +1,131 @@
+/*
+  빌드 시점 텍스쳐 압축 도구
+
+  CMake 의 TEXTURE_COOK 옵션을 켜면 빌드 과정에서 resources/textures/ 의 이미지마다 실행되며,
+  이미지를 디코딩하고 밉맵 체인을 만든 뒤 레벨마다 블록 압축(BC1 / BC3 / BC7)하여 DDS 파일로 출력함.
+  밉맵은 런타임의 TextureLoader 와 같은 CPU 밉맵 생성기(texture/mip_generator.hpp)로 만듦.
+
+  런타임은 디코딩이나 glGenerateMipmap() 없이 압축된 레벨들을 그대로 업로드하므로,
+  로딩 시간과 VRAM 사용량, 샘플링 대역폭이 모두 줄어듬.
+
+  사용 방법 :
+    texture_cook [--format auto|bc1|bc3|bc7] [--filter box|kaiser|lanczos] [--srgb] [--threads N] <입력> <출력.dds>
+
+  --format auto (기본값) 는 알파 채널이 모두 불투명하면 BC1, 그렇지 않으면 BC3 를 선택함.
+  --filter 는 밉맵 축소 필터이며 기본값은 kaiser.
+  --srgb 는 색상 텍스쳐에 지정하며, 밉맵을 선형 공간에서 필터링하고 런타임에서 sRGB 압축 포맷으로 업로드되도록 DDS 에 기록함.
+*/
+
+#define STB_IMAGE_IMPLEMENTATION
+#include <stb_image.h> // 이미지 디코딩
+
+#include "texture/block_compression.hpp"
+#include "texture/dds.hpp"
+#include "texture/mip_generator.hpp"
+
+#include <chrono>   // 압축 시간 측정
+#include <cstdlib>  // std::atoi
+#include <iostream> // 콘솔 입출력을 위한 헤더
+#include <string>   // std::string
+#include <vector>   // std::vector
+
+// 사용 방법 출력
+static int printUsage()
+{
+  std::cout << "usage: texture_cook [--format auto|bc1|bc3|bc7] [--filter box|kaiser|lanczos] [--srgb] [--threads N] <input> <output.dds>"
+            << std::endl;
+  return 1;
+}
+
+// 모든 픽셀의 알파가 255 인지 여부
+static bool isOpaque(const std::vector<uint8_t> &rgba)
+{
+  for (size_t i = 3; i < rgba.size(); i += 4)
+  {
+    if (rgba[i] != 255)
+      return false;
+  }
+  return true;
+}
+
+int main(int argc, char **argv)
+{
+  std::string formatName = "auto";
+  MipFilter filter = MIP_FILTER_KAISER;
+  bool srgb = false;
+  unsigned int threadCount = 0;
+  std::vector<std::string> files;
+  for (int i = 1; i < argc; i++)
+  {
+    std::string arg = argv[i];
+    if (arg == "--format" && i + 1 < argc)
+      formatName = argv[++i];
+    else if (arg == "--filter" && i + 1 < argc)
+    {
+      if (!parseMipFilter(argv[++i], filter))
+        return printUsage();
+    }
+    else if (arg == "--srgb")
+      srgb = true;
+    else if (arg == "--threads" && i + 1 < argc)
+      threadCount = (unsigned int)std::atoi(argv[++i]);
+    else
+      files.push_back(arg);
+  }
+  if (files.size() != 2)
+    return printUsage();
+
+  // 채널 수와 상관없이 RGBA8 로 디코딩 (블록 인코더의 입력 형식)
+  int width, height, channels;
+  stbi_uc *pixels = stbi_load(files[0].c_str(), &width, &height, &channels, 4);
+  if (!pixels)
+  {
+    std::cout << "ERROR::TEXTURE_COOK::FILE_NOT_SUCCESSFULLY_READ: " << files[0] << std::endl;
+    return 1;
+  }
+  std::vector<uint8_t> rgba(pixels, pixels + (size_t)width * height * 4);
+  stbi_image_free(pixels);
+
+  DdsImage image;
+  image.srgb = srgb;
+  image.width = width;
+  image.height = height;
+  if (formatName == "bc1")
+    image.format = BLOCK_FORMAT_BC1;
+  else if (formatName == "bc3")
+    image.format = BLOCK_FORMAT_BC3;
+  else if (formatName == "bc7")
+    image.format = BLOCK_FORMAT_BC7;
+  else if (formatName == "auto")
+    image.format = isOpaque(rgba) ? BLOCK_FORMAT_BC1 : BLOCK_FORMAT_BC3;
+  else
+    return printUsage();
+
+  // 1x1 까지 밉맵 체인을 만든 뒤 레벨마다 압축하여 이어붙임
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  std::vector<MipLevel> mipmaps;
+  generateMipmaps(&rgba[0], width, height, 4, srgb, filter, mipmaps, threadCount);
+  for (size_t i = 0; i <= mipmaps.size(); i++)
+  {
+    DdsLevel entry;
+    entry.width = i == 0 ? width : mipmaps[i - 1].width;
+    entry.height = i == 0 ? height : mipmaps[i - 1].height;
+    entry.offset = image.data.size();
+    compressImage(image.format, i == 0 ? &rgba[0] : &mipmaps[i - 1].pixels[0], entry.width, entry.height, image.data, threadCount);
+    entry.size = image.data.size() - entry.offset;
+    image.levels.push_back(entry);
+  }
+  double elapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+  if (!writeDds(files[1], image))
+  {
+    std::cout << "ERROR::TEXTURE_COOK::FILE_NOT_SUCCESSFULLY_WRITTEN: " << files[1] << std::endl;
+    return 1;
+  }
+
+  static const char *FORMAT_NAMES[] = {"BC1", "BC3", "BC7"};
+  std::cout << "TEXTURE_COOK: " << files[0] << " (" << width << "x" << height << ", " << image.levels.size() << " levels) -> "
+            << FORMAT_NAMES[image.format] << (srgb ? " sRGB" : "") << ", " << image.data.size() << " bytes in " << elapsedMs << " ms"
+            << std::endl;
+  return 0;
+}